@@ -22,6 +22,8 @@
 #ifndef maslow_h
 #define maslow_h
 
+#include "Arduino.h"  // Pio and fixed width types, for sources that include this before grbl.h
+
 //
 // -- SHIELD SELECTION
 //
@@ -36,8 +38,22 @@
 // uncomment this to work on PID settings and such using a terminal window
 //#define TUNING_MODE 1
 
+//
+// -- HARDWARE ENCODER DECODING
+//
+// Uncomment to count an encoder in a SAM3X timer-counter quadrature decoder (TC QDEC) instead of
+// the pin-change interrupts. Only TC0 (phase A on D2, phase B on D13) and TC2 (phase A on D5,
+// phase B on D4) bring their decoder inputs out to the Due headers, so the encoder must be wired
+// to those pins. Axes left commented out keep the interrupt decoder.
+//#define X_ENCODER_QDEC 0   /* count X in TC0. D13 is then an input, so the heartbeat LED is off */
+//#define Y_ENCODER_QDEC 2   /* count Y in TC2. SERIAL_TIMER moves off TC2 to Timer2 */
+//#define Z_ENCODER_QDEC 2
+#define QDEC_FILTER 63      /* glitch filter, rejects pulses under QDEC_FILTER+1 MCK cycles (0.76us) */
+
 // HARDWARE PIN MAPPING
-#define HeartBeatLED 13
+#if !(defined(X_ENCODER_QDEC) && (X_ENCODER_QDEC == 0)) && !(defined(Y_ENCODER_QDEC) && (Y_ENCODER_QDEC == 0)) && !(defined(Z_ENCODER_QDEC) && (Z_ENCODER_QDEC == 0))
+  #define HeartBeatLED 13   /* shares D13 with the TC0 QDEC phase B input */
+#endif
 
 #ifdef MakerMadeCNC_V2
   #define YP_PWM 6      /* Y-axis positive direction PWM output */
@@ -126,10 +142,64 @@
 #define SCLpin  15    /* EEPROM i2c signals */
 #define SDApin  14
 
+// uncomment to run the shield EEPROM on the Due's TWI0 controller instead of bit-banging pins 14/15.
+// Reads are single sequential transfers, page writes are sent by the TWI interrupt, and the write
+// cycle is ended by polling the EEPROM for its acknowledge instead of a fixed 5ms wait.
+// Pins 14/15 are not on a TWI controller, and SDA/SCL (20/21, TWI1) carry encoder inputs on the
+// shield, so this needs a shield jumper: cut the traces from the 24LC256 SDA and SCL pins to D14 and
+// D15, and wire them to the SDA1 and SCL1 header pins next to AREF (PA17/TWD0 and PA18/TWCK0).
+// The Due has no pull-ups on SDA1/SCL1, so fit 4.7k to 3.3V on both lines.
+//#define EEPROM_HARDWARE_TWI
+#define EEPROM_TWI TWI0
+#define EEPROM_TWI_ID ID_TWI0
+#define EEPROM_TWI_IRQn TWI0_IRQn
+#define EEPROM_TWI_Handler TWI0_Handler
+#define EEPROM_TWI_PIO PIOA
+#define EEPROM_TWI_PINS (PIO_PA17A_TWD0 | PIO_PA18A_TWCK0)
+#define EEPROM_TWI_CLOCK 400000   /* Hz. 24LC256 fast mode */
+
+#define X_LIMIT_PIN 40  /* hard limit switch inputs, as X/Y/Z_LIMIT_BIT in cpu_map_due.h. Close to ground */
+#define Y_LIMIT_PIN 41  /* with the default pull-ups, $5 inverts. $21 enables the hard limit interrupts */
+#define Z_LIMIT_PIN 51
+#define Probe_PIN A5  /* touch probe input, PA4, analog pin 5 as PROBE_BIT in cpu_map_due.h. Closes to ground with the default pull-up, $6 inverts */
+
+#define SD_CS_PIN 52  /* SD card chip select with SD_JOB_STORAGE. MISO, MOSI and SCK are on the SPI header */
+
 
-#define SPINDLE_TIMER Timer1
 #define Spindle_PWM 16      /* output pin for Spindle PWM */
-#define Spindle_PERIOD 2000 /* 500 hz */
+#define Spindle_PWM_PIO PIOA                /* D16 is PA13, PWMH2 of the PWM controller on peripheral B */
+#define Spindle_PWM_PERIPH PIO_PA13B_PWMH2
+#define SPINDLE_PWM_CHANNEL 2
+#define SPINDLE_PWM_FREQUENCY 500           /* Hz. Raise for laser or router speed controllers */
+#if (SPINDLE_PWM_FREQUENCY < 2) || (SPINDLE_PWM_FREQUENCY > 320000)
+  #error "SPINDLE_PWM_FREQUENCY must be 2Hz to 320kHz, to fit a 16 bit period and keep 8 bit duty steps."
+#endif
+
+#if (defined(X_ENCODER_QDEC) && (X_ENCODER_QDEC == 2)) || (defined(Y_ENCODER_QDEC) && (Y_ENCODER_QDEC == 2)) || (defined(Z_ENCODER_QDEC) && (Z_ENCODER_QDEC == 2))
+  #define SERIAL_TIMER Timer2 /* Timer6 is channel 0 of TC2, taken by the quadrature decoder */
+  #define SERIAL_TIMER_IRQn TC2_IRQn
+  #define SERIAL_TIMER_CHANNEL (&TC0->TC_CHANNEL[2])
+#else
+  #define SERIAL_TIMER Timer6
+  #define SERIAL_TIMER_IRQn TC6_IRQn
+  #define SERIAL_TIMER_CHANNEL (&TC2->TC_CHANNEL[0])
+#endif
+// Channels and interrupts of the other DueTimer objects, as in the DueTimer.cpp Timers[] table.
+#define IDLE_TIMER_IRQn TC3_IRQn                /* Timer3, stepper idle timeout */
+#define STEP_TIMER_IRQn TC4_IRQn                /* Timer4, step interpolator */
+#define STEP_TIMER_CHANNEL (&TC1->TC_CHANNEL[1])
+#define PID_TIMER_IRQn TC5_IRQn                 /* Timer5, PID loop */
+#define PID_TIMER_CHANNEL (&TC1->TC_CHANNEL[2])
+
+// NVIC priorities with INTERRUPT_PRIORITIES, 0 (highest) to 15. The PIO controllers take every pin
+// interrupt: encoders, probe, limits and driver faults. The serial priority is also taken by the
+// UART and USB drivers of the machine port. The EEPROM TWI interrupt is always 15.
+#define IRQ_PRIORITY_PIN     0
+#define IRQ_PRIORITY_STEP    1
+#define IRQ_PRIORITY_PID     2
+#define IRQ_PRIORITY_SERIAL  3
+#define IRQ_PRIORITY_IDLE    4
+#define Serial_PERIOD 500   /* 2 khz -- each tick drains every byte the UART has queued */
 
 #ifdef MakerMadeCNC_V1
   #define Encoder_YA 20 /* Y encoder phases A & B */
@@ -182,6 +252,95 @@
   #define Encoder_XB 3
 #endif
 
+// TC QDEC inputs (TIOA/TIOB of channel 0 in each timer-counter block)
+#define QDEC0_A 2    /* PB25 TIOA0 */
+#define QDEC0_B 13   /* PB27 TIOB0 */
+#define QDEC2_A 5    /* PC25 TIOA6 */
+#define QDEC2_B 4    /* PC26 TIOB6 */
+
+#if defined(X_ENCODER_QDEC) || defined(Y_ENCODER_QDEC) || defined(Z_ENCODER_QDEC)
+  #define ENCODER_QDEC
+#endif
+
+#ifdef X_ENCODER_QDEC
+  #undef Encoder_XA
+  #undef Encoder_XB
+  #if (X_ENCODER_QDEC == 0)
+    #define Encoder_XA QDEC0_A
+    #define Encoder_XB QDEC0_B
+  #elif (X_ENCODER_QDEC == 2)
+    #define Encoder_XA QDEC2_A
+    #define Encoder_XB QDEC2_B
+  #else
+    #error "X_ENCODER_QDEC must select TC0 or TC2."
+  #endif
+#endif
+#ifdef Y_ENCODER_QDEC
+  #undef Encoder_YA
+  #undef Encoder_YB
+  #if (Y_ENCODER_QDEC == 0)
+    #define Encoder_YA QDEC0_A
+    #define Encoder_YB QDEC0_B
+  #elif (Y_ENCODER_QDEC == 2)
+    #define Encoder_YA QDEC2_A
+    #define Encoder_YB QDEC2_B
+  #else
+    #error "Y_ENCODER_QDEC must select TC0 or TC2."
+  #endif
+#endif
+#ifdef Z_ENCODER_QDEC
+  #undef Encoder_ZA
+  #undef Encoder_ZB
+  #if (Z_ENCODER_QDEC == 0)
+    #define Encoder_ZA QDEC0_A
+    #define Encoder_ZB QDEC0_B
+  #elif (Z_ENCODER_QDEC == 2)
+    #define Encoder_ZA QDEC2_A
+    #define Encoder_ZB QDEC2_B
+  #else
+    #error "Z_ENCODER_QDEC must select TC0 or TC2."
+  #endif
+#endif
+
+#if (defined(X_ENCODER_QDEC) && defined(Y_ENCODER_QDEC) && (X_ENCODER_QDEC == Y_ENCODER_QDEC)) || \
+    (defined(X_ENCODER_QDEC) && defined(Z_ENCODER_QDEC) && (X_ENCODER_QDEC == Z_ENCODER_QDEC)) || \
+    (defined(Y_ENCODER_QDEC) && defined(Z_ENCODER_QDEC) && (Y_ENCODER_QDEC == Z_ENCODER_QDEC))
+  #error "Each TC quadrature decoder can count only one encoder."
+#endif
+
+// Motor outputs or interrupt decoded encoders sharing a QDEC input pin on the selected shield.
+#ifdef ENCODER_QDEC
+  #ifndef X_ENCODER_QDEC
+    #define X_ENCODER_PIN(p) ((Encoder_XA == (p)) || (Encoder_XB == (p)))
+  #else
+    #define X_ENCODER_PIN(p) 0
+  #endif
+  #ifndef Y_ENCODER_QDEC
+    #define Y_ENCODER_PIN(p) ((Encoder_YA == (p)) || (Encoder_YB == (p)))
+  #else
+    #define Y_ENCODER_PIN(p) 0
+  #endif
+  #ifndef Z_ENCODER_QDEC
+    #define Z_ENCODER_PIN(p) ((Encoder_ZA == (p)) || (Encoder_ZB == (p)))
+  #else
+    #define Z_ENCODER_PIN(p) 0
+  #endif
+  #define QDEC_PIN_CONFLICT(p) ((XP_PWM == (p)) || (XM_PWM == (p)) || (YP_PWM == (p)) || (YM_PWM == (p)) || \
+                                (ZP_PWM == (p)) || (ZM_PWM == (p)) || (X_ENABLE == (p)) || (Y_ENABLE == (p)) || \
+                                (Z_ENABLE == (p)) || (X_FAULT == (p)) || (Y_FAULT == (p)) || (Z_FAULT == (p)) || \
+                                X_ENCODER_PIN(p) || Y_ENCODER_PIN(p) || Z_ENCODER_PIN(p))
+  #if (defined(X_ENCODER_QDEC) && (X_ENCODER_QDEC == 0)) || (defined(Y_ENCODER_QDEC) && (Y_ENCODER_QDEC == 0)) || (defined(Z_ENCODER_QDEC) && (Z_ENCODER_QDEC == 0))
+    #if QDEC_PIN_CONFLICT(QDEC0_A) || QDEC_PIN_CONFLICT(QDEC0_B)
+      #error "The selected shield already uses a TC0 QDEC pin (D2/D13)."
+    #endif
+  #endif
+  #if (defined(X_ENCODER_QDEC) && (X_ENCODER_QDEC == 2)) || (defined(Y_ENCODER_QDEC) && (Y_ENCODER_QDEC == 2)) || (defined(Z_ENCODER_QDEC) && (Z_ENCODER_QDEC == 2))
+    #if QDEC_PIN_CONFLICT(QDEC2_A) || QDEC_PIN_CONFLICT(QDEC2_B)
+      #error "The selected shield already uses a TC2 QDEC pin (D5/D4)."
+    #endif
+  #endif
+#endif
+
 
 #define X_STEP  33  /* GRBL harware interface */
 #define X_DIRECTION 36
@@ -194,6 +353,31 @@
 #define MAX_PWM_LEVEL 255
 #define MIN_PWM_LEVEL 5
 
+#define PID_REFERENCE_RATE 100  /* Hz. Loop rate the stored PID gains are tuned for */
+#define PID_RATE_MIN 50         /* Hz. Limits of the $96 servo loop rate setting */
+#define PID_RATE_MAX 2000
+
+#define AUTO_REPORT_INTERVAL_MIN 20     /* ms. Limits of the $97, $98 auto status report periods, */
+#define AUTO_REPORT_INTERVAL_MAX 60000  /* unless zero (off). */
+
+// uncomment to drive the motor PWM pins through the analogWrite() wrappers on every PID tick.
+// Otherwise analogWrite() only sets the pins up and the loop writes the duty registers.
+// The TLE5206 driver always uses the wrappers, as it switches pins between PWM and a held level.
+//#define MOTOR_PWM_ANALOGWRITE
+#if defined(DRIVER_TLE5206) && !defined(MOTOR_PWM_ANALOGWRITE)
+  #define MOTOR_PWM_ANALOGWRITE
+#endif
+
+struct MOTOR_PWM          // duty register of a motor PWM pin, cached after analogWrite() sets it up
+{
+  volatile uint32_t *duty;  // PWM_CDTYUPD of a PWM controller channel, or TC_RA/TC_RB of a timer channel
+  volatile uint32_t *cmr;   // TC_CMR of the timer channel, NULL on the PWM controller
+  uint32_t scale;           // timer counts per duty step, 16 fractional bits
+  uint32_t cmr_mask;        // TC output action bits of this pin
+  uint32_t cmr_on;          // actions while driving
+  uint32_t cmr_off;         // actions holding the pin low at zero duty
+};
+
 struct PID_MOTION
 {
   long int Kp;
@@ -215,19 +399,85 @@ struct PID_MOTION
   int P_PWM;
   int M_PWM;
   int ENABLE;
+  struct MOTOR_PWM P_OUT;
+  struct MOTOR_PWM M_OUT;
+  long int Kvff;            // velocity feed-forward gain
+  long int Kaff;            // acceleration feed-forward gain
+  long int ff_velocity;     // commanded velocity of the executing segment, counts/sec (set by the stepper)
+  long int ff_acceleration; // commanded acceleration of the executing segment, counts/sec^2
+  int PWM_out;              // signed PWM level applied by the last tick
+  long int velocity;        // encoder speed, 1/256 counts per tick (ENCODER_PERIOD_VELOCITY)
 };
 
 extern struct PID_MOTION x_axis, y_axis, z_axis;
+
+struct ENCODER_DECODER    // software quadrature decoder (axes not counted by a TC QDEC)
+{
+  Pio *portA;             // PIO port and bit mask of phase A
+  uint32_t maskA;
+  Pio *portB;             // PIO port and bit mask of phase B
+  uint32_t maskB;
+  uint8_t state;          // last (A << 1) | B
+  volatile uint32_t illegal;  // transitions with both phases changed (missed edges or noise)
+  volatile int32_t edge_position;  // axis_Position after the last counted edge
+  volatile uint32_t edge_time;     // DWT cycle count of the last counted edge
+  int32_t tick_position;  // edge_position and edge_time at the last velocity estimate
+  uint32_t tick_time;
+  uint8_t timed;          // edges are timestamped, so the velocity is estimated from their period
+};
+
+extern struct ENCODER_DECODER x_encoder, y_encoder, z_encoder;
 extern long int xSpeed, ySpeed, zSpeed;  // current speed each axis
+extern uint32_t pid_rate;  // servo loop rate Timer5 runs at, Hz. settings.pidRate as of power-up.
 extern int healthLEDcounter;
 extern int stepTestEnable;
 extern int posEnabled;
 
+extern int Motors_Disabled;
+
+void interrupt_priorities_init(void);  // INTERRUPT_PRIORITIES in config.h
+
 void motorsEnabled(void);
 void motorsDisabled(void);
 
+// PID telemetry capture (PID_TELEMETRY_SAMPLES in config.h).
+void pid_telemetry_arm(void);      // continuous capture, frozen by an alarm or a trigger
+void pid_telemetry_trigger(void);  // freeze an armed capture, otherwise record one buffer full
+void pid_telemetry_alarm(void);    // called when an alarm is raised
+void pid_telemetry_report(void);   // [TLM:state,samples,rate]
+void pid_telemetry_dump(void);     // stops the capture and prints the samples as CSV
+
+// PID autotune cycle (PID_AUTOTUNE in config.h). Returns a Grbl status code.
+uint8_t pid_autotune(uint8_t axis);
+
+// Simulated motors and encoders (MOTOR_SIMULATION in config.h).
+void motor_sim_block(float millimeters, float programmed_rate);  // a planner block loaded by the stepper
+void motor_sim_reset(void);   // clears the run statistics
+void motor_sim_report(void);  // [SIM:...] and [SFE:...]
+
 // publicly available wrapper functions for computing kinematics (defers to triangular functions).
 void  chainToPosition(float aChainLength, float bChainLength, float *x,float *y );
 void  positionToChain(float xTarget,float yTarget, float* aChainLength, float* bChainLength);
+// chain mm per sled mm at x-y, as { dA/dx, dA/dy, dB/dx, dB/dy }. See chainJacobian().
+void  chainJacobian(float x, float y, float *jacobian);
+// sled mm per chain mm at x-y, as { dx/dA, dx/dB, dy/dA, dy/dB }. false where singular.
+uint8_t chainJacobianInverse(float x, float y, float *inverse);
+// refreshes the cached machine geometry used by the kinematics. Call whenever settings change.
+void  recomputeGeometry(void);
+// number of inverse solves used by the last forward kinematics (Newton) solution.
+extern uint8_t kinematics_forward_iterations;
+#ifdef KINEMATICS_CORRECTION_GRID
+  // bound on the chain length error of the correction grid lookup, mm. Reported by $I.
+  extern float kinematics_grid_error;
+  // solves correction grid nodes for about budget_us. true until the grid is built and in use.
+  uint8_t kinematicsGridService(uint16_t budget_us);
+#endif
+#ifdef KINEMATICS_TARGET_CACHE
+  // positionToChain() calls answered from the target cache, and those solved. Reported by $I.
+  extern uint32_t kinematics_cache_hits, kinematics_cache_misses;
+#endif
+// $K kinematics benchmark (KINEMATICS_BENCHMARK in config.h). Times the kinematics over a sweep of
+// the work area and prints the round trip error.
+void  kinematicsBenchmark(void);
 
 #endif
@@ -53,6 +53,8 @@ struct PID_MOTION z_axis = {default_zKp,default_zKi,default_zImax,default_zKd,0,
 system_t sys;
 int32_t sys_position[N_AXIS];      // Real-time machine (aka home) position vector in steps.
 int32_t sys_probe_position[N_AXIS]; // Last probe position in machine coordinates and steps.
+int32_t sys_fault_position[N_AXIS]; // Measured position when a limit or driver fault tripped, in steps.
+volatile uint8_t sys_fault_axes;    // Axes whose limit or fault line tripped.
 volatile uint8_t sys_probe_state;   // Probing state value.  Used to coordinate the probing cycle with stepper ISR.
 volatile uint8_t sys_rt_exec_state;   // Global realtime executor bitflag variable for state management. See EXEC bitmasks.
 volatile uint8_t sys_rt_exec_alarm;   // Global realtime executor bitflag variable for setting various alarms.
@@ -61,12 +63,15 @@ volatile uint8_t sys_rt_exec_accessory_override; // Global realtime executor bit
 #ifdef DEBUG
   volatile uint8_t sys_rt_exec_debug;
 #endif
+#ifdef REPORT_FIELD_STARVATION
+  sys_starvation_t sys_starvation;    // Throughput loss counters for the status report.
+#endif
 
 int fault_was_low = 0;
 int Motors_Disabled = 0;
 
 long int xSpeed, ySpeed, zSpeed;  // current speed each axis
-int lastXAstate,lastXBstate,lastYAstate,lastYBstate,lastZAstate,lastZBstate;
+uint32_t pid_rate;                // servo loop rate Timer5 was started at, Hz. $96 takes effect at power-up.
 
 void serial_init(void);
 void settings_init(void); // Load Grbl settings from EEPROM
@@ -87,6 +92,229 @@ int protocol_main_loop(void);
 void protocol_init(void);
 void tuningLoop(void);
 
+#ifndef MOTOR_PWM_ANALOGWRITE
+//
+//  caches the duty register of a pin analogWrite() has already set up. The Due drives
+//  pins 6-9 from the PWM controller and the other motor pins from timer-counter outputs.
+//
+void motor_pwm_init(struct MOTOR_PWM *pwm, int pin)
+{
+  const PinDescription *desc = &g_APinDescription[pin];
+
+  if(desc->ulPinAttribute & PIN_ATTR_PWM)
+  {
+    pwm->duty = &PWM->PWM_CH_NUM[desc->ulPWMChannel].PWM_CDTYUPD;  // 0-255, same as analogWrite()
+    pwm->cmr = NULL;
+  }
+  else
+  {
+    uint32_t channel = desc->ulTCChannel;  // TCn_CHAk, TCn_CHBk pairs in channel order
+    Tc *tc = (channel < TC1_CHA3) ? TC0 : ((channel < TC2_CHA6) ? TC1 : TC2);
+    TcChannel *tch = &tc->TC_CHANNEL[(channel >> 1) % 3];
+
+    pwm->cmr = &tch->TC_CMR;
+    pwm->scale = (tch->TC_RC << 16) / MAX_PWM_LEVEL;
+    if(channel & 1)
+    {
+      pwm->duty = &tch->TC_RB;
+      pwm->cmr_mask = TC_CMR_BCPB_Msk | TC_CMR_BCPC_Msk;
+      pwm->cmr_on = TC_CMR_BCPB_CLEAR | TC_CMR_BCPC_SET;
+      pwm->cmr_off = TC_CMR_BCPB_CLEAR | TC_CMR_BCPC_CLEAR;
+    }
+    else
+    {
+      pwm->duty = &tch->TC_RA;
+      pwm->cmr_mask = TC_CMR_ACPA_Msk | TC_CMR_ACPC_Msk;
+      pwm->cmr_on = TC_CMR_ACPA_CLEAR | TC_CMR_ACPC_SET;
+      pwm->cmr_off = TC_CMR_ACPA_CLEAR | TC_CMR_ACPC_CLEAR;
+    }
+  }
+}
+
+//
+//  register level analogWrite() for a pin set up by motor_pwm_init()
+//
+static inline void motor_pwm_write(struct MOTOR_PWM *pwm, uint32_t value)
+{
+  if(pwm->cmr == NULL)
+  {
+    *pwm->duty = value;
+    return;
+  }
+  if(value == 0)
+    *pwm->cmr = (*pwm->cmr & ~pwm->cmr_mask) | pwm->cmr_off;  // as analogWrite(), no pulse at all
+  else
+  {
+    *pwm->duty = (value * pwm->scale + 0x8000) >> 16;
+    *pwm->cmr = (*pwm->cmr & ~pwm->cmr_mask) | pwm->cmr_on;
+  }
+}
+#endif
+
+//
+//  loads the loop gains from storage, scaled from their 100Hz tuning to the configured loop rate.
+//  The integral sums Error once per tick and the differential term sees the position change of
+//  one tick, so Ki scales with the period, and Kd and Imax with the rate.
+//
+void pid_load_gains(struct PID_MOTION *axis_ptr, uint32_t Kp, uint32_t Ki, uint32_t Kd, uint32_t Imax)
+{
+  uint32_t rate = pid_rate;
+
+  axis_ptr->Kp = Kp;
+  axis_ptr->Ki = (Ki * PID_REFERENCE_RATE + rate/2) / rate;
+  axis_ptr->Kd = (Kd * rate) / PID_REFERENCE_RATE;
+  axis_ptr->Imax = (Imax * rate) / PID_REFERENCE_RATE;
+}
+
+#ifdef PID_AUTOTUNE
+//
+//  Relay feedback autotune. While an axis is handed to the relay, the PID tick drives it at
+//  +/-PID_AUTOTUNE_PWM around its held target and times the oscillation from one rising switch
+//  to the next. The main program only hands the axis over and waits for the result.
+//
+#define PID_AUTOTUNE_RUNNING  0
+#define PID_AUTOTUNE_DONE     1
+#define PID_AUTOTUNE_FAILED   2
+
+struct PID_AUTOTUNE_STATE
+{
+  struct PID_MOTION *volatile axis;  // axis under relay control, NULL when not tuning
+  volatile uint8_t result;           // PID_AUTOTUNE_RUNNING until the relay hands the axis back
+  int8_t output;                     // relay state, +1 or -1
+  uint8_t cycles;                    // relay cycles completed
+  uint32_t tick;                     // ticks since the start
+  uint32_t cycle_tick;               // tick of the last rising switch, 0 before the first
+  long int peak_max;                 // following error extremes of the current cycle
+  long int peak_min;
+  uint32_t period_sum;               // ticks per cycle, summed over the measured cycles
+  uint32_t amplitude_sum;            // peak to peak error, summed over the measured cycles
+};
+
+static struct PID_AUTOTUNE_STATE autotune;
+
+static void pid_autotune_finish(struct PID_MOTION *axis_ptr, uint8_t result)
+{
+  axis_ptr->Integral = 0;  // the relay wound it up, start the loop from a clean slate
+  autotune.axis = NULL;
+  autotune.result = result;
+}
+
+static long pid_autotune_relay(struct PID_MOTION *axis_ptr)  // from compute_PID
+{
+  long error = axis_ptr->Error;
+
+  autotune.tick++;
+  if((error > PID_AUTOTUNE_MAX_ERROR) || (error < -PID_AUTOTUNE_MAX_ERROR) ||
+     (autotune.tick > (uint32_t)PID_AUTOTUNE_TIMEOUT * pid_rate))
+  {
+    pid_autotune_finish(axis_ptr, PID_AUTOTUNE_FAILED);  // running away, or not oscillating
+    return(0);
+  }
+
+  if(error > autotune.peak_max) autotune.peak_max = error;
+  if(error < autotune.peak_min) autotune.peak_min = error;
+
+  if((autotune.output < 0) && (error > PID_AUTOTUNE_HYSTERESIS))
+  {
+    autotune.output = 1;   // rising switch, a full relay cycle since the last one
+    if(autotune.cycle_tick && (++autotune.cycles > PID_AUTOTUNE_SETTLE_CYCLES))
+    {
+      autotune.period_sum += autotune.tick - autotune.cycle_tick;
+      autotune.amplitude_sum += autotune.peak_max - autotune.peak_min;
+      if(autotune.cycles >= (PID_AUTOTUNE_SETTLE_CYCLES + PID_AUTOTUNE_CYCLES))
+      {
+        pid_autotune_finish(axis_ptr, PID_AUTOTUNE_DONE);
+        return(0);
+      }
+    }
+    autotune.cycle_tick = autotune.tick;
+    autotune.peak_max = error;
+    autotune.peak_min = error;
+  }
+  else if((autotune.output > 0) && (error < -PID_AUTOTUNE_HYSTERESIS))
+    autotune.output = -1;
+
+  return(autotune.output * ((long)PID_AUTOTUNE_PWM << 10));
+}
+
+//
+//  tunes one axis and stores its gains. The relay output h and the oscillation amplitude a
+//  give the ultimate gain Ku = 4h / (pi * sqrt(a^2 - hysteresis^2)) in PWM per count, and the
+//  period Tu. Then Kp = 0.2 Ku, Ti = Tu / 2 and Td = Tu / 3, converted to the stored units:
+//  Kp in 1/1024 PWM per count, Ki in 1/8192 PWM per count-tick and Kd in 1/1024 PWM per count
+//  change in a tick, both at PID_REFERENCE_RATE.
+//
+uint8_t pid_autotune(uint8_t axis)
+{
+  struct PID_MOTION *axis_ptr;
+  float period, amplitude, Ku, Kp;
+  uint32_t gain[4];
+  uint8_t idx, status;
+
+  switch(axis)
+  {
+    case X_AXIS: axis_ptr = &x_axis; break;
+    case Y_AXIS: axis_ptr = &y_axis; break;
+    default: axis_ptr = &z_axis; break;
+  }
+  if(sys.abort) return(STATUS_OK);
+  if(Motors_Disabled) return(STATUS_IDLE_ERROR);
+
+  memset(&autotune, 0, sizeof(autotune));
+  autotune.output = 1;
+  autotune.result = PID_AUTOTUNE_RUNNING;
+  autotune.axis = axis_ptr;   // the next PID tick starts the relay
+  while(autotune.result == PID_AUTOTUNE_RUNNING)
+  {
+    protocol_execute_realtime();
+    if(sys.abort)
+    {
+      autotune.axis = NULL;
+      axis_ptr->Integral = 0;
+      return(STATUS_OK);
+    }
+  }
+  if(autotune.result != PID_AUTOTUNE_DONE) return(STATUS_PID_AUTOTUNE_FAILED);
+
+  period = (float)autotune.period_sum / ((float)PID_AUTOTUNE_CYCLES * pid_rate);  // sec
+  amplitude = (float)autotune.amplitude_sum / (2.0 * PID_AUTOTUNE_CYCLES);  // counts
+  if(amplitude <= PID_AUTOTUNE_HYSTERESIS) return(STATUS_PID_AUTOTUNE_FAILED);
+
+  Ku = (4.0 * PID_AUTOTUNE_PWM) / (M_PI * sqrtf(amplitude*amplitude - PID_AUTOTUNE_HYSTERESIS*PID_AUTOTUNE_HYSTERESIS));
+  Kp = 0.2 * Ku;
+  gain[0] = lroundf(Kp * 1024.0);
+  gain[1] = lroundf((Kp * 8192.0) / (0.5 * period * PID_REFERENCE_RATE));
+  gain[2] = lroundf(Kp * (period / 3.0) * PID_REFERENCE_RATE * 1024.0);
+  gain[3] = (gain[1] > 0) ? lroundf((PID_AUTOTUNE_PWM * 8192.0) / gain[1]) : 0;
+
+  printPgmString(PSTR("[PT:"));
+  serial_write("XYZ"[axis]);
+  serial_write(',');
+  printFloat(period, 3);
+  serial_write(',');
+  printFloat(amplitude, 1);
+  for(idx = 0; idx < 4; idx++)
+  {
+    serial_write(',');
+    print_uint32_base10(gain[idx]);
+  }
+  printPgmString(PSTR("]\r\n"));
+
+  for(idx = 0; idx < 4; idx++)    // $40-$43, $50-$53 or $60-$63
+  {
+    status = settings_store_global_setting(40 + 10*axis + idx, gain[idx]);
+    if(status != STATUS_OK) return(status);
+  }
+  switch(axis)
+  {
+    case X_AXIS: pid_load_gains(axis_ptr, settings.x_PID_Kp, settings.x_PID_Ki, settings.x_PID_Kd, settings.x_PID_Imax); break;
+    case Y_AXIS: pid_load_gains(axis_ptr, settings.y_PID_Kp, settings.y_PID_Ki, settings.y_PID_Kd, settings.y_PID_Imax); break;
+    default: pid_load_gains(axis_ptr, settings.z_PID_Kp, settings.z_PID_Ki, settings.z_PID_Kd, settings.z_PID_Imax); break;
+  }
+  return(STATUS_OK);
+}
+#endif
+
 //
 //  computes new axis speed based on motor positions state and target
 //
@@ -106,7 +334,18 @@ long compute_PID(struct PID_MOTION *axis_ptr)
 
   axis_ptr->DiffTerm = (axis_ptr->last_Position - axis_ptr->axis_Position);
   axis_ptr->last_Position = axis_ptr->axis_Position;       // differential term..
+ #ifdef ENCODER_PERIOD_VELOCITY
+  axis_ptr->Speed -= ((axis_ptr->Kd) * axis_ptr->velocity) >> 8;  // same scale, finer than a count per tick
+ #else
   axis_ptr->Speed += ((axis_ptr->Kd) * axis_ptr->DiffTerm);
+ #endif
+
+  axis_ptr->Speed += (axis_ptr->Kvff) * axis_ptr->ff_velocity;       // feed-forward terms..
+  axis_ptr->Speed += ((axis_ptr->Kaff) * axis_ptr->ff_acceleration) / 100;
+
+ #ifdef PID_AUTOTUNE
+  if(axis_ptr == autotune.axis) axis_ptr->Speed = pid_autotune_relay(axis_ptr);  // relay replaces the loop
+ #endif
 
   Speed = axis_ptr->Speed;
   sign = 1;
@@ -122,11 +361,13 @@ long compute_PID(struct PID_MOTION *axis_ptr)
   #if (MIN_PWM_LEVEL > 0)
     if(PWM_value < MIN_PWM_LEVEL) PWM_value = MIN_PWM_LEVEL;  // PWM limiter
   #endif
+  axis_ptr->PWM_out = (sign > 0) ? PWM_value : -PWM_value;
 
  #ifdef TUNING_MODE
   if(!posEnabled) Speed = 0;   // all stop (forced)
  #endif
 
+ #ifndef MOTOR_SIMULATION  // motors held, the model takes PWM_out
   if(sign > 0)
   {
   #ifdef DRIVER_TLE5206
@@ -136,8 +377,13 @@ long compute_PID(struct PID_MOTION *axis_ptr)
       else
         analogWrite(axis_ptr->P_PWM, (255-PWM_value));
   #else
+    #ifdef MOTOR_PWM_ANALOGWRITE
       analogWrite(axis_ptr->M_PWM, 0);       // spin Positive
       analogWrite(axis_ptr->P_PWM, PWM_value);
+    #else
+      motor_pwm_write(&axis_ptr->M_OUT, 0);  // spin Positive
+      motor_pwm_write(&axis_ptr->P_OUT, PWM_value);
+    #endif
   #endif
   }
   else
@@ -149,10 +395,16 @@ long compute_PID(struct PID_MOTION *axis_ptr)
       else
       analogWrite(axis_ptr->M_PWM, (255-PWM_value));
    #else
+    #ifdef MOTOR_PWM_ANALOGWRITE
       analogWrite(axis_ptr->P_PWM, 0);       // spin Negative
       analogWrite(axis_ptr->M_PWM, PWM_value);
+    #else
+      motor_pwm_write(&axis_ptr->P_OUT, 0);  // spin Negative
+      motor_pwm_write(&axis_ptr->M_OUT, PWM_value);
+    #endif
    #endif
   }
+ #endif
 
   return(axis_ptr->Speed);
 }
@@ -171,7 +423,7 @@ void motorsDisabled(void)
 void motorsEnabled(void)
 {
     Motors_Disabled = 0;
-  #ifndef DRIVER_TLE5206
+  #if !defined(DRIVER_TLE5206) && !defined(MOTOR_SIMULATION)
     digitalWrite(X_ENABLE, 1);  // Enable the motor driver
     digitalWrite(Y_ENABLE, 1);
     digitalWrite(Z_ENABLE, 1);
@@ -179,18 +431,395 @@ void motorsEnabled(void)
 //  DEBUG_COM_PORT.print("MOTORS ON\n");
 }
 
+#ifdef ENCODER_QDEC
+//
+//  Timer-counter quadrature decoders
+//
+static uint32_t x_qdec_count, y_qdec_count, z_qdec_count;  // last counter values read
+
+void qdec_init(Tc *tc, uint32_t id, Pio *pio, uint32_t pins)
+{
+  pmc_enable_periph_clk(id);
+  PIO_Configure(pio, PIO_PERIPH_B, pins, PIO_PULLUP);  // TIOA/TIOB are peripheral B on both blocks
+  tc->TC_CHANNEL[0].TC_CMR = TC_CMR_TCCLKS_XC0;        // channel 0 counts the decoded edges
+  tc->TC_BMR = TC_BMR_QDEN | TC_BMR_POSEN | TC_BMR_MAXFILT(QDEC_FILTER);  // both phases, x4 count
+  tc->TC_CHANNEL[0].TC_CCR = TC_CCR_CLKEN | TC_CCR_SWTRG;
+}
+
+//
+//  Folds the change in hardware count into axis_Position. Counting the change, rather than copying
+//  the counter, keeps setup, homing and the tuning tool zeroing axis_Position directly.
+//  The counter runs up when phase A leads, the opposite sense of the interrupt decoder.
+//
+static inline void qdec_update(struct PID_MOTION *axis_ptr, Tc *tc, uint32_t *last_count)
+{
+  uint32_t count = tc->TC_CHANNEL[0].TC_CV;
+  axis_ptr->axis_Position -= (int32_t)(count - *last_count);
+  *last_count = count;
+}
+
+  #define QDEC_TC(n) ((n) == 0 ? TC0 : TC2)
+  #define QDEC_ID(n) ((n) == 0 ? ID_TC0 : ID_TC6)
+  #define QDEC_PIO(n) ((n) == 0 ? PIOB : PIOC)
+  #define QDEC_PINS(n) ((n) == 0 ? (PIO_PB25B_TIOA0 | PIO_PB27B_TIOB0) : (PIO_PC25B_TIOA6 | PIO_PC26B_TIOB6))
+#endif
+
+#ifdef PID_TELEMETRY_SAMPLES
+//
+//  PID telemetry ring buffer. Written by the PID tick while capturing, read back by $TD.
+//  The state is only changed to start a capture while the tick is not writing, so the main
+//  program never has to disable the PID interrupt.
+//
+#define TELEMETRY_OFF     0       // nothing captured
+#define TELEMETRY_ARMED   bit(0)  // continuous capture until an alarm or $TT
+#define TELEMETRY_SHOT    bit(1)  // recording one buffer full after $TT
+#define TELEMETRY_HELD    bit(2)  // capture frozen, ready to dump
+
+struct PID_TELEMETRY_AXIS
+{
+  int32_t target;
+  int32_t position;
+  int32_t error;
+  int32_t pwm;
+ #ifdef ENCODER_PERIOD_VELOCITY
+  int32_t velocity;
+ #endif
+};
+
+static struct PID_TELEMETRY_AXIS telemetry_buffer[PID_TELEMETRY_SAMPLES][N_AXIS];
+static volatile uint8_t telemetry_state = TELEMETRY_OFF;
+static volatile uint16_t telemetry_head;   // next sample written
+static volatile uint16_t telemetry_count;  // valid samples in the buffer
+
+static void telemetry_sample(struct PID_TELEMETRY_AXIS *sample, struct PID_MOTION *axis_ptr)
+{
+  sample->target = axis_ptr->target;
+  sample->position = axis_ptr->axis_Position;
+  sample->error = axis_ptr->Error;
+  sample->pwm = axis_ptr->PWM_out;
+ #ifdef ENCODER_PERIOD_VELOCITY
+  sample->velocity = axis_ptr->velocity;
+ #endif
+}
+
+static void pid_telemetry_record(void)  // from the PID tick, after the outputs are written
+{
+  struct PID_TELEMETRY_AXIS *sample = telemetry_buffer[telemetry_head];
+
+  telemetry_sample(&sample[X_AXIS], &x_axis);
+  telemetry_sample(&sample[Y_AXIS], &y_axis);
+  telemetry_sample(&sample[Z_AXIS], &z_axis);
+
+  if(++telemetry_head >= PID_TELEMETRY_SAMPLES) telemetry_head = 0;
+  if(telemetry_count < PID_TELEMETRY_SAMPLES) telemetry_count++;
+  else if(telemetry_state == TELEMETRY_SHOT) telemetry_state = TELEMETRY_HELD;
+}
+
+static void telemetry_start(uint8_t state)
+{
+  telemetry_state = TELEMETRY_OFF;  // the tick stops writing before the buffer is reset
+  telemetry_head = 0;
+  telemetry_count = 0;
+  telemetry_state = state;
+}
+
+void pid_telemetry_arm(void)
+{
+  telemetry_start(TELEMETRY_ARMED);
+}
+
+void pid_telemetry_trigger(void)
+{
+  if(telemetry_state == TELEMETRY_ARMED)
+    telemetry_state = TELEMETRY_HELD;
+  else
+    telemetry_start(TELEMETRY_SHOT);
+}
+
+void pid_telemetry_alarm(void)
+{
+  if(telemetry_state == TELEMETRY_ARMED) telemetry_state = TELEMETRY_HELD;
+}
+
+void pid_telemetry_report(void)
+{
+  printPgmString(PSTR("[TLM:"));
+  switch(telemetry_state)
+  {
+    case TELEMETRY_ARMED: printPgmString(PSTR("Armed")); break;
+    case TELEMETRY_SHOT: printPgmString(PSTR("Shot")); break;
+    case TELEMETRY_HELD: printPgmString(PSTR("Held")); break;
+    default: printPgmString(PSTR("Off")); break;
+  }
+  serial_write(',');
+  print_uint32_base10(telemetry_count);
+  serial_write(',');
+  print_uint32_base10(pid_rate);
+  printPgmString(PSTR("]\r\n"));
+}
+
+//
+//  One line per tick, oldest first: tick, then target,position,error,PWM of the X, Y and Z axes,
+//  each followed by its velocity in 1/256 counts per tick with ENCODER_PERIOD_VELOCITY.
+//
+void pid_telemetry_dump(void)
+{
+  struct PID_TELEMETRY_AXIS *sample;
+  uint16_t n, idx;
+  uint8_t axis;
+
+  if(telemetry_state & (TELEMETRY_ARMED | TELEMETRY_SHOT)) telemetry_state = TELEMETRY_HELD;
+  pid_telemetry_report();
+
+  idx = (telemetry_head + PID_TELEMETRY_SAMPLES - telemetry_count) % PID_TELEMETRY_SAMPLES;
+  for(n = 0; n < telemetry_count; n++)
+  {
+    print_uint32_base10(n);
+    sample = telemetry_buffer[idx];
+    for(axis = 0; axis < N_AXIS; axis++)
+    {
+      serial_write(',');
+      printInteger(sample[axis].target);
+      serial_write(',');
+      printInteger(sample[axis].position);
+      serial_write(',');
+      printInteger(sample[axis].error);
+      serial_write(',');
+      printInteger(sample[axis].pwm);
+ #ifdef ENCODER_PERIOD_VELOCITY
+      serial_write(',');
+      printInteger(sample[axis].velocity);
+ #endif
+    }
+    printPgmString(PSTR("\r\n"));
+    if(++idx >= PID_TELEMETRY_SAMPLES) idx = 0;
+  }
+}
+#endif
+
+#ifdef MOTOR_SIMULATION
+//
+//  Motor and encoder model for running jobs with the motors held. Each axis is a gearmotor with a
+//  first order speed response to the PWM level of the tick: full PWM settles at MOTOR_SIM_MAX_SPEED
+//  with time constant MOTOR_SIM_TIME_CONSTANT, and levels up to MOTOR_SIM_DEADBAND do not turn it.
+//  The model counts axis_Position in place of the encoders. Speed and the part count carried
+//  between ticks are in 1/65536 counts, so slow moves still advance between whole counts.
+//
+struct MOTOR_SIM_AXIS
+{
+  int32_t velocity;      // 1/65536 counts per tick
+  int32_t fraction;      // 1/65536 counts not yet counted
+  int32_t max_speed;     // counts/sec at full PWM
+};
+
+static struct MOTOR_SIM_AXIS sim_axis[N_AXIS] = {
+  { 0, 0, MOTOR_SIM_MAX_SPEED_XY },
+  { 0, 0, MOTOR_SIM_MAX_SPEED_XY },
+  { 0, 0, MOTOR_SIM_MAX_SPEED_Z }
+};
+
+//
+//  Statistics of the simulated run. The PID tick counts the cycle time and following error, and
+//  st_prep_buffer() adds each block of the cycle as it is loaded.
+//
+struct MOTOR_SIM_STATS
+{
+  uint32_t cycle_ticks;          // ticks in the cycle state
+  uint32_t max_error[N_AXIS];    // counts
+  uint64_t error_sum[N_AXIS];    // counts, summed over the cycle ticks
+  uint32_t blocks;
+  float path_mm;
+  float programmed_min;          // time of the blocks at their programmed rates, min
+};
+
+static struct MOTOR_SIM_STATS sim_stats;
+
+static void motor_sim_update(struct PID_MOTION *axis_ptr, struct MOTOR_SIM_AXIS *sim, int32_t alpha)
+{
+  int32_t target = 0;
+  int32_t pwm = abs(axis_ptr->PWM_out);
+
+  if(pwm > MOTOR_SIM_DEADBAND)
+  {
+    int64_t top = ((int64_t)sim->max_speed << 16) / pid_rate;
+    target = (int32_t)((top * (pwm - MOTOR_SIM_DEADBAND)) / (MAX_PWM_LEVEL - MOTOR_SIM_DEADBAND));
+    if(axis_ptr->PWM_out < 0) target = -target;
+  }
+  sim->velocity += (int32_t)(((int64_t)(target - sim->velocity) * alpha) >> 16);
+
+  sim->fraction += sim->velocity;
+  int32_t counts = sim->fraction >> 16;  // rounds down, also when negative
+  sim->fraction -= counts << 16;
+  axis_ptr->axis_Position += counts;
+}
+
+static void motor_sim_error(uint8_t axis, struct PID_MOTION *axis_ptr)
+{
+  uint32_t error = abs(axis_ptr->Error);
+  if(error > sim_stats.max_error[axis]) sim_stats.max_error[axis] = error;
+  sim_stats.error_sum[axis] += error;
+}
+
+static void motor_sim_tick(void)  // from the PID tick, after the outputs are computed
+{
+  // Share of the speed change made in one tick, 1/65536, and all of it for a time constant under a tick.
+  int32_t alpha = (65536 * 1000) / (pid_rate * MOTOR_SIM_TIME_CONSTANT);
+  if(alpha > 65536) alpha = 65536;
+
+  motor_sim_update(&x_axis, &sim_axis[X_AXIS], alpha);
+  motor_sim_update(&y_axis, &sim_axis[Y_AXIS], alpha);
+  motor_sim_update(&z_axis, &sim_axis[Z_AXIS], alpha);
+
+  if(sys.state == STATE_CYCLE)
+  {
+    sim_stats.cycle_ticks++;
+    motor_sim_error(X_AXIS, &x_axis);
+    motor_sim_error(Y_AXIS, &y_axis);
+    motor_sim_error(Z_AXIS, &z_axis);
+  }
+}
+
+void motor_sim_block(float millimeters, float programmed_rate)
+{
+  if(!(sys.state & (STATE_CYCLE | STATE_HOLD))) return;  // not homing, jogging or parking
+  sim_stats.blocks++;
+  sim_stats.path_mm += millimeters;
+  if(programmed_rate > 0) sim_stats.programmed_min += millimeters / programmed_rate;
+}
+
+void motor_sim_reset(void)
+{
+  noInterrupts();  // the tick records into the same statistics
+  memset(&sim_stats, 0, sizeof(sim_stats));
+  interrupts();
+}
+
+//
+//  [SIM:cycle time s,blocks,mm,feed,programmed feed] with feeds in mm/min, then
+//  [SFE:axis,max,mean] following error in mm for each axis.
+//
+void motor_sim_report(void)
+{
+  struct MOTOR_SIM_STATS stats;
+  uint8_t axis;
+
+  noInterrupts();  // take a consistent copy, as the tick may record while printing
+  memcpy(&stats, &sim_stats, sizeof(stats));
+  interrupts();
+
+  float minutes = stats.cycle_ticks / (60.0 * pid_rate);
+  printPgmString(PSTR("[SIM:"));
+  printFloat(60.0 * minutes, 2);
+  serial_write(',');
+  print_uint32_base10(stats.blocks);
+  serial_write(',');
+  printFloat(stats.path_mm, 1);
+  serial_write(',');
+  printFloat((minutes > 0) ? stats.path_mm / minutes : 0.0, 1);
+  serial_write(',');
+  printFloat((stats.programmed_min > 0) ? stats.path_mm / stats.programmed_min : 0.0, 1);
+  printPgmString(PSTR("]\r\n"));
+
+  for(axis = 0; axis < N_AXIS; axis++)
+  {
+    printPgmString(PSTR("[SFE:"));
+    serial_write("XYZ"[axis]);
+    serial_write(',');
+    printFloat(stats.max_error[axis] / settings.steps_per_mm[axis], 3);
+    serial_write(',');
+    printFloat(stats.cycle_ticks ? (stats.error_sum[axis] / (float)stats.cycle_ticks) / settings.steps_per_mm[axis] : 0.0, 3);
+    printPgmString(PSTR("]\r\n"));
+  }
+}
+#endif
+
+#ifdef ENCODER_PERIOD_VELOCITY
+//
+//  1/T velocity: the counts between the last edges seen by two ticks, over the time between those
+//  edges, instead of the counts per tick. Resolves speeds well under a count per tick. With no edge
+//  since the last estimate, the speed can be at most one count over the time since the last edge,
+//  so the estimate decays toward zero as the axis stops. Encoders counted by a TC QDEC are not
+//  timestamped and keep the count per tick.
+//
+static void encoder_velocity(struct ENCODER_DECODER *enc, struct PID_MOTION *axis_ptr, uint32_t now, uint32_t tick_cycles)
+{
+  if(!enc->timed)
+  {
+    axis_ptr->velocity = (axis_ptr->axis_Position - axis_ptr->last_Position) << 8;
+    return;
+  }
+
+  CRITICAL_ENTER();  // the edge interrupts write the pair
+  int32_t edge_position = enc->edge_position;
+  uint32_t edge_time = enc->edge_time;
+  CRITICAL_EXIT();
+
+  int32_t counts = edge_position - enc->tick_position;
+  uint32_t elapsed = edge_time - enc->tick_time;
+  if((counts != 0) && (elapsed != 0))
+  {
+    axis_ptr->velocity = ((int64_t)counts * tick_cycles * 256) / elapsed;
+    enc->tick_position = edge_position;
+    enc->tick_time = edge_time;
+  }
+  else
+  {
+    uint32_t since = now - enc->tick_time;
+    if(since & 0x80000000)
+      axis_ptr->velocity = 0;  // no edge for half the counter period (25 seconds)
+    else if(since > 0)
+    {
+      long int bound = ((uint64_t)tick_cycles * 256) / since;
+      if(axis_ptr->velocity > bound) axis_ptr->velocity = bound;
+      if(axis_ptr->velocity < -bound) axis_ptr->velocity = -bound;
+    }
+  }
+}
+#endif
+
 void MotorPID_Timer_handler(void)  // PID interrupt service routine
 {
+  PROFILE_LATENCY(PROFILE_PID_LATENCY, PID_TIMER_CHANNEL);
+  PROFILE_FUNCTION(PROFILE_PID);
+  #ifndef MOTOR_SIMULATION  // otherwise the model counts the encoders
+  #ifdef X_ENCODER_QDEC
+    qdec_update(&x_axis, QDEC_TC(X_ENCODER_QDEC), &x_qdec_count);
+  #endif
+  #ifdef Y_ENCODER_QDEC
+    qdec_update(&y_axis, QDEC_TC(Y_ENCODER_QDEC), &y_qdec_count);
+  #endif
+  #ifdef Z_ENCODER_QDEC
+    qdec_update(&z_axis, QDEC_TC(Z_ENCODER_QDEC), &z_qdec_count);
+  #endif
+  #endif
+
     x_axis.Error = x_axis.target - x_axis.axis_Position; // current position error
     y_axis.Error = y_axis.target - y_axis.axis_Position; // current position error
     z_axis.Error = z_axis.target - z_axis.axis_Position; // current position error
 
-    interrupts();  // reenable interrupts so encoder pulses will all be counted!!
+    // With INTERRUPT_PRIORITIES, encoder edges are counted during the loop by preempting it.
+    // Otherwise they wait for the handler to return. Either way there is nothing to re-enable here.
+
+  #ifdef ENCODER_PERIOD_VELOCITY
+    uint32_t now = DWT->CYCCNT;
+    uint32_t tick_cycles = VARIANT_MCK / pid_rate;
+    encoder_velocity(&x_encoder, &x_axis, now, tick_cycles);
+    encoder_velocity(&y_encoder, &y_axis, now, tick_cycles);
+    encoder_velocity(&z_encoder, &z_axis, now, tick_cycles);
+  #endif
 
     xSpeed = compute_PID(&x_axis);
     ySpeed = compute_PID(&y_axis);
     zSpeed = compute_PID(&z_axis);
 
+  #ifdef MOTOR_SIMULATION
+    motor_sim_tick();
+  #endif
+
+  #ifdef PID_TELEMETRY_SAMPLES
+    if(telemetry_state & (TELEMETRY_ARMED | TELEMETRY_SHOT)) pid_telemetry_record();
+  #endif
+
   #ifdef TUNING_MODE
     if(stepTestEnable)
     {
@@ -207,140 +836,99 @@ void MotorPID_Timer_handler(void)  // PID interrupt service routine
   //   serialScanner_handler(); // work the serial buffer pre-parser from this timer!
   //  #endif
 
+  #ifdef HeartBeatLED
     digitalWrite(HeartBeatLED, healthLEDcounter++ & 0x40);
+  #endif
 }
 
-void update_Encoder_XA(void)
+//
+//  Quadrature state table, indexed by (last state << 2) | new state, with state = (A << 1) | B.
+//  Both phases changing at once is an illegal transition: the edge was missed or was noise, so
+//  it is counted and the position is left alone.
+//
+#define QUAD_ILLEGAL 2
+static const int8_t quadrature_table[16] =
 {
-  volatile int encState  = 0;
-  delayMicroseconds(2);
-  encState = (digitalRead(Encoder_XA) << 1) + digitalRead(Encoder_XB);
-  if(lastXAstate == encState) return; // noise reject
-  switch(encState)
-  {
-    case 0:
-    case 3:
-      x_axis.axis_Position++;
-      lastXAstate = encState;
-      break;
-
-    case 1:
-    case 2:
-      x_axis.axis_Position--;
-      lastXAstate = encState;
-      break;
-  }
+  0,  1, -1, QUAD_ILLEGAL,     // from 00
+ -1,  0, QUAD_ILLEGAL,  1,     // from 01
+  1, QUAD_ILLEGAL,  0, -1,     // from 10
+  QUAD_ILLEGAL, -1,  1,  0     // from 11
+};
+
+struct ENCODER_DECODER x_encoder, y_encoder, z_encoder;
+
+void encoder_init(struct ENCODER_DECODER *enc, int pinA, int pinB)
+{
+  enc->portA = g_APinDescription[pinA].pPort;  // cache the PIO port and bit of each phase
+  enc->maskA = g_APinDescription[pinA].ulPin;
+  enc->portB = g_APinDescription[pinB].pPort;
+  enc->maskB = g_APinDescription[pinB].ulPin;
+  enc->state = ((enc->portA->PIO_PDSR & enc->maskA) ? 2 : 0) | ((enc->portB->PIO_PDSR & enc->maskB) ? 1 : 0);
+  enc->illegal = 0;
+ #ifdef ENCODER_PERIOD_VELOCITY
+  enc->timed = true;
+ #endif
 }
 
-void update_Encoder_XB(void)
+//
+//  Shared by the A and B edge interrupts of an axis. Both phases come from one PIO_PDSR read when
+//  they share a port (two on the stock shields, where D2/D3 span PIOB and PIOC).
+//
+static inline void encoder_decode(struct ENCODER_DECODER *enc, struct PID_MOTION *axis_ptr)
 {
-  volatile int encState  = 0;
-  delayMicroseconds(2);
-  encState = (digitalRead(Encoder_XA) << 1) + digitalRead(Encoder_XB);
-  if(lastXBstate == encState) return; // noise reject
-  switch(encState)
+  PROFILE_FUNCTION(PROFILE_ENCODER);
+  uint32_t pdsrA = enc->portA->PIO_PDSR;
+  uint32_t pdsrB = (enc->portB == enc->portA) ? pdsrA : enc->portB->PIO_PDSR;
+  uint8_t state = ((pdsrA & enc->maskA) ? 2 : 0) | ((pdsrB & enc->maskB) ? 1 : 0);
+  int8_t count = quadrature_table[(enc->state << 2) | state];
+
+  enc->state = state;
+  if(count == QUAD_ILLEGAL)
+    enc->illegal++;
+  else if(count != 0)
   {
-    case 0:
-    case 3:
-      x_axis.axis_Position--;
-      lastXBstate = encState;
-      break;
-
-    case 1:
-    case 2:
-      x_axis.axis_Position++;
-      lastXBstate = encState;
-      break;
+    axis_ptr->axis_Position += count;
+   #ifdef ENCODER_PERIOD_VELOCITY
+    enc->edge_position = axis_ptr->axis_Position;
+    enc->edge_time = DWT->CYCCNT;
+   #endif
   }
 }
 
-void update_Encoder_YA(void)
+void update_Encoder_X(void)
 {
-  volatile int encState  = 0;
-  delayMicroseconds(2);
-  encState = (digitalRead(Encoder_YA) << 1) + digitalRead(Encoder_YB);
-  if(lastYAstate == encState) return; // noise reject
-  switch(encState)
-  {
-    case 0:
-    case 3:
-      y_axis.axis_Position++;
-      lastYAstate = encState;
-      break;
-
-    case 1:
-    case 2:
-      y_axis.axis_Position--;
-      lastYAstate = encState;
-      break;
-  }
+  encoder_decode(&x_encoder, &x_axis);
 }
 
-void update_Encoder_YB(void)
+void update_Encoder_Y(void)
 {
-  volatile int encState  = 0;
-  delayMicroseconds(2);
-  encState = (digitalRead(Encoder_YA) << 1) + digitalRead(Encoder_YB);
-  if(lastYBstate == encState) return; // noise reject
-  switch(encState)
-  {
-    case 0:
-    case 3:
-      y_axis.axis_Position--;
-      lastYBstate = encState;
-      break;
-
-    case 1:
-    case 2:
-     y_axis.axis_Position++;
-     lastYBstate = encState;
-     break;
-  }
+  encoder_decode(&y_encoder, &y_axis);
 }
 
-void update_Encoder_ZA(void)
+void update_Encoder_Z(void)
 {
-  volatile int encState  = 0;
-  delayMicroseconds(2);
-  encState = (digitalRead(Encoder_ZA) << 1) + digitalRead(Encoder_ZB);
-  if(lastZAstate == encState) return; // noise reject
-  switch(encState)
-  {
-    case 0:
-    case 3:
-      z_axis.axis_Position++;
-      lastZAstate = encState;
-      break;
-
-    case 1:
-    case 2:
-      z_axis.axis_Position--;
-      lastZAstate = encState;
-      break;
-  }
+  encoder_decode(&z_encoder, &z_axis);
 }
 
-void update_Encoder_ZB(void)
+#ifdef INTERRUPT_PRIORITIES
+//
+//  NVIC priorities, IRQ_PRIORITY_xxx in MaslowDue.h. DueTimer and attachInterrupt() only enable
+//  their interrupts, so these hold however often the timers are restarted.
+//
+void interrupt_priorities_init(void)
 {
-  volatile int encState  = 0;
-  delayMicroseconds(2);
-  encState = (digitalRead(Encoder_ZA) << 1) + digitalRead(Encoder_ZB);
-  if(lastZBstate == encState) return; // noise reject
-  switch(encState)
-  {
-    case 0:
-    case 3:
-      z_axis.axis_Position--;
-      lastZBstate = encState;
-      break;
-
-    case 1:
-    case 2:
-      z_axis.axis_Position++;
-      lastZBstate = encState;
-      break;
-  }
+  NVIC_SetPriority(PIOA_IRQn, IRQ_PRIORITY_PIN);
+  NVIC_SetPriority(PIOB_IRQn, IRQ_PRIORITY_PIN);
+  NVIC_SetPriority(PIOC_IRQn, IRQ_PRIORITY_PIN);
+  NVIC_SetPriority(PIOD_IRQn, IRQ_PRIORITY_PIN);
+  NVIC_SetPriority(STEP_TIMER_IRQn, IRQ_PRIORITY_STEP);
+  NVIC_SetPriority(PID_TIMER_IRQn, IRQ_PRIORITY_PID);
+  NVIC_SetPriority(SERIAL_TIMER_IRQn, IRQ_PRIORITY_SERIAL);
+  NVIC_SetPriority(UART_IRQn, IRQ_PRIORITY_SERIAL);
+  NVIC_SetPriority(UOTGHS_IRQn, IRQ_PRIORITY_SERIAL);
+  NVIC_SetPriority(IDLE_TIMER_IRQn, IRQ_PRIORITY_IDLE);
 }
+#endif
 
 //
 //  Initialize hardware and preset variables
@@ -351,8 +939,10 @@ void setup()
 
   noInterrupts();           // disable all interrupts
 
-  pinMode(HeartBeatLED, OUTPUT);
-  digitalWrite(HeartBeatLED, LOW);
+  #ifdef HeartBeatLED
+    pinMode(HeartBeatLED, OUTPUT);
+    digitalWrite(HeartBeatLED, LOW);
+  #endif
 
   pinMode(XP_PWM, OUTPUT);
   pinMode(XM_PWM, OUTPUT);
@@ -369,6 +959,10 @@ void setup()
   #else
     analogWrite(XP_PWM, 0);
     analogWrite(XM_PWM, 0);
+    #ifndef MOTOR_PWM_ANALOGWRITE
+      motor_pwm_init(&x_axis.P_OUT, XP_PWM);  // pins are set up, now cache their duty registers
+      motor_pwm_init(&x_axis.M_OUT, XM_PWM);
+    #endif
     pinMode(X_ENABLE, OUTPUT);
     x_axis.ENABLE = X_ENABLE;
   #endif
@@ -388,6 +982,10 @@ void setup()
   #else
     analogWrite(YP_PWM, 0);
     analogWrite(YM_PWM, 0);
+    #ifndef MOTOR_PWM_ANALOGWRITE
+      motor_pwm_init(&y_axis.P_OUT, YP_PWM);  // pins are set up, now cache their duty registers
+      motor_pwm_init(&y_axis.M_OUT, YM_PWM);
+    #endif
     pinMode(Y_ENABLE, OUTPUT);
     y_axis.ENABLE = Y_ENABLE;
   #endif
@@ -407,6 +1005,10 @@ void setup()
   #else
     analogWrite(ZP_PWM, 0);
     analogWrite(ZM_PWM, 0);
+    #ifndef MOTOR_PWM_ANALOGWRITE
+      motor_pwm_init(&z_axis.P_OUT, ZP_PWM);  // pins are set up, now cache their duty registers
+      motor_pwm_init(&z_axis.M_OUT, ZM_PWM);
+    #endif
     pinMode(Z_ENABLE, OUTPUT);
     z_axis.ENABLE = Z_ENABLE;
   #endif
@@ -416,43 +1018,60 @@ void setup()
 
   motorsDisabled();
 
-    // initialize hard-time MotorPID_Timer for servos (10ms loop)
-  Timer5.attachInterrupt(MotorPID_Timer_handler).setPeriod(10000).start();
+ #ifdef ENCODER_PERIOD_VELOCITY
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;  // DWT cycle counter timestamps the encoder edges
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+ #endif
 
-    // hook up encoders
-  attachInterrupt(digitalPinToInterrupt(Encoder_XA), update_Encoder_XA, CHANGE);
-  attachInterrupt(digitalPinToInterrupt(Encoder_XB), update_Encoder_XB, CHANGE);
-  attachInterrupt(digitalPinToInterrupt(Encoder_YA), update_Encoder_YA, CHANGE);
-  attachInterrupt(digitalPinToInterrupt(Encoder_YB), update_Encoder_YB, CHANGE);
-  attachInterrupt(digitalPinToInterrupt(Encoder_ZA), update_Encoder_ZA, CHANGE);
-  attachInterrupt(digitalPinToInterrupt(Encoder_ZB), update_Encoder_ZB, CHANGE);
+    // hook up encoders (hardware decoders, else pin-change interrupts). Simulated motors count their own.
+  #ifndef MOTOR_SIMULATION
+  #ifdef X_ENCODER_QDEC
+    qdec_init(QDEC_TC(X_ENCODER_QDEC), QDEC_ID(X_ENCODER_QDEC), QDEC_PIO(X_ENCODER_QDEC), QDEC_PINS(X_ENCODER_QDEC));
+  #else
+    encoder_init(&x_encoder, Encoder_XA, Encoder_XB);
+    attachInterrupt(digitalPinToInterrupt(Encoder_XA), update_Encoder_X, CHANGE);
+    attachInterrupt(digitalPinToInterrupt(Encoder_XB), update_Encoder_X, CHANGE);
+  #endif
+  #ifdef Y_ENCODER_QDEC
+    qdec_init(QDEC_TC(Y_ENCODER_QDEC), QDEC_ID(Y_ENCODER_QDEC), QDEC_PIO(Y_ENCODER_QDEC), QDEC_PINS(Y_ENCODER_QDEC));
+  #else
+    encoder_init(&y_encoder, Encoder_YA, Encoder_YB);
+    attachInterrupt(digitalPinToInterrupt(Encoder_YA), update_Encoder_Y, CHANGE);
+    attachInterrupt(digitalPinToInterrupt(Encoder_YB), update_Encoder_Y, CHANGE);
+  #endif
+  #ifdef Z_ENCODER_QDEC
+    qdec_init(QDEC_TC(Z_ENCODER_QDEC), QDEC_ID(Z_ENCODER_QDEC), QDEC_PIO(Z_ENCODER_QDEC), QDEC_PINS(Z_ENCODER_QDEC));
+  #else
+    encoder_init(&z_encoder, Encoder_ZA, Encoder_ZB);
+    attachInterrupt(digitalPinToInterrupt(Encoder_ZA), update_Encoder_Z, CHANGE);
+    attachInterrupt(digitalPinToInterrupt(Encoder_ZB), update_Encoder_Z, CHANGE);
+  #endif
+  #endif
 
   serial_init();   // Setup serial baud rate and interrupts for machine port
 
   settings_init(); // Load Grbl settings from EEPROM
+  pid_rate = settings.pidRate; // the loop runs at this rate until the next power-up
 
-  x_axis.Kp = settings.x_PID_Kp; // get loop values from storage
-  x_axis.Ki = settings.x_PID_Ki;
-  x_axis.Kd = settings.x_PID_Kd;
-  x_axis.Imax = settings.x_PID_Imax;
+  pid_load_gains(&x_axis, settings.x_PID_Kp, settings.x_PID_Ki, settings.x_PID_Kd, settings.x_PID_Imax); // get loop values from storage
+  x_axis.Kvff = settings.x_PID_Kvff;  // feed-forward is per second, not per tick, so not rate scaled
+  x_axis.Kaff = settings.x_PID_Kaff;
   x_axis.axis_Position = 0;
   x_axis.target = 0;
   x_axis.target_PS = 0;
   x_axis.Integral = 0;
 
-  y_axis.Kp = settings.y_PID_Kp; // get loop values from storage
-  y_axis.Ki = settings.y_PID_Ki;
-  y_axis.Kd = settings.y_PID_Kd;
-  y_axis.Imax = settings.y_PID_Imax;
+  pid_load_gains(&y_axis, settings.y_PID_Kp, settings.y_PID_Ki, settings.y_PID_Kd, settings.y_PID_Imax); // get loop values from storage
+  y_axis.Kvff = settings.y_PID_Kvff;
+  y_axis.Kaff = settings.y_PID_Kaff;
   y_axis.axis_Position = 0;
   y_axis.target = 0;
   y_axis.target_PS = 0;
   y_axis.Integral = 0;
 
-  z_axis.Kp = settings.z_PID_Kp; // get loop values from storage
-  z_axis.Ki = settings.z_PID_Ki;
-  z_axis.Kd = settings.z_PID_Kd;
-  z_axis.Imax = settings.z_PID_Imax;
+  pid_load_gains(&z_axis, settings.z_PID_Kp, settings.z_PID_Ki, settings.z_PID_Kd, settings.z_PID_Imax); // get loop values from storage
+  z_axis.Kvff = settings.z_PID_Kvff;
+  z_axis.Kaff = settings.z_PID_Kaff;
   z_axis.axis_Position = 0;
   z_axis.target = 0;
   z_axis.target_PS = 0;
@@ -460,6 +1079,13 @@ void setup()
 
   selected_axis = &x_axis;    // default select axis for diagnostics
 
+  #ifdef CYCLE_PROFILER
+    profile_init();   // cycle counter runs before the first timed handler
+  #endif
+
+    // initialize hard-time MotorPID_Timer for servos ($96 rate, 100Hz default)
+  Timer5.attachInterrupt(MotorPID_Timer_handler).setPeriod(1000000 / pid_rate).start();
+
   stepper_init();  // Configure stepper pins and interrupt timers
   system_init();   // Configure pinout pins and pin-change interrupt
 
@@ -468,6 +1094,10 @@ void setup()
   memset(sys_position,0,sizeof(sys_position)); // Clear machine position.
   sys.abort = true;   // Set abort to complete initialization
 
+  #ifdef INTERRUPT_PRIORITIES
+    interrupt_priorities_init();
+  #endif
+
   interrupts();               // enable all interrupts
 
   #if (DEBUG_COM_PORT != MACHINE_COM_PORT)
@@ -563,10 +1193,12 @@ void loop()
         case 'r':   // reset current position
           settings_restore(0xFF); // Load Grbl settings from EEPROM
 
+          CRITICAL_ENTER();  // not between the PID reads of the position and target
           selected_axis->axis_Position = 0;
           selected_axis->target = 0;
           selected_axis->target_PS = 0;
           selected_axis->Integral = 0;
+          CRITICAL_EXIT();
           stepTestEnable = 0;
           posEnabled = 0;
           break;
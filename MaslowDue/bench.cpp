@@ -0,0 +1,153 @@
+/* This file is part of the Maslow Due Control Software.
+    The Maslow Due Control Software is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Maslow Due Control Software is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with the Maslow Control Software.  If not, see <http://www.gnu.org/licenses/>.
+
+    bench.cpp - $BENCH self-benchmark of the parser, motion control, planner and segment generator.
+    */
+
+#include "grbl.h"
+
+#ifdef PIPELINE_BENCHMARK
+
+// The built-in job, in incremental moves that end where they start. Each part is a run of lines.
+#define BENCH_LONG_LINES 16    // Edges of a 200 x 100mm rectangle.
+#define BENCH_SHORT_LINES 400  // 0.58mm zigzag segments over 200mm, then back in one line.
+#define BENCH_ARCS 8           // Full 30mm radius circles, alternately clockwise.
+#define BENCH_JOB_LINES (1 + BENCH_LONG_LINES + BENCH_SHORT_LINES + 1 + BENCH_ARCS)
+
+uint8_t bench_active = false;
+
+static uint32_t bench_blocks;
+static uint32_t bench_segments;
+static uint32_t bench_drain_us;     // Time spent in bench_drain() so far.
+static uint32_t bench_max_prep_us;  // Longest st_prep_buffer() call refilling one segment.
+
+
+// Returns line 'index' of the built-in job.
+static const char *bench_job_line(uint16_t index)
+{
+  static const char *const rectangle[4] = { "X200", "Y100", "X-200", "Y-100" };
+
+  if (index == 0) { return("G21G91G17G1F1000"); }
+  index--;
+  if (index < BENCH_LONG_LINES) { return(rectangle[index & 3]); }
+  index -= BENCH_LONG_LINES;
+  if (index < BENCH_SHORT_LINES) { return((index & 1) ? "X0.5Y-0.3" : "X0.5Y0.3"); }
+  index -= BENCH_SHORT_LINES;
+  if (index == 0) { return("X-200"); }
+  return((index & 1) ? "G2X0Y0I30J0" : "G3X0Y0I30J0");
+}
+
+
+void bench_drain()
+{
+  uint32_t drain_start = micros();
+  uint8_t stalled = false;
+  while (plan_get_current_block() != NULL) {
+    plan_index_t blocks = plan_get_block_buffer_count();
+    uint8_t popped = st_bench_pop_segment();
+    uint32_t start_us = micros();
+    st_prep_buffer();
+    uint32_t prep_us = micros() - start_us;
+    bench_blocks += blocks - plan_get_block_buffer_count();
+    if (popped) {
+      bench_segments++;
+      bench_max_prep_us = max(bench_max_prep_us, prep_us);
+      stalled = false;
+    } else if (stalled) {
+      break; // Nothing to pop twice over. The segment generator is held.
+    } else {
+      stalled = true; // The segment buffer was empty and this call filled it. Not a refill.
+    }
+  }
+  bench_drain_us += micros() - drain_start;
+}
+
+
+// Prints [BENCH:lines,blocks,segments,ms,lines/s,blocks/s,segments/s,max line us,max prep us].
+static void bench_report(uint16_t lines, uint32_t elapsed_us, uint32_t max_line_us)
+{
+  float seconds = elapsed_us*1.0e-6;
+  if (seconds <= 0.0) { seconds = 1.0e-6; }
+  printPgmString(PSTR("[BENCH:"));
+  print_uint32_base10(lines);
+  serial_write(',');
+  print_uint32_base10(bench_blocks);
+  serial_write(',');
+  print_uint32_base10(bench_segments);
+  serial_write(',');
+  print_uint32_base10(elapsed_us/1000);
+  serial_write(',');
+  printFloat(lines/seconds, 0);
+  serial_write(',');
+  printFloat(bench_blocks/seconds, 0);
+  serial_write(',');
+  printFloat(bench_segments/seconds, 0);
+  serial_write(',');
+  print_uint32_base10(max_line_us);
+  serial_write(',');
+  print_uint32_base10(bench_max_prep_us);
+  printPgmString(PSTR("]\r\n"));
+}
+
+
+uint8_t bench_run()
+{
+  if (sys.state != STATE_IDLE) { return(STATUS_IDLE_ERROR); }
+
+  // The job runs from wherever the machine is, in machine coordinates and without soft limits, as
+  // nothing moves. The parser state is put back afterwards.
+  parser_state_t saved_gc_state;
+  memcpy(&saved_gc_state, &gc_state, sizeof(parser_state_t));
+  uint8_t saved_flags = settings.flags;
+  settings.flags &= ~BITFLAG_SOFT_LIMIT_ENABLE;
+
+  bench_blocks = 0;
+  bench_segments = 0;
+  bench_drain_us = 0;
+  bench_max_prep_us = 0;
+  bench_active = true;
+
+  uint8_t status = STATUS_OK;
+  uint16_t lines;
+  uint32_t max_line_us = 0;
+  char line[LINE_BUFFER_SIZE];
+  uint32_t bench_start = micros();
+  for (lines = 0; lines < BENCH_JOB_LINES; lines++) {
+    strcpy(line, bench_job_line(lines));
+    uint32_t line_start = micros();
+    uint32_t drain_before = bench_drain_us;
+    status = gc_execute_line(line);
+    // Stall of the main loop on this line. Drains stand in for the stepper and are left out.
+    uint32_t line_us = (micros() - line_start) - (bench_drain_us - drain_before);
+    max_line_us = max(max_line_us, line_us);
+    if ((status != STATUS_OK) || sys.abort) { break; }
+  }
+  if ((status == STATUS_OK) && !sys.abort) {
+    protocol_buffer_synchronize(); // Plans and drains what is left.
+    while (st_bench_pop_segment()) { bench_segments++; }
+  }
+  uint32_t elapsed_us = micros() - bench_start;
+
+  bench_active = false;
+  settings.flags = saved_flags;
+  if (sys.abort) { return(STATUS_OK); } // Reset during the run. The main loop resets the rest.
+
+  memcpy(&gc_state, &saved_gc_state, sizeof(parser_state_t));
+  plan_reset();
+  st_reset();
+  plan_sync_position();
+  if (status == STATUS_OK) { bench_report(lines, elapsed_us, max_line_us); }
+  return(status);
+}
+
+#endif
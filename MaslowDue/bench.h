@@ -0,0 +1,35 @@
+/* This file is part of the Maslow Due Control Software.
+    The Maslow Due Control Software is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Maslow Due Control Software is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with the Maslow Control Software.  If not, see <http://www.gnu.org/licenses/>.
+
+    bench.h - $BENCH self-benchmark of the parser, motion control, planner and segment generator.
+    Enabled by PIPELINE_BENCHMARK in config.h.
+    */
+
+#ifndef bench_h
+#define bench_h
+
+#include "grbl.h"
+
+#ifdef PIPELINE_BENCHMARK
+  // Set while $BENCH runs. A full planner buffer is then drained by bench_drain() instead of
+  // starting a cycle.
+  extern uint8_t bench_active;
+
+  // Runs the built-in job through the pipeline with the motors held. Returns a status code.
+  uint8_t bench_run();
+
+  // Prepares the planned blocks into segments and drops each segment as the stepper would run it.
+  void bench_drain();
+#endif
+
+#endif
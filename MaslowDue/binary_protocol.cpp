@@ -0,0 +1,106 @@
+/* This file is part of the Maslow Due Control Software.
+    The Maslow Due Control Software is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Maslow Due Control Software is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with the Maslow Control Software.  If not, see <http://www.gnu.org/licenses/>.
+
+    binary_protocol.cpp - framed binary linear moves, streamed in place of G0/G1 text lines.
+    */
+
+#include "grbl.h"
+
+#ifdef BINARY_MOTION_PROTOCOL
+
+volatile uint8_t binary_protocol_active = false;
+
+static uint8_t frame[BINARY_FRAME_MAX];
+static uint8_t frame_count;  // Bytes of the frame received so far.
+static uint8_t frame_length; // Whole frame length, known once the flags byte has arrived.
+
+
+void binary_protocol_enter()
+{
+  frame_count = 0;
+  binary_protocol_active = true;
+}
+
+
+void binary_protocol_exit()
+{
+  binary_protocol_active = false;
+  frame_count = 0;
+}
+
+
+static uint16_t binary_crc16(const uint8_t *data, uint8_t length)
+{
+  uint16_t crc = 0xFFFF;
+  while (length--) {
+    crc ^= (uint16_t)(*data++) << 8;
+    for (uint8_t i = 0; i < 8; i++) {
+      if (crc & 0x8000) { crc = (crc << 1) ^ 0x1021; }
+      else { crc <<= 1; }
+    }
+  }
+  return(crc);
+}
+
+
+// Checks a move frame as the parser checks the words of a text line and executes it like the
+// same G0/G1 line in G90, with the modal state and parser position updated to match.
+static uint8_t binary_execute_move(uint8_t flags, const uint8_t *field)
+{
+  float value[6];
+  for (uint8_t idx = 0; idx < 6; idx++) {
+    if (flags & bit(idx)) { memcpy(&value[idx], field, 4); field += 4; }
+  }
+  int32_t n = 0; // If no line number is present, the value is zero.
+  if (flags & BINARY_FLAG_N) { memcpy(&n, &value[5], 4); }
+
+  // The text parser cannot produce inf or nan, so neither may reach the motion from here.
+  for (uint8_t idx = 0; idx < 5; idx++) {
+    if ((flags & bit(idx)) && !isfinite(value[idx])) { return(STATUS_BAD_NUMBER_FORMAT); }
+  }
+  if ((flags & BINARY_FLAG_F) && !(value[3] >= 0.0f)) { return(STATUS_NEGATIVE_VALUE); }
+  if ((flags & BINARY_FLAG_S) && !(value[4] >= 0.0f)) { return(STATUS_NEGATIVE_VALUE); }
+  if (n < 0) { return(STATUS_NEGATIVE_VALUE); }
+  if (n > MAX_LINE_NUMBER) { return(STATUS_GCODE_INVALID_LINE_NUMBER); }
+
+  // The X, Y, Z, F and S flags and fields are in gc_execute_motion_words() word order.
+  uint8_t motion = (flags & BINARY_FLAG_RAPID) ? MOTION_MODE_SEEK : MOTION_MODE_LINEAR;
+  return(gc_execute_motion_words(motion, DISTANCE_MODE_ABSOLUTE, flags & (GC_MOTION_WORD_AXES|GC_MOTION_WORD_F|GC_MOTION_WORD_S), value, n));
+}
+
+
+uint8_t binary_protocol_read(uint8_t data)
+{
+  if (frame_count == 0) {
+    if (data != BINARY_FRAME_START) { return(BINARY_FRAME_PENDING); } // Ignore bytes between frames.
+  } else if (frame_count == 1) {
+    frame_length = binary_frame_length(data);
+  }
+  frame[frame_count++] = data;
+  if ((frame_count < 2) || (frame_count < frame_length)) { return(BINARY_FRAME_PENDING); }
+  frame_count = 0; // Frame complete. Ready for the next.
+
+  uint16_t crc = frame[frame_length-2] | ((uint16_t)frame[frame_length-1] << 8);
+  if (binary_crc16(&frame[1], frame_length-3) != crc) { return(STATUS_BINARY_FRAME_ERROR); }
+
+  uint8_t flags = frame[1];
+  if (flags & BINARY_FLAG_END) {
+    binary_protocol_exit();
+    return(STATUS_OK);
+  }
+  // Everything else is a motion. Block if in alarm or jog mode, as for g-code lines.
+  if (sys.state & (STATE_ALARM | STATE_JOG)) { return(STATUS_SYSTEM_GC_LOCK); }
+  return(binary_execute_move(flags, &frame[2]));
+}
+
+#endif
@@ -0,0 +1,59 @@
+/* This file is part of the Maslow Due Control Software.
+    The Maslow Due Control Software is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Maslow Due Control Software is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with the Maslow Control Software.  If not, see <http://www.gnu.org/licenses/>.
+
+    binary_protocol.h - framed binary linear moves, streamed in place of G0/G1 text lines.
+    Enabled by BINARY_MOTION_PROTOCOL in config.h.
+    */
+
+#ifndef binary_protocol_h
+#define binary_protocol_h
+
+#include "grbl.h"
+
+// Frame layout, multi-byte values little-endian:
+//   BINARY_FRAME_START, flags, one 4-byte field per flag bit 0-5 in bit order, CRC-16 (2 bytes)
+// The CRC is CRC-16/CCITT-FALSE (polynomial 0x1021, initial 0xFFFF) over the flags and fields.
+#define BINARY_FRAME_START  0x02 // ASCII STX. Never sent by a text stream.
+
+#define BINARY_FLAG_X       bit(0) // float, work coordinates in the G20/G21 units
+#define BINARY_FLAG_Y       bit(1) // float
+#define BINARY_FLAG_Z       bit(2) // float
+#define BINARY_FLAG_F       bit(3) // float, feed rate as the F word
+#define BINARY_FLAG_S       bit(4) // float, spindle speed as the S word
+#define BINARY_FLAG_N       bit(5) // int32, line number
+#define BINARY_FLAG_RAPID   bit(6) // Moves as G0 when set, else as G1.
+#define BINARY_FLAG_END     bit(7) // Leaves binary mode. Any fields are ignored.
+#define BINARY_FIELD_MASK   0x3F
+
+#define BINARY_FRAME_MAX    28     // Start, flags, six fields and the CRC.
+#define BINARY_FRAME_PENDING 0xFF  // binary_protocol_read() frame not yet complete.
+
+// Whole frame length in bytes, as given by its flags byte. Used by the serial scanner to pass
+// frame data through without picking off realtime command characters.
+#define binary_frame_length(flags) (4 + 4*( (((flags)>>0)&1) + (((flags)>>1)&1) + (((flags)>>2)&1) + \
+                                            (((flags)>>3)&1) + (((flags)>>4)&1) + (((flags)>>5)&1) ))
+
+// Set while the main loop reads frames instead of text lines.
+extern volatile uint8_t binary_protocol_active;
+
+// Enters binary mode. The host must wait for the 'ok' to the $B line before sending frames.
+void binary_protocol_enter();
+
+// Leaves binary mode and drops any partial frame. Called on leaving and on reset.
+void binary_protocol_exit();
+
+// Adds one received byte to the frame being read. Executes a completed frame and returns its
+// status code for the 'ok' or 'error:' response, otherwise returns BINARY_FRAME_PENDING.
+uint8_t binary_protocol_read(uint8_t data);
+
+#endif
@@ -56,11 +56,20 @@
 
 // Serial port and baud rate
 #ifdef MASLOWCNC
+  // Stream over the Due native USB port (SerialUSB) instead of the programming port. The USB CDC
+  // link is not paced by BAUD_RATE, and the receive buffer defaults much deeper in this mode (see
+  // serial.h), so a character-counting sender can keep several hundred short lines in flight.
+  // NOTE: Status report Bf: field and the $I build info report the actual receive buffer size.
+  // #define USE_NATIVE_USB_PORT // Default disabled. Uncomment to enable.
+
   #define BAUD_RATE 38400
-  #define DEBUG_COM_PORT  Serial
-  #define MACHINE_COM_PORT  Serial
-  // #define DEBUG_COM_PORT  SerialUSB
-  // #define MACHINE_COM_PORT  SerialUSB
+  #ifdef USE_NATIVE_USB_PORT
+    #define DEBUG_COM_PORT  SerialUSB
+    #define MACHINE_COM_PORT  SerialUSB
+  #else
+    #define DEBUG_COM_PORT  Serial
+    #define MACHINE_COM_PORT  Serial
+  #endif
 #else
   // #define BAUD_RATE 230400
   #define BAUD_RATE 115200
@@ -465,7 +474,8 @@
 // increase the receive buffer if a deeper receive buffer is needed for streaming and avaiable
 // memory allows. The send buffer primarily handles messages in Grbl. Only increase if large
 // messages are sent and Grbl begins to stall, waiting to send the rest of the message.
-// NOTE: Buffer size values must be greater than zero and less than 256.
+// NOTE: Buffer size values must be greater than zero and less than 256. Maslow-Due uses 16-bit
+// ring indices, so values up to 65535 are allowed there and multi-KB buffers fit easily in SRAM.
 // #define RX_BUFFER_SIZE 255 // Uncomment to override defaults in serial.h
 // #define TX_BUFFER_SIZE 255
 
@@ -645,6 +655,319 @@
 #define RPM_LINE_A4  1.203413e-01  // Used N_PIECES = 4. A and B constants of line 4.
 #define RPM_LINE_B4  1.151360e+03
 
+// ---------------------------------------------------------------------------------------
+// Maslow-Due specific options. Ignored unless MASLOWCNC is defined in grbl.h.
+
+// Runs the chain-sag inverse kinematics (triangularInverse in system.c) in single precision
+// instead of double. The Cortex-M3 in the Due has no FPU, so every operation is software
+// emulated and float is roughly twice as fast as double. Over the full default 8'x4' work area,
+// for both chain-over and chain-under sprocket setups, the chain lengths agree with the
+// double-precision solution to within 0.001mm, or about 1/8 of an encoder step. Chain lengths
+// through the forward kinematics come back to within 0.023mm of the target in either precision.
+#define KINEMATICS_SINGLE_PRECISION // Default enabled. Comment to disable.
+
+// Bounds the time planner_recalculate() may spend per new block, in microseconds. With a deep block
+// buffer, every streamed block can re-plan a long chain of deceleration ramps in software floating
+// point and starve the step segment generator during dense short segments. When the budget runs
+// out, the older blocks keep their previous plan, which is slower but always able to stop, and
+// the pass is resumed while mc_line() waits on a full buffer or the stream goes idle. $I reports
+// [PLANRC:budget,passes cut short,passes resumed]. Comment to always plan the whole chain.
+#define PLANNER_RECALC_BUDGET_US 250 // Default enabled. Comment to disable.
+
+// Selects a fixed-point step segment generator for st_prep_buffer(). The float path runs the velocity
+// ramp integration, several ceil() calls and a division for every segment, all in software floating
+// point on the FPU-less SAM3X. The fixed-point path does the same ramp sequence in 1/4096 step and
+// 2^-20 sec units with integer math, and only converts back to float once per segment for the
+// planner and status reports. Block setup, like the sqrt() of the entry and exit speeds, stays in
+// float as it is done once per block. Block step counts are identical to the float path and step
+// rates agree to about the 1us resolution of the step timer, apart from the final step into a full
+// stop, which is timed from the ramp rather than from a near-zero speed.
+// NOTE: Worth enabling with shorter segments, i.e. ACCELERATION_TICKS_PER_SECOND above 100.
+// #define STEP_PREP_FIXED_POINT // Default disabled. Uncomment to enable.
+
+// Replaces the per-step Timer4 interrupt with a fixed rate position interpolator. On the Maslow, a
+// step only moves a PID target by one encoder count, yet costs a timer stop, reload and restart plus
+// the Bresenham tracing. With this enabled, Timer4 ticks every STREAM_INTERPOLATION_US and writes the
+// executing segment's chain position straight into the PID targets, with 7 fractional bits kept in
+// target_PS like the TUNING_MODE step test. The interrupt load no longer grows with the step rate.
+// NOTE: The interpolation period should stay well under the 10ms PID loop period.
+// #define STEP_STREAMING_INTERPOLATOR // Default disabled. Uncomment to enable.
+#define STREAM_INTERPOLATION_US 1000 // Interpolator period in microseconds (1kHz).
+
+// Ramps the laser power through each step segment in laser mode ($32=1 with M4), instead of setting
+// it once as the segment loads. The power starts at the segment's entry speed and moves toward its
+// exit speed with every step event, or every STREAM_INTERPOLATION_US tick with the streaming
+// interpolator, so it follows the commanded speed through accelerations and corners rather than
+// stepping at segment boundaries. With the spindle on a hardware PWM channel, each update is one
+// duty register write. Other motions keep a constant power per segment as before.
+#define LASER_DYNAMIC_POWER // Default enabled. Comment to disable.
+
+// Instrumentation build. Times the PID, step, encoder and serial interrupt handlers and the main
+// loop stages st_prep_buffer(), plan_buffer_line(), positionToChain(), chainToPosition() and
+// gc_execute_line() with the Cortex-M3 DWT cycle counter (84 per microsecond). $L prints one
+// [PRF:name,calls,min,mean,p99,max,load%] line per entry, times in cycles, and $LR clears them.
+// Load is the share of all CPU time spent in the entry since the last clear. A handler's time
+// includes the interrupts that preempt it, i.e. encoder edges during the PID loop. PIDL, STPL and
+// SERL are the latencies of the PID, step and serial timer handlers, from their timer compare to
+// entry, and CRIT the time interrupts are disabled by critical sections, which bounds the latency
+// of the encoder edges. Their load has no meaning.
+// NOTE: Adds about 40 cycles to every timed call and 7KB of RAM. Clear at least every hour, as
+// the load measurement uses the 32-bit micros() count.
+// #define CYCLE_PROFILER // Default disabled. Uncomment to enable.
+
+// Counts where streaming throughput is lost and adds them to the status report as
+// |Sv:segment underruns,planner empty,rx empty,planner wait ms| when $10 includes the value 4.
+// - Segment underruns: the step interrupt ran out of prepped segments with planner blocks left.
+// - Planner empty: st_prep_buffer() found no block to prep during a cycle or jog. Ends of jobs and
+//   of motions before a buffer sync, i.e. tool changes and dwells, are counted as well.
+// - RX empty: the serial buffer ran dry during a cycle while the planner had room.
+// - Planner wait: total time mc_line() waited for room in a full planner, or a full parse-ahead
+//   queue with PLAN_SEGMENT_QUEUE_SIZE, in milliseconds.
+// The counters run from power-up, so senders should watch their change over a job.
+#define REPORT_FIELD_STARVATION // Default enabled. Comment to disable.
+
+// Keeps a RAM ring buffer of the PID loop state for tuning and chasing following errors in normal
+// builds. While armed, every PID tick records the target, encoder position, following error and
+// signed PWM output of each axis. $TA arms a continuous capture that freezes on an alarm, so the
+// buffer holds the last ticks leading up to it. $TT freezes an armed capture, or records the next
+// PID_TELEMETRY_SAMPLES ticks when not armed. $T reports [TLM:state,samples,rate] and $TD dumps the
+// samples as CSV lines, oldest first. Costs 48 bytes of RAM per sample and a flag test per tick when
+// not capturing. At the default 100Hz servo rate, 256 samples cover the last 2.56 seconds.
+#define PID_TELEMETRY_SAMPLES 256 // Default enabled. Comment to disable.
+
+// Enables the $PT automatic PID tuning cycle, which replaces the TUNING_MODE build for finding the
+// position loop gains. $PTX, $PTY or $PTZ tunes one axis and $PT tunes all three in turn, with the
+// machine idle or in alarm. The axis is held at its position by a relay that drives the motor at
+// +/-PID_AUTOTUNE_PWM, switching as the following error crosses +/-PID_AUTOTUNE_HYSTERESIS counts.
+// From the period and amplitude of the resulting oscillation, the Ziegler-Nichols no-overshoot rule
+// gives Kp, Ki and Kd, and Imax caps the integral term at the relay drive. The gains are reported as
+// [PT:axis,period sec,amplitude counts,Kp,Ki,Kd,Imax], stored in $40-$43, $50-$53 or $60-$63 for
+// the 100Hz reference rate, and loaded for the current servo rate.
+// NOTE: The motor moves back and forth by a few encoder counts. Runs longer than
+// PID_AUTOTUNE_TIMEOUT seconds, or errors past PID_AUTOTUNE_MAX_ERROR counts, fail with error 18.
+#define PID_AUTOTUNE // Default enabled. Comment to disable.
+#define PID_AUTOTUNE_PWM 100          // Relay drive level, of 255.
+#define PID_AUTOTUNE_HYSTERESIS 2     // Relay switching band, encoder counts.
+#define PID_AUTOTUNE_SETTLE_CYCLES 2  // Relay cycles ignored while the oscillation builds up.
+#define PID_AUTOTUNE_CYCLES 4         // Relay cycles averaged.
+#define PID_AUTOTUNE_TIMEOUT 10       // Seconds.
+#define PID_AUTOTUNE_MAX_ERROR 1000   // Encoder counts.
+
+// Adds a framed binary mode for streaming linear moves without the text g-code parser. After $B is
+// answered with 'ok', each frame carries the words of one G0 or G1 line, i.e. X Y Z F S N, as
+// 4-byte values, and is answered with 'ok' or 'error:' like a line, or error 19 for a bad CRC.
+// An XY move takes 12 bytes, against about 20 for the same G1 line in text. The moves are
+// executed with the parser's modal state, so units, G93/G94, work offsets, spindle and coolant still
+// apply, and soft limits and check mode work as before. A frame with the end flag returns to text
+// lines, as does a reset. Realtime commands still work between frames. See binary_protocol.h.
+#define BINARY_MOTION_PROTOCOL // Default enabled. Comment to disable.
+
+// Runs lines of only X, Y, Z, F, S and N words under an active G0 or G1, the bulk of any CAM job,
+// through a short path to mc_line() that skips the full modal group and word checks of the parser.
+// The modal state is applied as before. Any line the short path does not take cleanly, including
+// every line with an error, goes through the full parser, so responses are unchanged.
+#define GCODE_MODAL_FAST_PATH // Default enabled. Comment to disable.
+
+// Size of a parse-ahead queue of segments between mc_line() and the planner buffer. Without it,
+// mc_line() waits for every segment of a line to fit into a full planner, so no further lines are
+// parsed, segmented or run through the chain kinematics until motion frees a block. With it, the
+// segments and their chain lengths go into the queue, and lines keep being parsed until the queue
+// is full too. Queued segments are planned as soon as blocks free up, with their chain lengths
+// reused instead of recomputed by the planner. Costs 36 bytes of RAM per segment.
+#define PLAN_SEGMENT_QUEUE_SIZE 64 // Default enabled. Comment to disable.
+
+// Caches the forward kinematics solution of the machine position, keyed on the chain step counts.
+// A status report of a machine that has not moved returns the cached position without solving.
+// With new counts, the solve is seeded by a linear step from the cached solution, so it settles in
+// one or two inverse solves, instead of the 2-4 a seed from the last solved position takes.
+#define REPORT_MPOS_CACHE // Default enabled. Comment to disable.
+
+// Low-latency status reports. In a cycle or jog, the X-Y machine position is reported as the
+// planned end point of the executing block, without any kinematics. The reported position leads
+// the sled by up to one segment, as set by the segment tolerance setting. Z and the reports at
+// rest are unchanged. Costs 8 bytes of RAM per planner block.
+// #define REPORT_MPOS_PLANNER_TARGET // Default disabled. Uncomment to enable.
+
+// Stores the resting machine position, kept in EEPROM on every cycle stop, in a RAM shadow of the
+// EEPROM block instead of writing it out byte by byte with a 5ms write cycle each. Only the bytes
+// that changed are marked, and the main loop writes them back in page writes of up to
+// EEPROM_WRITE_BEHIND_BYTES, without waiting for the write cycles. A stop normally changes a few
+// dozen bytes, which are written out within a few tens of ms, while the protocol loop keeps running.
+#define EEPROM_WRITE_BEHIND // Default enabled. Comment to disable.
+#define EEPROM_WRITE_BEHIND_BYTES 16 // Bytes per page write (1-64). Each takes about 1.5ms bit-banged,
+                                     // or none with EEPROM_HARDWARE_TWI in MaslowDue.h, which can take 64.
+
+// Keeps a copy of the last good settings record ($$) in the top pages of the SAM3X internal flash.
+// At boot, a copy with a matching version, size and checksum is loaded instead of reading the
+// settings from the external EEPROM. Every settings write updates both, and a boot that has to read
+// the EEPROM, i.e. the first after a firmware upload, which erases the flash, makes a new copy.
+// NOTE: Settings changed in the EEPROM by other means, like the EEPROM viewer or swapping shields,
+// are overridden by the copy. Upload the firmware again, or restore with $RST, to resync them.
+// #define SETTINGS_FLASH_SNAPSHOT // Default disabled. Uncomment to enable.
+
+// Stores g-code job files on an SD card and runs them without the host, through the Arduino SD
+// library. The card connects to the SPI header, with its chip select on SD_CS_PIN in MaslowDue.h.
+// $FL lists the files as [FILE:name,size]. $FW=name starts an upload: every following line is
+// acknowledged and written to the file, after the usual filtering of spaces and comments, until
+// $FC closes it. $FR=name runs a file in IDLE, and $FD=name deletes one. A job is read in blocks
+// of SD_JOB_BLOCK_SIZE and its lines go through the same parser as serial lines, without 'ok'
+// responses. Meanwhile, only realtime commands are taken from the host, and the status report
+// adds the share of the file read as |SD:percent|. [JOB:END,name,lines] reports the end of the
+// file. An error line is reported and halts the job with [JOB:HALT,name,lines]. Reset ends a job.
+// #define SD_JOB_STORAGE // Default disabled. Uncomment to enable.
+
+// Splits G2/G3 arcs directly into the straight chain-space segments the planner moves, in one pass,
+// instead of into arc_tolerance chords that mc_line() then splits again for the chain bow. Each
+// segment is sized so the path the chains actually take stays within $12 arc tolerance plus the
+// segment tolerance setting of the programmed arc, giving fewer planner blocks and kinematics
+// solutions for the same contour. ARC_CHAIN_MAX_ANGLE bounds the segment angle, to keep the small
+// angle approximation between N_ARC_CORRECTION corrections accurate.
+#define ARC_CHAIN_SEGMENTATION // Default enabled. Comment to disable.
+#define ARC_CHAIN_MAX_ANGLE 0.2 // Float (radians)
+
+// Jerk-limited (S-curve) acceleration in the step segment generator, set by $99 in mm/sec^3. The
+// planned profile is smoothed by a moving average over a window of twice the largest axis
+// acceleration over the jerk, across blocks, so the acceleration rises and falls at no more than
+// the jerk setting instead of stepping where it sets the chains bouncing, and never exceeds the
+// acceleration settings. The motion comes to rest the window later than planned, the planner slows
+// junctions by half the window's speed change to keep cornering speeds, and a feed hold starts to
+// slow about half a window later. S_CURVE_MAX_WINDOW caps the window and with it the segment
+// buffer, so jerk settings below 2*acceleration/S_CURVE_MAX_WINDOW act as that value. The stepper
+// ISR is handed as many segments as without the S-curve, so feed holds, jog cancels and overrides
+// take effect as late as before plus the window. $99=0 (the default) leaves the trapezoid profile
+// with the same segment buffer latency.
+// NOTE: Not available with STEP_PREP_FIXED_POINT, which has no smoothing. Enabled, it costs the float
+// path's prep time per segment, plus the window integration with $99 set, and 28 bytes of RAM per
+// segment buffer entry. Disable it to use the fixed-point segment generator.
+#define S_CURVE_ACCELERATION // Default enabled. Comment to disable.
+#define S_CURVE_MAX_WINDOW 0.2 // Float (sec)
+
+// Plans blocks along the x-y-z path of the sled instead of the chain moves. Block lengths, feed rates,
+// inverse time and junction deviation corners are then in work space mm, as programmed, where they
+// were in chain mm, which differ across the sheet. The axis max rate and acceleration settings still
+// limit each motor, through the chain mm per path mm of the block, and the centripetal acceleration
+// of a corner is limited on the chains the same way. Corners the chains can take at speed no longer
+// slow the sled, and the feed rate no longer changes with where the sled is on the sheet.
+#define CARTESIAN_PLANNING // Default enabled. Comment to disable.
+
+// With CARTESIAN_PLANNING, limits each block on the chain rates of the local kinematic Jacobian at
+// both of its ends, where higher than the average over the block, and maps corner accelerations onto
+// the chains through the Jacobian at the junction. The feed and acceleration a block may use then
+// follow where it is on the sheet: blocks near the top corners, where a chain moves fastest for the
+// sled, are held to what the motors can do, and the center of the sheet runs at the programmed feed.
+#define JACOBIAN_FEED_LIMITS // Default enabled. Comment to disable.
+
+// Replaces the sag, sprocket wrap and stretch solve of the inverse kinematics with a lookup. At
+// power-up and on every settings write, triangularInverse() is solved over a grid of the machine
+// width and height, and the difference to the straight motor-to-sled distances is kept in RAM.
+// Each target then costs the two straight distances and a bilinear interpolation of the grid,
+// instead of trig, sinh and the tension solve. The forward solution uses the same lookup, so
+// reported positions match the planned chains. $I reports [KINGRID:columns,rows,error bound mm].
+// Targets off the grid are solved in full, and the outermost cell blends the lookup into the full
+// solve. The grid is built a few nodes at a time by the main loop scheduler and only taken into use
+// once the machine is stopped with an empty planner. The grid takes (COLS+1)*(ROWS+1)*8 bytes of RAM.
+// NOTE: The lookup is off the full solve by up to the reported bound, about 0.08 mm of chain with the
+// default grid and geometry. Only worth it where the inverse solve time limits the feed rate.
+// #define KINEMATICS_CORRECTION_GRID // Default disabled. Uncomment to enable.
+#define KINEMATICS_GRID_COLS 64 // Grid cells across the machine width (1-254).
+#define KINEMATICS_GRID_ROWS 32 // Grid cells across the machine height (1-254).
+
+// Adds the $K kinematics benchmark. It times triangularInverse(), positionToChain() and
+// chainToPosition() at each point of a sweep of the work area and prints [KBM:name,calls,min,mean,max]
+// in microseconds for each, then checks each positionToChain() result back through chainToPosition()
+// and prints [KRT:max error,mean error,max chain error,max forward solves], errors in mm. The chain
+// error is positionToChain() against the full inverse solve. Use it to compare builds and settings
+// for speed and accuracy on the machine itself. The planner and parser are timed by CYCLE_PROFILER.
+// #define KINEMATICS_BENCHMARK // Default disabled. Uncomment to enable.
+#define KINEMATICS_BENCHMARK_COLS 32 // Sweep intervals across the machine width.
+#define KINEMATICS_BENCHMARK_ROWS 16 // Sweep intervals across the machine height.
+
+// Runs the machine with the motors held and a model of each motor and encoder in the PID loop, for
+// measuring whole jobs from the host before they are cut. The drivers are never enabled and the
+// encoder inputs are ignored. Each tick, the PWM level compute_PID() outputs turns the model, which
+// counts the encoder position the next tick sees: a first order speed response, settling at
+// MOTOR_SIM_MAX_SPEED at full PWM with MOTOR_SIM_TIME_CONSTANT, and no motion up to MOTOR_SIM_DEADBAND.
+// Everything else runs as on a machine, at the real loop rates. $M reports the run since power-up or
+// the last $MR: [SIM:cycle time s,blocks,path mm,achieved feed,programmed feed] with feeds in mm/min,
+// and [SFE:axis,max,mean] following errors in mm. Planner and segment starvation are counted by
+// REPORT_FIELD_STARVATION. NOTE: Limit switches are not modeled. Do not use homing.
+// #define MOTOR_SIMULATION // Default disabled. Uncomment to enable.
+#define MOTOR_SIM_MAX_SPEED_XY 3500  // Encoder counts/sec at full PWM. Kit motor, about 26 rpm.
+#define MOTOR_SIM_MAX_SPEED_Z 6000   // Encoder counts/sec at full PWM.
+#define MOTOR_SIM_TIME_CONSTANT 30   // Milliseconds.
+#define MOTOR_SIM_DEADBAND 10        // PWM levels, of 255, overcome by friction.
+
+// Adds the $BENCH command, which runs a built-in job of long lines, dense short segments and full
+// circles through gc_execute_line(), mc_line(), the planner and st_prep_buffer() as fast as they
+// go, with the motors held. Segments are dropped as soon as prepped, one per refill, in place of
+// the stepper. The job starts from the current position in incremental moves and ends there, with
+// soft limits off. Then the machine is synced back to where it was and $BENCH prints
+// [BENCH:lines,blocks,segments,ms,lines/s,blocks/s,segments/s,max line us,max prep us]. The max line
+// time is the longest the main loop spent on one line outside the drains, the max prep time the
+// longest segment refill. Compare builds and settings, and the blocks/s a job's feed rate needs.
+// #define PIPELINE_BENCHMARK // Default disabled. Uncomment to enable.
+
+// Adds velocity mode jogging for pendants and hosts that jog while a key is held. $JV=X1Y-1F500
+// jogs in the direction of the X, Y and Z words at the F rate in mm/min, until the next $JV= changes
+// it. $JV= with no axis words or F0 stops it, as does a gap of more than JOG_VELOCITY_TIMEOUT ms
+// between commands, so the host repeats the command while the key is held. The jog is planned in
+// machine coordinates as straight blocks, kept only JOG_VELOCITY_BLOCKS ahead, instead of a $J=
+// target segmented into the planner buffer. Each block is long enough that those few cover the
+// distance needed to stop from the rate, and is at least JOG_VELOCITY_PERIOD ms of travel. The sled
+// starts as soon as the command is received, and stops within one block of travel plus its braking
+// distance. The jog cancel realtime command stops it too.
+#define JOG_VELOCITY_MODE // Default enabled. Comment to disable.
+#define JOG_VELOCITY_BLOCKS 8      // Planned blocks kept ahead of the sled (3-BLOCK_BUFFER_SIZE).
+#define JOG_VELOCITY_PERIOD 20     // Shortest block, ms of travel at the jog rate.
+#define JOG_VELOCITY_TIMEOUT 250   // Longest gap between $JV= commands, ms.
+
+// Estimates each encoder's speed from the time between its edges (1/T) rather than the counts per
+// PID tick, and uses it for the PID differential term in place of the position change of the tick.
+// At slow feeds the count per tick is mostly 0 or 1, so the differential term is then mostly
+// quantization noise, and the estimate is smooth down to a fraction of a count per tick. The
+// software decoders timestamp each counted edge with the DWT cycle counter. Encoders counted by a
+// TC QDEC are not timestamped and keep the count per tick. Kd keeps its scale, but the change in
+// noise usually allows more of it: retune after enabling. PID telemetry adds the velocity of each
+// axis, in 1/256 counts per tick, after its PWM, for 60 bytes per sample.
+// #define ENCODER_PERIOD_VELOCITY // Default disabled. Uncomment to enable.
+
+// Sets the NVIC priority of each interrupt (IRQ_PRIORITY_xxx in MaslowDue.h), from highest: the pin
+// interrupts of the encoders, probe, limits and driver faults, the step interpolator, the PID loop,
+// the serial port and scanner, then the idle timeout. Otherwise all run at the same priority and
+// none preempts another, so an encoder edge waits for the whole PID or step handler. A handler only
+// shares single word values with those it preempts, as the targets, encoder counts and each
+// sys_position axis. State of several words is copied in CRITICAL_ENTER() sections. CYCLE_PROFILER
+// measures the resulting latencies.
+// NOTE: Not yet checked on hardware. Disabled until the latencies are measured on a running machine.
+// #define INTERRUPT_PRIORITIES // Default disabled. Uncomment to enable.
+
+// Raises alarm 10 when a TLE5206 driver pulls its error flag (X/Y/Z_FAULT) low, on over temperature,
+// a short or under voltage while the motors are enabled. The flags are on edge interrupts, which
+// brake the motors at once and latch the measured position, as do the hard limit pins with $21.
+// Both alarms then report it as [FLT:x,y,z:axes] and hold everything until reset, as a hard limit.
+// Only the TLE5206 shield has the fault lines. Other shields build without it.
+// NOTE: Not yet checked on hardware. Disabled until the fault lines are verified on a TLE5206 shield.
+// #define DRIVER_FAULT_ALARM // Default disabled. Uncomment to enable.
+
+// Time the main loop scheduler (scheduler.cpp) gives its background tasks per pass: status auto
+// reports, the EEPROM write-back and the kinematics correction grid build. The segment buffer is
+// refilled before and after every task, and a task that would overrun the slice waits for the next
+// pass, so this bounds how long the segment buffer goes without a refill to about one task
+// increment. Keep it well below the time the segment buffer holds at the fastest feed.
+#define SCHEDULER_SLICE_US 2000  // Microseconds.
+
+// Times each background task of the main loop scheduler. $Q reports the runs, deferrals and times
+// of each task as [TSK:name,runs,deferred,mean,max,load%], times in microseconds, and $QR clears them.
+// NOTE: Adds two micros() calls to every task run.
+// #define SCHEDULER_STATS // Default disabled. Uncomment to enable.
+
+// Keeps the last few positionToChain() solutions and returns the cached chain lengths for a target
+// at exactly the same x and y. Z-only plunges and retracts, and the repeated XY of pecks and ramps,
+// then skip the inverse solve: the lookup tries the newest entry first, so a Z-only block costs two
+// compares. Cleared on every settings write and once the correction grid is built, so results
+// always match the current geometry. $I reports [KINCACHE:entries,hits,misses]. 16 bytes per entry.
+#define KINEMATICS_TARGET_CACHE 4 // Default enabled. Comment to disable.
+
 
 /* ---------------------------------------------------------------------------------------
    OEM Single File Configuration Option
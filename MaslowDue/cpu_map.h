@@ -320,7 +320,10 @@
   #define Y_LIMIT_BIT      9  // Due pin 41 - C.9
   #define Z_LIMIT_BIT     13  // Due pin 50 - C.13
 
-  #define MAX_SEG_LENGTH_MM 2.0 /* long lines must be segmented due to circular motion */
+  // long lines must be segmented due to circular motion. mc_line() sizes each segment from the
+  // segment tolerance setting, bounded by these lengths.
+  #define MIN_SEG_LENGTH_MM 0.5
+  #define MAX_SEG_LENGTH_MM 100.0
 
   //  
   //// Define probe switch input pin.
@@ -73,36 +73,49 @@
 
   // PID position loop factors              X: Kp = 25000 Ki = 15000 Kd = 22000 Imax = 5000
   // 14.000 fixed point arithmatic S13.10
+  // Feed-forward, off by default: Kvff in 1/1024 PWM per count/sec, Kaff in 1/1024 PWM per 100 counts/sec^2
   #ifdef DRIVER_TLE5206
     #define default_xKp     (10.000*1024)
     #define default_xKi     (21.000*1024)
     #define default_xImax   (5000)
     #define default_xKd     (18.000*1024)
+    #define default_xKvff   (0)
+    #define default_xKaff   (0)
 
     #define default_yKp     (10.000*1024)
     #define default_yKi     (21.000*1024)
     #define default_yImax   (5000)
     #define default_yKd     (18.000*1024)
+    #define default_yKvff   (0)
+    #define default_yKaff   (0)
 
     #define default_zKp     (10.000*1024)
     #define default_zKi     (21.000*1024)
     #define default_zImax   (5000)
     #define default_zKd     (17.000*1024)
+    #define default_zKvff   (0)
+    #define default_zKaff   (0)
   #else
     #define default_xKp     (22.000*1024)
     #define default_xKi     (17.000*1024)
     #define default_xImax   (5000)
     #define default_xKd     (20.000*1024)
+    #define default_xKvff   (0)
+    #define default_xKaff   (0)
 
     #define default_yKp     (22.000*1024)
     #define default_yKi     (17.000*1024)
     #define default_yImax   (5000)
     #define default_yKd     (20.000*1024)
+    #define default_yKvff   (0)
+    #define default_yKaff   (0)
 
     #define default_zKp     (20.000*1024)
     #define default_zKi     (17.000*1024)
     #define default_zImax   (5000)
     #define default_zKd     (18.000*1024)
+    #define default_zKvff   (0)
+    #define default_zKaff   (0)
   #endif
 
   #define default_machineWidth        DEFAULT_X_MAX_TRAVEL
@@ -125,6 +138,11 @@
   #define default_HomeChainLengths    (1790) // With the other default settings, this is 0,0
 
   #define default_SimpleKinematics    (0)
+  #define default_SegmentTolerance    (0.01) // mm. Max bow of a line segment in chain space.
+  #define default_PidRate             (100)  // Hz. Gains above are tuned at this rate.
+  #define default_AutoReportInterval  (0)    // ms. Both zero: status reports only on request.
+  #define default_AutoReportIdleInterval (0)
+  #define default_Jerk                (0.0)  // mm/sec^3. Trapezoid ramps.
 
 #endif
 
@@ -28,6 +28,159 @@ struct {
   unsigned char address_low;
 } ee_CS = {0,0,0};
 
+// A write cycle runs in the EEPROM for EEPROM_WRITE_TIME after each write. Rather than sit it out,
+// the next access waits for whatever is left of it in eeprom_wait_ready().
+static volatile uint8_t ee_write_busy = false;
+static volatile uint32_t ee_write_time;  // micros() at the end of the last write
+
+#ifdef EEPROM_WRITE_BEHIND
+  // RAM shadow of the machine state block. store_current_machine_pos() only updates the shadow and
+  // marks the bytes that changed. eeprom_service() writes these back from the main loop, a page
+  // write of up to EEPROM_WRITE_BEHIND_BYTES per call, and lets the write cycle run in the meantime.
+  #define EEPROM_MACHINE_STATE_SIZE 0x200U
+  static unsigned char ee_shadow[EEPROM_MACHINE_STATE_SIZE];
+  static uint32_t ee_dirty[EEPROM_MACHINE_STATE_SIZE/32];  // One bit per shadow byte.
+  static uint16_t ee_dirty_count;
+  static uint16_t ee_dirty_first;  // No dirty bytes below this offset.
+#endif
+
+#ifdef EEPROM_HARDWARE_TWI
+
+// Page write in progress on the bus. EEPROM_TWI_Handler() feeds TWI_THR from ee_twi_data.
+static unsigned char ee_twi_data[EEPROM_PAGE_SIZE];
+static volatile uint8_t ee_twi_count;   // Bytes in the page write.
+static volatile uint8_t ee_twi_index;   // Next byte for TWI_THR.
+static volatile uint8_t ee_twi_active = false;
+static uint8_t ee_twi_started = false;
+
+void eeprom_init(void)
+{
+    if (ee_twi_started) { return; }
+    pmc_enable_periph_clk(EEPROM_TWI_ID);
+    EEPROM_TWI_PIO->PIO_PDR = EEPROM_TWI_PINS;     // hand the pins to the controller
+    EEPROM_TWI_PIO->PIO_ABSR &= ~EEPROM_TWI_PINS;  // peripheral A
+    EEPROM_TWI->TWI_IDR = 0xFFFFFFFF;
+    EEPROM_TWI->TWI_CR = TWI_CR_SWRST;
+    EEPROM_TWI->TWI_RHR;
+    EEPROM_TWI->TWI_CR = TWI_CR_SVDIS | TWI_CR_MSEN;  // master only
+    uint32_t div = VARIANT_MCK/(2*EEPROM_TWI_CLOCK) - 4;  // clock low and high times are (div+4)/MCK
+    EEPROM_TWI->TWI_CWGR = TWI_CWGR_CLDIV(div) | TWI_CWGR_CHDIV(div) | TWI_CWGR_CKDIV(0);
+    NVIC_SetPriority(EEPROM_TWI_IRQn, 15);  // lowest, never ahead of the step and servo timers
+    NVIC_EnableIRQ(EEPROM_TWI_IRQn);
+    ee_twi_started = true;
+}
+
+// Sends the rest of a page write a byte per TXRDY and the STOP after the last. The write cycle
+// starts at TXCOMP. A NACK, i.e. an EEPROM that is missing, drops the page.
+void EEPROM_TWI_Handler(void)
+{
+    uint32_t status = EEPROM_TWI->TWI_SR & EEPROM_TWI->TWI_IMR;
+    if (status & TWI_SR_NACK) {
+      EEPROM_TWI->TWI_IDR = 0xFFFFFFFF;
+      ee_twi_active = false;
+    } else if (status & TWI_SR_TXRDY) {
+      EEPROM_TWI->TWI_THR = ee_twi_data[ee_twi_index++];
+      if (ee_twi_index == ee_twi_count) {
+        EEPROM_TWI->TWI_CR = TWI_CR_STOP;
+        EEPROM_TWI->TWI_IDR = TWI_IDR_TXRDY;
+        EEPROM_TWI->TWI_IER = TWI_IER_TXCOMP;
+      }
+    } else if (status & TWI_SR_TXCOMP) {
+      EEPROM_TWI->TWI_IDR = 0xFFFFFFFF;
+      ee_write_time = micros();
+      ee_write_busy = true;
+      ee_twi_active = false;
+    }
+}
+
+// True while a page write is on the bus or its write cycle may still be running.
+static uint8_t eeprom_busy()
+{
+    return(ee_twi_active || (ee_write_busy && ((micros() - ee_write_time) < EEPROM_WRITE_TIME)));
+}
+
+// Waits for the last page write to finish. The EEPROM does not acknowledge its address during the
+// write cycle, so it is polled with one byte reads until it answers, for at most EEPROM_WRITE_TIME.
+static void eeprom_wait_ready()
+{
+    eeprom_init();
+    while (ee_twi_active) { }
+    if (!ee_write_busy) { return; }
+    do {
+      EEPROM_TWI->TWI_MMR = TWI_MMR_DADR(EECC) | TWI_MMR_MREAD;  // current address read
+      EEPROM_TWI->TWI_CR = TWI_CR_START | TWI_CR_STOP;
+      uint32_t status;
+      do { status = EEPROM_TWI->TWI_SR; } while (!(status & (TWI_SR_RXRDY | TWI_SR_NACK)));
+      if (!(status & TWI_SR_NACK)) {
+        EEPROM_TWI->TWI_RHR;
+        while (!(EEPROM_TWI->TWI_SR & TWI_SR_TXCOMP)) { }
+        break;
+      }
+    } while ((micros() - ee_write_time) < EEPROM_WRITE_TIME);
+    ee_write_busy = false;
+}
+
+// Reads size bytes from addr onward in one sequential read. Bytes the EEPROM does not send read
+// as erased (0xFF), so their checksum fails.
+static void eeprom_read_block( unsigned int addr, unsigned char *data, unsigned int size )
+{
+    if (size == 0) { return; }
+    eeprom_wait_ready();
+    EEPROM_TWI->TWI_MMR = TWI_MMR_DADR(EECC) | TWI_MMR_MREAD | TWI_MMR_IADRSZ_2_BYTE;
+    EEPROM_TWI->TWI_IADR = addr;
+    EEPROM_TWI->TWI_CR = (size == 1) ? (TWI_CR_START | TWI_CR_STOP) : TWI_CR_START;
+    for (unsigned int i = 0; i < size; i++) {
+      if ((i == size-1) && (size > 1)) { EEPROM_TWI->TWI_CR = TWI_CR_STOP; } // STOP after the next byte
+      uint32_t status;
+      do { status = EEPROM_TWI->TWI_SR; } while (!(status & (TWI_SR_RXRDY | TWI_SR_NACK)));
+      if (status & TWI_SR_NACK) { memset(&data[i], 0xFF, size-i); return; }
+      data[i] = EEPROM_TWI->TWI_RHR;
+    }
+    while (!(EEPROM_TWI->TWI_SR & TWI_SR_TXCOMP)) { }
+}
+
+unsigned char eeprom_get_current_address()
+{
+    eeprom_wait_ready();
+    EEPROM_TWI->TWI_MMR = TWI_MMR_DADR(EECC) | TWI_MMR_MREAD;
+    EEPROM_TWI->TWI_CR = TWI_CR_START | TWI_CR_STOP;
+    uint32_t status;
+    do { status = EEPROM_TWI->TWI_SR; } while (!(status & (TWI_SR_RXRDY | TWI_SR_NACK)));
+    if (status & TWI_SR_NACK) { return 0xFF; }
+    unsigned char databyte = EEPROM_TWI->TWI_RHR;
+    while (!(EEPROM_TWI->TWI_SR & TWI_SR_TXCOMP)) { }
+    return databyte;
+}
+
+unsigned char eeprom_get_char( unsigned int addr )
+{
+    unsigned char databyte;
+    eeprom_read_block(addr, &databyte, 1);
+    return databyte;
+}
+
+// Starts a page write of count bytes to addr onward, sent by EEPROM_TWI_Handler(). The bytes must
+// not cross an EEPROM_PAGE_SIZE boundary, or the EEPROM wraps them around to the start of the page.
+static void eeprom_put_page( unsigned int addr, unsigned char *data, unsigned int count )
+{
+    eeprom_wait_ready();
+    memcpy(ee_twi_data, data, count);
+    ee_twi_count = count;
+    ee_twi_index = 1;
+    ee_twi_active = true;
+    EEPROM_TWI->TWI_MMR = TWI_MMR_DADR(EECC) | TWI_MMR_IADRSZ_2_BYTE;
+    EEPROM_TWI->TWI_IADR = addr;
+    EEPROM_TWI->TWI_THR = ee_twi_data[0];  // starts the transfer
+    if (count == 1) {
+      EEPROM_TWI->TWI_CR = TWI_CR_STOP;
+      EEPROM_TWI->TWI_IER = TWI_IER_TXCOMP | TWI_IER_NACK;
+    } else {
+      EEPROM_TWI->TWI_IER = TWI_IER_TXRDY | TWI_IER_NACK;
+    }
+}
+
+#else
+
 void eeprom_init(void)
 {
     pinMode(SDApin, INPUT);
@@ -87,10 +240,27 @@ int eeprom_start(int read_write)
     return eeprom_get_ack();        
 }
 
+// True while the write cycle of the last write may still be running.
+static uint8_t eeprom_busy()
+{
+    return(ee_write_busy && ((micros() - ee_write_time) < EEPROM_WRITE_TIME));
+}
+
+// Waits out the write cycle of the last write, if it is still running.
+static void eeprom_wait_ready()
+{
+    if (ee_write_busy) {
+      while ((micros() - ee_write_time) < EEPROM_WRITE_TIME) { }
+      ee_write_busy = false;
+    }
+}
+
 void eeprom_set_addr(byte read_write, uint16_t addr)
 {
     int i, ack;
     
+    eeprom_wait_ready();
+
      // start condition
     eeprom_init();    
     ack = eeprom_start(EEWR);   // write control byte
@@ -153,54 +323,186 @@ unsigned char eeprom_get_current_address()
 unsigned char eeprom_get_char( unsigned int addr )
 {
     eeprom_set_addr(EEWR, addr);    // write address for random read 
-    eeprom_get_current_address();
+    return eeprom_get_current_address();
 }
 
-void eeprom_put_char( unsigned int addr, unsigned char new_value )
+// Writes count bytes to addr onward in one page write. The bytes must not cross an EEPROM_PAGE_SIZE
+// boundary, or the EEPROM wraps them around to the start of the page.
+static void eeprom_put_page( unsigned int addr, unsigned char *data, unsigned int count )
 {
     int i;
     
     eeprom_set_addr(EEWR, addr);
 
-    digitalWrite(SCLpin, LOW);   // SDA drops followed by SDA to create a start state
-    delayMicroseconds(I2C_DELAY);      
-    pinMode(SDApin, OUTPUT);
-    for(i=0; i<8; i++)
+    for(; count > 0; count--)
     {
-          delayMicroseconds(I2C_DELAY);  
-          digitalWrite(SDApin,((new_value >> (7-i)) & 1)); // shift out data
-          delayMicroseconds(I2C_DELAY);  
-          digitalWrite(SCLpin, HIGH);  // drop clk line   
-          delayMicroseconds(I2C_DELAY);          
-          digitalWrite(SCLpin, LOW);  // drop clk line   
+      unsigned char new_value = *(data++);
+      digitalWrite(SCLpin, LOW);   // SDA drops followed by SDA to create a start state
+      delayMicroseconds(I2C_DELAY);      
+      pinMode(SDApin, OUTPUT);
+      for(i=0; i<8; i++)
+      {
+            delayMicroseconds(I2C_DELAY);  
+            digitalWrite(SDApin,((new_value >> (7-i)) & 1)); // shift out data
+            delayMicroseconds(I2C_DELAY);  
+            digitalWrite(SCLpin, HIGH);  // drop clk line   
+            delayMicroseconds(I2C_DELAY);          
+            digitalWrite(SCLpin, LOW);  // drop clk line   
+      }
+      eeprom_get_ack();   
     }
-    eeprom_get_ack();   
     eeprom_stop();
  
-    delayMicroseconds(EEPROM_WRITE_TIME);  // write cycle time for eeprom is 5ms
+    ee_write_time = micros();  // write cycle time for eeprom is 5ms. Waited out by the next access.
+    ee_write_busy = true;
+}
+
+// Reads size bytes from addr onward, the first by address and the rest sequentially.
+static void eeprom_read_block( unsigned int addr, unsigned char *data, unsigned int size )
+{
+    if (size == 0) { return; }
+    *(data++) = eeprom_get_char(addr);
+    while (--size) { *(data++) = eeprom_get_current_address(); }
+}
+
+#endif
+
+void eeprom_put_char( unsigned int addr, unsigned char new_value )
+{
+    eeprom_put_page(addr, &new_value, 1);
 }
 
+// Writes the data and its checksum a page write per EEPROM page, not a write cycle per byte.
 void memcpy_to_eeprom_with_checksum(unsigned int destination, char *source, unsigned int size) {
   unsigned char checksum = 0;
+  unsigned char page[EEPROM_PAGE_SIZE];
+  unsigned int start = destination, count = 0;
   for(; size > 0; size--) { 
     checksum = (checksum << 1) || (checksum >> 7);
     checksum += *source;
-    eeprom_put_char(destination++, *(source++)); 
+    page[count++] = *(source++);
+    if ((++destination % EEPROM_PAGE_SIZE) == 0) { // page full
+      eeprom_put_page(start, page, count);
+      start = destination;
+      count = 0;
+    }
   }
-  eeprom_put_char(destination, checksum);
+  page[count++] = checksum;
+  eeprom_put_page(start, page, count);
 }
 
+// Reads the data in one sequential read and checks it against its checksum.
 int memcpy_from_eeprom_with_checksum(char *destination, unsigned int source, unsigned int size) {
+  unsigned char checksum = 0;
+  eeprom_read_block(source, (unsigned char *)destination, size);
+  for(unsigned int i = 0; i < size; i++) { 
+    checksum = (checksum << 1) || (checksum >> 7);
+    checksum += destination[i];    
+  }
+  return(checksum == eeprom_get_char(source + size));
+}
+
+#ifdef EEPROM_WRITE_BEHIND
+
+// Updates a shadow byte, marking it for eeprom_service() when it changes.
+static void ee_shadow_put(unsigned int offset, unsigned char value)
+{
+  if (ee_shadow[offset] == value) { return; }
+  ee_shadow[offset] = value;
+  uint32_t mask = 1UL << (offset & 31);
+  if (!(ee_dirty[offset >> 5] & mask)) {
+    ee_dirty[offset >> 5] |= mask;
+    ee_dirty_count++;
+    if (offset < ee_dirty_first) { ee_dirty_first = offset; }
+  }
+}
+
+// As memcpy_to_eeprom_with_checksum(), into the shadow at offset from EEPROM_ADDR_MACHINE_STATE.
+static void memcpy_to_shadow_with_checksum(unsigned int offset, char *source, unsigned int size) {
+  unsigned char checksum = 0;
+  for(; size > 0; size--) { 
+    checksum = ((checksum << 1) != 0) || ((checksum >> 7) != 0); // The sum memcpy_from_eeprom_with_checksum() checks.
+    checksum += *source;
+    ee_shadow_put(offset++, *(source++)); 
+  }
+  ee_shadow_put(offset, checksum);
+}
+
+// As memcpy_from_eeprom_with_checksum(), from the shadow.
+static int memcpy_from_shadow_with_checksum(char *destination, unsigned int offset, unsigned int size) {
   unsigned char data, checksum = 0;
   for(; size > 0; size--) { 
-    data = eeprom_get_char(source++);
-    checksum = (checksum << 1) || (checksum >> 7);
+    data = ee_shadow[offset++];
+    checksum = ((checksum << 1) != 0) || ((checksum >> 7) != 0);
     checksum += data;    
     *(destination++) = data; 
   }
-  return(checksum == eeprom_get_char(source));
+  return(checksum == ee_shadow[offset]);
+}
+
+// Writes back runs of changed shadow bytes, each up to EEPROM_WRITE_BEHIND_BYTES within one page,
+// for about budget_us or until the last write is still busy. Clean bytes between dirty ones go along
+// in a run. Run by the main loop scheduler, so a stored position reaches the EEPROM within a few
+// loop passes. Returns true while bytes are left to write.
+uint8_t eeprom_service(uint16_t budget_us)
+{
+  uint32_t start = micros();
+  while (ee_dirty_count != 0) {
+    if (eeprom_busy()) { return(true); }
+
+    unsigned int offset = ee_dirty_first;
+    while (!(ee_dirty[offset >> 5] & (1UL << (offset & 31)))) { offset++; }
+    unsigned int end = (offset | (EEPROM_PAGE_SIZE-1)) + 1; // Block and pages are page aligned.
+    if (end > offset + EEPROM_WRITE_BEHIND_BYTES) { end = offset + EEPROM_WRITE_BEHIND_BYTES; }
+    unsigned int last = offset;
+    for (unsigned int i = offset; i < end; i++) {
+      uint32_t mask = 1UL << (i & 31);
+      if (ee_dirty[i >> 5] & mask) {
+        ee_dirty[i >> 5] &= ~mask;
+        ee_dirty_count--;
+        last = i;
+      }
+    }
+    ee_dirty_first = last + 1;
+    eeprom_put_page(EEPROM_ADDR_MACHINE_STATE + offset, &ee_shadow[offset], last - offset + 1);
+    if ((micros() - start) >= budget_us) { break; }
+  }
+  return(ee_dirty_count != 0);
 }
 
+void store_current_machine_pos(void)
+{
+   memcpy_to_shadow_with_checksum(0x10,(char *)sys_position,sizeof(sys_position));
+   memcpy_to_shadow_with_checksum(0x40,(char *)pl.position,sizeof(pl.position));
+   memcpy_to_shadow_with_checksum(0x80,(char *)gc_state.coord_system,sizeof(gc_state.coord_system));
+   memcpy_to_shadow_with_checksum(0x100,(char *)gc_state.coord_offset,sizeof(gc_state.coord_offset));
+   memcpy_to_shadow_with_checksum(0x180,(char *)&gc_state.tool_length_offset,sizeof(gc_state.tool_length_offset));
+}
+
+void recall_current_machine_pos(void)
+{
+   // Load the shadow with one sequential read of the block.
+   eeprom_read_block(EEPROM_ADDR_MACHINE_STATE, ee_shadow, EEPROM_MACHINE_STATE_SIZE);
+   memset(ee_dirty, 0, sizeof(ee_dirty));
+   ee_dirty_count = 0;
+   ee_dirty_first = EEPROM_MACHINE_STATE_SIZE;
+
+   if(ee_shadow[0] != 0xA5) // test tag and init if not tagged
+   {
+      for(unsigned int i=1; i<EEPROM_MACHINE_STATE_SIZE; i++)
+        ee_shadow_put(i,0x00);
+      ee_shadow_put(0,0xA5);      
+      DEBUG_COM_PORT.print("EEMS Init\n");  
+   }
+   memcpy_from_shadow_with_checksum((char *)sys_position,0x10,sizeof(sys_position));
+   memcpy_from_shadow_with_checksum((char *)pl.position,0x40,sizeof(pl.position));
+   memcpy_from_shadow_with_checksum((char *)gc_state.coord_system,0x80,sizeof(gc_state.coord_system));
+   memcpy_from_shadow_with_checksum((char *)gc_state.coord_offset,0x100,sizeof(gc_state.coord_offset));
+   memcpy_from_shadow_with_checksum((char *)&gc_state.tool_length_offset,0x180,sizeof(gc_state.tool_length_offset));
+}
+
+#else
+
 void store_current_machine_pos(void)
 {
    memcpy_to_eeprom_with_checksum(EEPROM_ADDR_MACHINE_STATE+0x10,(char *)sys_position,sizeof(sys_position));
@@ -228,6 +530,8 @@ void recall_current_machine_pos(void)
 //   DEBUG_COM_PORT.print("MPOS RECALLED\n");
 }
 
+#endif
+
 
 unsigned char _cnvrt_char(unsigned char t)
 {
@@ -28,6 +28,7 @@
 #define EECC 0x50  /* 24LC256 device address is 0x50 */
 #define I2C_DELAY 1
 #define EEPROM_WRITE_TIME 5010  /* takes about 5ms to flash after a write.. */
+#define EEPROM_PAGE_SIZE 64     /* 24LC256 page write buffer */
 
 
 unsigned char eeprom_get_char(unsigned int addr);
@@ -35,6 +36,7 @@ void eeprom_put_char(unsigned int addr, unsigned char new_value);
 void memcpy_to_eeprom_with_checksum(unsigned int destination, char *source, unsigned int size);
 int memcpy_from_eeprom_with_checksum(char *destination, unsigned int source, unsigned int size);
 void store_current_machine_pos(void);
+uint8_t eeprom_service(uint16_t budget_us); // writes back stored machine state with EEPROM_WRITE_BEHIND. A scheduler task
 void recall_current_machine_pos(void);
 void EEPROM_viewer(void);
 #endif
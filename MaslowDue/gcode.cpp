@@ -21,10 +21,6 @@
 
 #include "grbl.h"
 
-// NOTE: Max line number is defined by the g-code standard to be 99999. It seems to be an
-// arbitrary value, and some GUIs may require more. So we increased it based on a max safe
-// value when converting a float (7.2 digit precision)s to an integer.
-#define MAX_LINE_NUMBER 10000000
 #define MAX_TOOL_NUMBER 255 // Limited by max unsigned 8-bit value
 
 #define AXIS_COMMAND_NONE 0
@@ -58,12 +54,150 @@ void gc_sync_position()
 }
 
 
+// Executes a G0 or G1 block made of only X, Y, Z, F, S and N words under the current modal state,
+// exactly as the full parser would. The words have already been checked for repeats, negative
+// values and the line number range. Shared by the modal fast path and the binary motion protocol.
+uint8_t gc_execute_motion_words(uint8_t motion, uint8_t distance, uint8_t words, float *value, int32_t n)
+{
+  uint8_t axis_words = words & GC_MOTION_WORD_AXES;
+
+  // [2./3. Set feed rate ]: In G93, F is never carried over and a G1 move must give it.
+  float feed_rate;
+  if (gc_state.modal.feed_rate == FEED_RATE_MODE_INVERSE_TIME) {
+    feed_rate = (words & GC_MOTION_WORD_F) ? value[N_AXIS] : 0.0;
+  } else if (words & GC_MOTION_WORD_F) {
+    feed_rate = value[N_AXIS];
+    if (gc_state.modal.units == UNITS_MODE_INCHES) { feed_rate *= MM_PER_INCH; }
+  } else {
+    feed_rate = gc_state.feed_rate;
+  }
+  if (axis_words && (motion == MOTION_MODE_LINEAR) && (feed_rate == 0.0)) { return(STATUS_GCODE_UNDEFINED_FEED_RATE); }
+
+  // Convert the axis words to the machine target, as in the full parser without G53.
+  float target[N_AXIS];
+  uint8_t idx;
+  for (idx=0; idx<N_AXIS; idx++) {
+    if (bit_isfalse(axis_words,bit(idx))) {
+      target[idx] = gc_state.position[idx]; // No axis word in block. Keep same axis position.
+    } else {
+      target[idx] = value[idx];
+      if (gc_state.modal.units == UNITS_MODE_INCHES) { target[idx] *= MM_PER_INCH; }
+      if (distance == DISTANCE_MODE_ABSOLUTE) {
+        target[idx] += gc_state.coord_system[idx] + gc_state.coord_offset[idx];
+        if (idx == TOOL_LENGTH_OFFSET_AXIS) { target[idx] += gc_state.tool_length_offset; }
+      } else {  // Incremental mode
+        target[idx] += gc_state.position[idx];
+      }
+    }
+  }
+
+  plan_line_data_t plan_data;
+  plan_line_data_t *pl_data = &plan_data;
+  memset(pl_data,0,sizeof(plan_line_data_t)); // Zero pl_data struct
+
+  // Laser mode power setup, as in the full parser for a block with no M3/M4/M5 word.
+  uint8_t laser_disable = false;
+  uint8_t laser_force_sync = false;
+  if (bit_istrue(settings.flags,BITFLAG_LASER_MODE)) {
+    if (motion == MOTION_MODE_SEEK) { laser_disable = true; }
+    if (!axis_words && (gc_state.modal.spindle == SPINDLE_ENABLE_CW)) {
+      uint8_t was_cutting = (gc_state.modal.motion == MOTION_MODE_LINEAR) || (gc_state.modal.motion == MOTION_MODE_CW_ARC)
+                            || (gc_state.modal.motion == MOTION_MODE_CCW_ARC);
+      if (was_cutting == laser_disable) { laser_force_sync = true; } // Motion mode changed without a move.
+    }
+  }
+
+  gc_state.line_number = n;
+  pl_data->line_number = gc_state.line_number;
+  if (gc_state.modal.feed_rate) { pl_data->condition |= PL_COND_FLAG_INVERSE_TIME; }
+  gc_state.feed_rate = feed_rate;
+  pl_data->feed_rate = gc_state.feed_rate;
+
+  float spindle_speed = (words & GC_MOTION_WORD_S) ? value[N_AXIS+1] : gc_state.spindle_speed;
+  if ((gc_state.spindle_speed != spindle_speed) || laser_force_sync) {
+    if (gc_state.modal.spindle != SPINDLE_DISABLE) {
+      if (!(bit_istrue(settings.flags,BITFLAG_LASER_MODE) && axis_words)) {
+        if (laser_disable) { spindle_sync(gc_state.modal.spindle, 0.0); }
+        else { spindle_sync(gc_state.modal.spindle, spindle_speed); }
+      }
+    }
+    gc_state.spindle_speed = spindle_speed;
+  }
+  if (!laser_disable) { pl_data->spindle_speed = gc_state.spindle_speed; }
+  gc_state.tool = 0; // As for any block without a T word.
+  pl_data->condition |= (gc_state.modal.spindle | gc_state.modal.coolant);
+
+  gc_state.modal.motion = motion;
+  if (axis_words) {
+    if (motion == MOTION_MODE_SEEK) { pl_data->condition |= PL_COND_FLAG_RAPID_MOTION; }
+    mc_line(target, pl_data);
+    memcpy(gc_state.position, target, sizeof(target));
+  }
+  return(STATUS_OK);
+}
+
+
+#ifdef GCODE_MODAL_FAST_PATH
+  // Parses a line of only X, Y, Z, F, S and N words, the bulk of a CAM job under G0 or G1, and runs
+  // it through gc_execute_motion_words(). Anything else, including any line the full parser would
+  // reject, is declined and left to the full parser, so error reporting is unchanged.
+  uint8_t gc_execute_fast_line(char *line)
+  {
+    // Only under G0/G1. Jog lines always take the full path.
+    if ( ((gc_state.modal.motion != MOTION_MODE_SEEK) && (gc_state.modal.motion != MOTION_MODE_LINEAR)) ||
+         (line[0] == '$') ) { return(GC_FAST_PATH_DECLINED); }
+    float value[N_AXIS+2];
+    float number;
+    int32_t n = 0; // If no line number is present, the value is zero.
+    uint8_t words = 0;
+    uint8_t char_counter = 0;
+    uint8_t word;
+    while (line[char_counter] != 0) {
+      switch(line[char_counter++]) {
+        case 'X': word = X_AXIS; break;
+        case 'Y': word = Y_AXIS; break;
+        case 'Z': word = Z_AXIS; break;
+        case 'F': word = N_AXIS; break;
+        case 'S': word = N_AXIS+1; break;
+        case 'N': word = N_AXIS+2; break;
+        default: return(GC_FAST_PATH_DECLINED);
+      }
+      if (!read_float(line, &char_counter, &number)) { return(GC_FAST_PATH_DECLINED); }
+      if (bit_istrue(words,bit(word))) { return(GC_FAST_PATH_DECLINED); }
+      words |= bit(word);
+      if (word >= N_AXIS) {
+        if (number < 0.0) { return(GC_FAST_PATH_DECLINED); }
+        if (word == N_AXIS+2) { n = trunc(number); }
+        else { value[word] = number; }
+      } else {
+        value[word] = number;
+      }
+    }
+    if (n > MAX_LINE_NUMBER) { return(GC_FAST_PATH_DECLINED); }
+    return(gc_execute_motion_words(gc_state.modal.motion, gc_state.modal.distance, words & ~bit((N_AXIS+2)), value, n));
+  }
+#endif
+
+
 // Executes one line of 0-terminated G-Code. The line is assumed to contain only uppercase
 // characters and signed floating point values (no whitespace). Comments and block delete
 // characters have been removed. In this function, all units and positions are converted and
 // exported to grbl's internal functions in terms of (mm, mm/min) and absolute machine
 // coordinates, respectively.
 uint8_t gc_execute_line(char *line)
+{
+  PROFILE_FUNCTION(PROFILE_GCODE);
+  #ifdef GCODE_MODAL_FAST_PATH
+    // Repeated G0/G1 moves skip the full modal checks.
+    uint8_t status = gc_execute_fast_line(line);
+    if (status != GC_FAST_PATH_DECLINED) { return(status); }
+  #endif
+  return(gc_execute_full_line(line));
+}
+
+
+// The full parser of gc_execute_line(), for any line.
+uint8_t gc_execute_full_line(char *line)
 {
   /* -------------------------------------------------------------------------------------
      STEP 1: Initialize parser block struct and copy current g-code state modes. The parser
@@ -22,6 +22,11 @@
 #ifndef gcode_h
 #define gcode_h
 
+// NOTE: Max line number is defined by the g-code standard to be 99999. It seems to be an
+// arbitrary value, and some GUIs may require more. So we increased it based on a max safe
+// value when converting a float (7.2 digit precision)s to an integer. Also checked by the
+// binary motion protocol.
+#define MAX_LINE_NUMBER 10000000
 
 // Define modal group internal numbers for checking multiple command violations and tracking the
 // type of command that is called in the block. A modal group is a group of g-code commands that are
@@ -243,7 +248,23 @@ void gc_init();
 // Execute one block of rs275/ngc/g-code
 uint8_t gc_execute_line(char *line);
 
+// The two paths of gc_execute_line(). The full parser takes any line. The fast path takes only
+// G0/G1 lines of X, Y, Z, F, S and N words, and returns GC_FAST_PATH_DECLINED for anything else.
+uint8_t gc_execute_full_line(char *line);
+#ifdef GCODE_MODAL_FAST_PATH
+  uint8_t gc_execute_fast_line(char *line);
+#endif
+
 // Set g-code parser position. Input in steps.
 void gc_sync_position();
 
+// Word flags and value order for gc_execute_motion_words(). X, Y and Z use their axis bits.
+#define GC_MOTION_WORD_AXES   (bit(X_AXIS)|bit(Y_AXIS)|bit(Z_AXIS))
+#define GC_MOTION_WORD_F      bit(N_AXIS)   // value[N_AXIS]
+#define GC_MOTION_WORD_S      bit((N_AXIS+1)) // value[N_AXIS+1]
+#define GC_FAST_PATH_DECLINED 0xFF          // Line left to the full parser.
+
+// Execute a G0 or G1 block of only axis, F, S and N words. Values are as given in the block.
+uint8_t gc_execute_motion_words(uint8_t motion, uint8_t distance, uint8_t words, float *value, int32_t n);
+
 #endif
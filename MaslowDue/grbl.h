@@ -57,6 +57,11 @@
   #define GRBL_Z_TRAVEL_MIN                     92
   #define GRBL_KINEMATICS_SIMPLE                93
   #define GRBL_HOME_CHAIN_LENGTHS               94
+  #define GRBL_SEGMENT_TOLERANCE                95
+  #define GRBL_PID_RATE                         96
+  #define GRBL_AUTO_REPORT_INTERVAL             97
+  #define GRBL_AUTO_REPORT_IDLE_INTERVAL        98
+  #define GRBL_JERK                             99
 #else
   #define GRBL_VERSION_BUILD "20180813.Mega"
   #include <avr/io.h>
@@ -98,6 +103,11 @@
 #include "stepper.h"
 #include "jog.h"
 #include "sleep.h"
+#include "profiler.h"
+#include "binary_protocol.h"
+#include "sdcard.h"
+#include "bench.h"
+#include "scheduler.h"
 
 // ---------------------------------------------------------------------------------------
 // COMPILE-TIME ERROR CHECKING OF DEFINE VALUES:
@@ -118,6 +128,14 @@
   #endif
 #endif
 
+#if defined(PLAN_SEGMENT_QUEUE_SIZE) && !defined(MASLOWCNC)
+  #error "PLAN_SEGMENT_QUEUE_SIZE queues Maslow chain lengths and requires MASLOWCNC."
+#endif
+
+#if defined(KINEMATICS_TARGET_CACHE) && !(KINEMATICS_TARGET_CACHE > 0 && KINEMATICS_TARGET_CACHE < 256)
+  #error "KINEMATICS_TARGET_CACHE must be 1-255 entries."
+#endif
+
 #if defined(SPINDLE_PWM_MIN_VALUE)
   #if !(SPINDLE_PWM_MIN_VALUE > 0)
     #error "SPINDLE_PWM_MIN_VALUE must be greater than zero."
@@ -137,6 +155,39 @@
   #error "Override refresh must be greater than zero."
 #endif
 
+#if defined(STEP_PREP_FIXED_POINT) && !defined(MASLOWCNC)
+  #error "STEP_PREP_FIXED_POINT computes step timing in microseconds for the Maslow-Due step timer only."
+#endif
+
+#if defined(CARTESIAN_PLANNING) && !defined(MASLOWCNC)
+  #error "CARTESIAN_PLANNING plans the Maslow chain moves along their x-y path and requires MASLOWCNC."
+#endif
+
+#if defined(JACOBIAN_FEED_LIMITS) && !defined(CARTESIAN_PLANNING)
+  #error "JACOBIAN_FEED_LIMITS requires CARTESIAN_PLANNING."
+#endif
+
+#if defined(MOTOR_SIMULATION) && !defined(MASLOWCNC)
+  #error "MOTOR_SIMULATION models the Maslow PID motors and requires MASLOWCNC."
+#endif
+
+#if defined(S_CURVE_ACCELERATION) && (!defined(MASLOWCNC) || defined(STEP_PREP_FIXED_POINT))
+  #error "S_CURVE_ACCELERATION shapes the float segment generator of the Maslow-Due. Disable STEP_PREP_FIXED_POINT."
+#endif
+
+#if defined(CYCLE_PROFILER) && !defined(MASLOWCNC)
+  #error "CYCLE_PROFILER uses the Cortex-M3 DWT cycle counter of the Maslow-Due."
+#endif
+
+#if defined(STEP_STREAMING_INTERPOLATOR)
+  #if !defined(MASLOWCNC)
+    #error "STEP_STREAMING_INTERPOLATOR writes the Maslow-Due PID targets and requires MASLOWCNC."
+  #endif
+  #if (STREAM_INTERPOLATION_US < 100) || (STREAM_INTERPOLATION_US > 10000)
+    #error "STREAM_INTERPOLATION_US must be between 100 and 10000 microseconds."
+  #endif
+#endif
+
 // ---------------------------------------------------------------------------------------
 
 #endif
@@ -46,3 +46,103 @@ uint8_t jog_execute(plan_line_data_t *pl_data, parser_block_t *gc_block)
 
   return(STATUS_OK);
 }
+
+
+#ifdef JOG_VELOCITY_MODE
+// A velocity jog is planned as short blocks from the parser position, only a few ahead of the
+// sled. Blocks are sized so that those few still cover the distance to stop from the jog rate,
+// so the sled runs at speed and then stops within one block of the last command that kept it
+// going. The parser position follows the planned blocks, as for $J= jogs.
+static struct {
+  uint8_t active;
+  float unit_vec[N_AXIS];
+  float rate;           // mm/min
+  float block_mm;       // Length of each planned block.
+  uint32_t command_ms;  // millis() of the last $JV=.
+} jog_velocity;
+
+
+uint8_t jog_velocity_execute(char *line)
+{
+  float vector[N_AXIS] = {0.0};
+  float rate = 0.0, value;
+  uint8_t char_counter = 0;
+  while (line[char_counter] != 0) {
+    char letter = line[char_counter++];
+    if (!read_float(line, &char_counter, &value)) { return(STATUS_BAD_NUMBER_FORMAT); }
+    switch (letter) {
+      case 'X': vector[X_AXIS] = value; break;
+      case 'Y': vector[Y_AXIS] = value; break;
+      case 'Z': vector[Z_AXIS] = value; break;
+      case 'F':
+        if (value < 0.0) { return(STATUS_NEGATIVE_VALUE); }
+        rate = value;
+        break;
+      default: return(STATUS_INVALID_STATEMENT);
+    }
+  }
+  if (sys.suspend) { return(STATUS_IDLE_ERROR); } // Jog cancel still stopping.
+
+  float length = convert_delta_vector_to_unit_vector(vector);
+  if ((length == 0.0) || (rate == 0.0)) {
+    jog_velocity_stop();
+    return(STATUS_OK);
+  }
+  memcpy(jog_velocity.unit_vec, vector, sizeof(vector));
+  jog_velocity.rate = min(rate, limit_value_by_axis_maximum(settings.max_rate, vector));
+  float acceleration = limit_value_by_axis_maximum(settings.acceleration, vector);
+  float stop_mm = jog_velocity.rate*jog_velocity.rate/(2.0*acceleration);
+  jog_velocity.block_mm = max(jog_velocity.rate*(JOG_VELOCITY_PERIOD/60000.0), stop_mm/(JOG_VELOCITY_BLOCKS-1));
+  jog_velocity.command_ms = millis();
+  jog_velocity.active = true;
+  jog_velocity_service(); // Start right away.
+  return(STATUS_OK);
+}
+
+
+void jog_velocity_stop()
+{
+  jog_velocity.active = false;
+}
+
+
+void jog_velocity_service()
+{
+  if (!jog_velocity.active) { return; }
+  // Ends if the host stops sending, on a jog cancel or any other state change, and at soft limits.
+  if (((millis() - jog_velocity.command_ms) > JOG_VELOCITY_TIMEOUT) || sys.suspend ||
+      !((sys.state == STATE_IDLE) || (sys.state == STATE_JOG))) {
+    jog_velocity_stop();
+    return;
+  }
+
+  while ((plan_get_block_buffer_count() < JOG_VELOCITY_BLOCKS) && !plan_check_full_buffer()) {
+    float target[N_AXIS];
+    uint8_t idx;
+    for (idx=0; idx<N_AXIS; idx++) {
+      target[idx] = gc_state.position[idx] + jog_velocity.unit_vec[idx]*jog_velocity.block_mm;
+    }
+    if (bit_istrue(settings.flags,BITFLAG_SOFT_LIMIT_ENABLE)) {
+      if (system_check_travel_limits(target)) { jog_velocity_stop(); break; }
+    }
+
+    // As jog_execute(), with the spindle and coolant state of the parser.
+    plan_line_data_t pl_data;
+    memset(&pl_data, 0, sizeof(plan_line_data_t));
+    pl_data.feed_rate = jog_velocity.rate;
+    pl_data.spindle_speed = gc_state.spindle_speed;
+    pl_data.condition = (gc_state.modal.spindle | gc_state.modal.coolant) | PL_COND_FLAG_NO_FEED_OVERRIDE;
+    pl_data.line_number = JOG_LINE_NUMBER;
+    plan_buffer_line(target, &pl_data);
+    memcpy(gc_state.position, target, sizeof(target));
+  }
+
+  if (sys.state == STATE_IDLE) {
+    if (plan_get_current_block() != NULL) { // Also restarts a jog the main loop let run dry.
+      sys.state = STATE_JOG;
+      st_prep_buffer();
+      st_wake_up();  // NOTE: Manual start. No state machine required.
+    }
+  }
+}
+#endif
@@ -29,4 +29,16 @@
 // Sets up valid jog motion received from g-code parser, checks for soft-limits, and executes the jog.
 uint8_t jog_execute(plan_line_data_t *pl_data, parser_block_t *gc_block);
 
+#ifdef JOG_VELOCITY_MODE
+  // Sets the direction and rate of the velocity jog from the words after `$JV=`, i.e. X1Y-1F500.
+  // No axis words or a zero rate stops it.
+  uint8_t jog_velocity_execute(char *line);
+
+  // Keeps a running velocity jog JOG_VELOCITY_BLOCKS ahead. Called from the main loop.
+  void jog_velocity_service();
+
+  // Stops the velocity jog without planning more. Blocks already planned still run.
+  void jog_velocity_stop();
+#endif
+
 #endif
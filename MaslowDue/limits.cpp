@@ -32,6 +32,69 @@
   #define HOMING_AXIS_LOCATE_SCALAR  5.0 // Must be > 1 to ensure limit switch is cleared.
 #endif
 
+#ifdef MASLOWCNC
+  // The limit and driver fault lines are on PIO edge interrupts, so they stop the machine within
+  // microseconds of tripping with nothing polled by the main loop or the stepper ISR. Each latches
+  // the measured position into sys_fault_position, reported as [FLT:] with the alarm.
+  // NOTE: Do not attach an e-stop to the limit pins, as in the AVR pin change interrupt. They
+  // are detached during homing cycles.
+  static const uint8_t limit_pins[N_AXIS] = {X_LIMIT_PIN, Y_LIMIT_PIN, Z_LIMIT_PIN};
+  #if defined(DRIVER_FAULT_ALARM) && defined(DRIVER_TLE5206)
+    static const uint8_t fault_pins[N_AXIS] = {X_FAULT, Y_FAULT, Z_FAULT};
+  #endif
+
+  // Returns a bit per axis, set where its pin is high. Reads the PIO directly.
+  static uint8_t limits_read_pins(const uint8_t *pins)
+  {
+    uint8_t state = 0;
+    for (uint8_t idx = 0; idx < N_AXIS; idx++) {
+      const PinDescription *pin = &g_APinDescription[pins[idx]];
+      if (pin->pPort->PIO_PDSR & pin->ulPin) { state |= bit(idx); }
+    }
+    return(state);
+  }
+
+  static void limits_latch_fault(uint8_t axes)
+  {
+    system_get_measured_position(sys_fault_position);
+    sys_fault_axes = axes;
+  }
+
+  // Limit pin change interrupt. Handles the hard limit feature as the AVR ISR(LIMIT_INT_vect).
+  static void limits_pin_handler()
+  {
+    if (sys.state != STATE_ALARM) {
+      if (!(sys_rt_exec_alarm)) {
+        uint8_t limit_state = limits_get_state();
+        #ifdef HARD_LIMIT_FORCE_STATE_CHECK
+          if (!limit_state) { return; }
+        #endif
+        limits_latch_fault(limit_state);
+        mc_reset(); // Initiate system kill.
+        system_set_exec_alarm(EXEC_ALARM_HARD_LIMIT); // Indicate hard limit critical event
+      }
+    }
+  }
+
+  #if defined(DRIVER_FAULT_ALARM) && defined(DRIVER_TLE5206)
+    // TLE5206 error flag interrupt. The flag is pulled low on over temperature, a short or under
+    // voltage. The motors are braked here, not when the main loop sees the alarm. Ignored while
+    // the motors are disabled, as the flag is also low whenever the motor supply is off.
+    static void limits_fault_handler()
+    {
+      if (Motors_Disabled) { return; }
+      uint8_t fault_state = limits_read_pins(fault_pins) ^ ((1<<N_AXIS)-1); // Active low.
+      if (!fault_state) { return; }
+      motorsDisabled();
+      if ((sys.state != STATE_ALARM) && !(sys_rt_exec_alarm)) {
+        limits_latch_fault(fault_state);
+        mc_reset();
+        system_set_exec_alarm(EXEC_ALARM_DRIVER_FAULT);
+      }
+    }
+  #endif
+#endif
+
 void limits_init()
 {
   #ifndef MASLOWCNC
@@ -95,6 +158,27 @@ void limits_init()
         WDTCSR = (1<<WDP0); // Set time-out at ~32msec.
       #endif
     #endif // DEFAULTS_RAMPS_BOARD
+  #else
+    for (uint8_t idx = 0; idx < N_AXIS; idx++) {
+      #ifdef DISABLE_LIMIT_PIN_PULL_UP
+        pinMode(limit_pins[idx], INPUT); // Normal low operation. Requires external pull-down.
+      #else
+        pinMode(limit_pins[idx], INPUT_PULLUP); // Normal high operation.
+      #endif
+    }
+    if (bit_istrue(settings.flags,BITFLAG_HARD_LIMIT_ENABLE)) {
+      for (uint8_t idx = 0; idx < N_AXIS; idx++) {
+        attachInterrupt(digitalPinToInterrupt(limit_pins[idx]), limits_pin_handler, CHANGE);
+      }
+    } else {
+      limits_disable();
+    }
+    #if defined(DRIVER_FAULT_ALARM) && defined(DRIVER_TLE5206)
+      // Always armed, including while homing. setup() has made them inputs.
+      for (uint8_t idx = 0; idx < N_AXIS; idx++) {
+        attachInterrupt(digitalPinToInterrupt(fault_pins[idx]), limits_fault_handler, FALLING);
+      }
+    #endif
   #endif
 }
 
@@ -111,6 +195,8 @@ void limits_disable()
       LIMIT_PCMSK &= ~LIMIT_MASK;  // Disable specific pins of the Pin Change Interrupt
       PCICR &= ~(1 << LIMIT_INT);  // Disable Pin Change Interrupt
     #endif // DEFAULTS_RAMPS_BOARD
+  #else
+    for (uint8_t idx = 0; idx < N_AXIS; idx++) { detachInterrupt(digitalPinToInterrupt(limit_pins[idx])); }
   #endif
 }
 
@@ -169,6 +255,10 @@ uint8_t limits_get_state()
       }
       return(limit_state);
     #endif //DEFAULTS_RAMPS_BOARD
+  #else
+    limit_state = limits_read_pins(limit_pins);
+    if (bit_isfalse(settings.flags,BITFLAG_INVERT_LIMIT_PINS)) { limit_state ^= ((1<<N_AXIS)-1); }
+    return(limit_state);
   #endif
 }
 
@@ -532,6 +622,7 @@ void limits_go_home(uint8_t cycle_mask)
       bool xAxis = cycle_mask & bit(X_AXIS);
       bool yAxis = cycle_mask & bit(Y_AXIS);
       bool zAxis = cycle_mask & bit(Z_AXIS);
+      CRITICAL_ENTER(); // Not between the PID reads of a position and its target.
       if (xAxis) {
         x_axis.axis_Position = 0;
         x_axis.target = 0;
@@ -556,6 +647,7 @@ void limits_go_home(uint8_t cycle_mask)
         z_axis.Integral = 0;
         sys_position[Z_AXIS] = 0;
       }
+      CRITICAL_EXIT();
 
       store_current_machine_pos();    // reset all the way out to stored space
   #else
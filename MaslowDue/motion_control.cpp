@@ -28,6 +28,90 @@
 #endif
 
 
+#ifdef PLAN_SEGMENT_QUEUE_SIZE
+// Hands a segment and its chain lengths to the parse-ahead queue, and plans what the planner has
+// room for. Only waits while the queue is full, so the parser keeps reading, segmenting and
+// converting the lines ahead while the planner buffer is full.
+static void mc_queue_segment(float *target, float *chain, plan_line_data_t *pl_data)
+{
+  #ifdef REPORT_FIELD_STARVATION
+    uint32_t wait_start = micros();
+  #endif
+  do {
+    plan_queue_flush();
+    if ( plan_check_full_queue() ) {
+      protocol_execute_realtime(); // Check for any run-time commands
+      if (sys.abort) { return; } // Bail, if system abort.
+      protocol_auto_cycle_start(); // Auto-cycle start when buffer is full.
+      #ifdef PLANNER_RECALC_BUDGET_US
+        plan_recalculate_resume(); // Use the wait to finish any budgeted replanning.
+      #endif
+    }
+    else { break; }
+  } while (1);
+  #ifdef REPORT_FIELD_STARVATION
+    system_add_planner_wait(micros() - wait_start);
+  #endif
+
+  plan_queue_line(target, chain, pl_data);
+  plan_queue_flush();
+}
+#endif
+
+
+#ifdef MASLOWCNC
+// Maps a chain length error at x-y to the x-y error, through the inverse chain Jacobian. Zero
+// where that is singular, on the line through the motors, outside the work area.
+static void mc_chain_error_to_xy(float x, float y, float aErr, float bErr, float *xErr, float *yErr)
+{
+  float inverse[4];
+  if (!chainJacobianInverse(x, y, inverse)) { *xErr = *yErr = 0.0f; return; }
+  *xErr = inverse[0]*aErr + inverse[1]*bErr;
+  *yErr = inverse[2]*aErr + inverse[3]*bErr;
+}
+
+
+// Plans a segment with the chain lengths of its end, once the planner buffer or the parse-ahead
+// queue has room for it.
+static void mc_plan_chain_segment(float *target, float *chain, plan_line_data_t *pl_data)
+{
+  #ifdef PLAN_SEGMENT_QUEUE_SIZE
+    mc_queue_segment(target, chain, pl_data);
+  #else
+    // If the buffer is full remain in this loop until there is room in the buffer.
+    #ifdef REPORT_FIELD_STARVATION
+      uint32_t wait_start = micros();
+    #endif
+    do {
+      protocol_execute_realtime(); // Check for any run-time commands
+      if (sys.abort) { return; } // Bail, if system abort.
+      if ( plan_check_full_buffer() ) {
+        protocol_auto_cycle_start(); // Auto-cycle start when buffer is full.
+        #ifdef PLANNER_RECALC_BUDGET_US
+          plan_recalculate_resume(); // Use the wait to finish any budgeted replanning.
+        #endif
+      }
+      else { break; }
+    } while (1);
+    #ifdef REPORT_FIELD_STARVATION
+      system_add_planner_wait(micros() - wait_start);
+    #endif
+
+    // Plan and queue motion into planner buffer, one tolerance sized segment at a time.
+    if (plan_buffer_chain_line(target, chain, pl_data) == PLAN_EMPTY_BLOCK) {
+      if (bit_istrue(settings.flags,BITFLAG_LASER_MODE)) {
+        // Correctly set spindle state, if there is a coincident position passed. Forces a buffer
+        // sync while in M3 laser mode only.
+        if (pl_data->condition & PL_COND_FLAG_SPINDLE_CW) {
+          spindle_sync(PL_COND_FLAG_SPINDLE_CW, pl_data->spindle_speed);
+        }
+      }
+    }
+  #endif
+}
+#endif
+
+
 // Execute linear motion in absolute millimeter coordinates. Feed rate given in millimeters/second
 // unless invert_feed_rate is true. Then the feed_rate means that the motion should be completed in
 // (1 minute)/feed_rate time.
@@ -63,12 +147,26 @@ void mc_line(float *target, plan_line_data_t *pl_data)
 
   // If the buffer is full: good! That means we are well ahead of the robot.
   // Remain in this loop until there is room in the buffer.
+  // NOTE: With the parse-ahead queue, mc_queue_segment() waits on the queue instead.
+  #ifndef PLAN_SEGMENT_QUEUE_SIZE
+  #ifdef REPORT_FIELD_STARVATION
+    uint32_t wait_start = micros();
+  #endif
   do {
     protocol_execute_realtime(); // Check for any run-time commands
     if (sys.abort) { return; } // Bail, if system abort.
-    if ( plan_check_full_buffer() ) { protocol_auto_cycle_start(); } // Auto-cycle start when buffer is full.
+    if ( plan_check_full_buffer() ) {
+      protocol_auto_cycle_start(); // Auto-cycle start when buffer is full.
+      #ifdef PLANNER_RECALC_BUDGET_US
+        plan_recalculate_resume(); // Use the wait to finish any budgeted replanning.
+      #endif
+    }
     else { break; }
   } while (1);
+  #ifdef REPORT_FIELD_STARVATION
+    system_add_planner_wait(micros() - wait_start);
+  #endif
+  #endif
 
   #ifdef MASLOWCNC
 //  MASLOW is circular in motion, so long lines must be divided up
@@ -84,36 +182,69 @@ void mc_line(float *target, plan_line_data_t *pl_data)
 
     if((abs(deltax) > (float)(0.0)) || (abs(deltay) > (float)0.0))  // don't segment z-only moves
     {
-      float deltaLong = max( abs(deltax) , (max( abs(deltay), abs(deltaz))));
-
-      int32_t segs = (int32_t) lround(deltaLong / MAX_SEG_LENGTH_MM);
-      if(segs < 1) segs = 1;
-
-      float dx = deltax / (float)segs;
-      float dy = deltay / (float)segs;
-      float dz = deltaz / (float)segs;
-
-      // if (invert_feed_rate)
-      // {
-      //     feed_rate *= segs;
-      // } // compensate feedrate for multiple segments
-
-      while(segs-- > 0)  // break up line into short pieces
+      // The planner and stepper move each segment as a straight line in chain space, which bows away
+      // from the programmed cartesian line. Size every segment so that bow, measured at the segment
+      // midpoint and mapped back to x-y through the chain Jacobian, stays within the segment
+      // tolerance setting. The bow grows with the square of the segment length, so each new segment
+      // is predicted from the last one and only shrunk and retried when the estimate overshoots.
+      float lineLength = sqrtf(deltax*deltax + deltay*deltay);
+      float segLength = MIN_SEG_LENGTH_MM;
+      float t = 0.0, tNext;
+      float aStart, bStart, aEnd, bEnd, aMid, bMid;
+
+      positionToChain(cpos[X_AXIS], cpos[Y_AXIS], &aStart, &bStart);
+
+      while(t < 1.0)  // break up line into short pieces
       {
-        cpos[X_AXIS] += dx;
-        cpos[Y_AXIS] += dy;
-        cpos[Z_AXIS] += dz;
-
-        // If the buffer is full remain in this loop until there is room in the buffer.
-        do {
-          protocol_execute_realtime(); // Check for any run-time commands
-          if (sys.abort) { return; } // Bail, if system abort.
-          if ( plan_check_full_buffer() ) { protocol_auto_cycle_start(); } // Auto-cycle start when buffer is full.
-          else { break; }
-        } while (1);
-
-        // Plan and queue motion into planner buffer MAX_SEG_LENGTH_MM segments to plan buffer..
-        if (plan_buffer_line(cpos, pl_data) == PLAN_EMPTY_BLOCK) {
+        tNext = t + (segLength / lineLength);
+        if(tNext > 1.0) tNext = 1.0;
+        float thisLength = (tNext - t) * lineLength;
+
+        float xEnd = target[X_AXIS] - deltax*(1.0f - tNext);
+        float yEnd = target[Y_AXIS] - deltay*(1.0f - tNext);
+        float xMid = target[X_AXIS] - deltax*(1.0f - 0.5f*(t + tNext));
+        float yMid = target[Y_AXIS] - deltay*(1.0f - 0.5f*(t + tNext));
+
+        positionToChain(xEnd, yEnd, &aEnd, &bEnd);
+        positionToChain(xMid, yMid, &aMid, &bMid);
+
+        // Chord bow in chain space, then in x-y.
+        float xBow, yBow;
+        mc_chain_error_to_xy(xMid, yMid, 0.5f*(aStart + aEnd) - aMid, 0.5f*(bStart + bEnd) - bMid, &xBow, &yBow);
+        float bow = sqrtf(xBow*xBow + yBow*yBow);
+
+        float scale = 2.0;
+        if(bow > 0.0) { scale = min(2.0f, 0.9f*sqrtf(settings.segmentTolerance / bow)); }
+
+        if((bow > settings.segmentTolerance) && (thisLength > MIN_SEG_LENGTH_MM))
+        {
+          segLength = max(MIN_SEG_LENGTH_MM, thisLength * max(0.25f, scale)); // too long, retry shorter
+          continue;
+        }
+        segLength = min(MAX_SEG_LENGTH_MM, max(MIN_SEG_LENGTH_MM, thisLength * scale));
+
+        cpos[X_AXIS] = xEnd;
+        cpos[Y_AXIS] = yEnd;
+        cpos[Z_AXIS] = target[Z_AXIS] - deltaz*(1.0f - tNext);
+        t = tNext;
+        aStart = aEnd;
+        bStart = bEnd;
+
+        float chain[2] = { aEnd, bEnd }; // Chain lengths of the segment end, reused by the planner.
+        mc_plan_chain_segment(cpos, chain, pl_data);
+        if (sys.abort) { return; } // Bail, if system abort.
+      }
+    }
+    else
+    {
+      #ifdef PLAN_SEGMENT_QUEUE_SIZE
+        // Queued behind any segments still waiting, to keep the motions in order.
+        float chain[2];
+        positionToChain(target[X_AXIS], target[Y_AXIS], &chain[LEFT_MOTOR], &chain[RIGHT_MOTOR]);
+        mc_queue_segment(target, chain, pl_data);
+      #else
+        // Plan and queue motion into planner buffer
+        if (plan_buffer_line(target, pl_data) == PLAN_EMPTY_BLOCK) {
           if (bit_istrue(settings.flags,BITFLAG_LASER_MODE)) {
             // Correctly set spindle state, if there is a coincident position passed. Forces a buffer
             // sync while in M3 laser mode only.
@@ -121,21 +252,8 @@ void mc_line(float *target, plan_line_data_t *pl_data)
               spindle_sync(PL_COND_FLAG_SPINDLE_CW, pl_data->spindle_speed);
             }
           }
-      }
-      }
-    }
-    else
-    {
-      // Plan and queue motion into planner buffer
-      if (plan_buffer_line(target, pl_data) == PLAN_EMPTY_BLOCK) {
-        if (bit_istrue(settings.flags,BITFLAG_LASER_MODE)) {
-          // Correctly set spindle state, if there is a coincident position passed. Forces a buffer
-          // sync while in M3 laser mode only.
-          if (pl_data->condition & PL_COND_FLAG_SPINDLE_CW) {
-            spindle_sync(PL_COND_FLAG_SPINDLE_CW, pl_data->spindle_speed);
-          }
         }
-      }
+      #endif
     }
 
   #else
@@ -154,6 +272,124 @@ void mc_line(float *target, plan_line_data_t *pl_data)
 }
 
 
+#ifdef ARC_CHAIN_SEGMENTATION
+// Splits an arc directly into the segments the planner moves straight in chain space, in one
+// pass. The error of each segment is measured at its midpoint, between the arc and the point the
+// straight chain-space move passes through, so the chord and the chain bow are held to one
+// tolerance and may partly cancel. Segment lengths are predicted as in mc_line(), but may go
+// below MIN_SEG_LENGTH_MM down to the chord that arc_tolerance alone allows on small radii.
+static void mc_arc_chain(float *target, plan_line_data_t *pl_data, float *position, float *offset,
+  float radius, float angular_travel, uint8_t axis_0, uint8_t axis_1, uint8_t axis_linear)
+{
+  float travel = fabsf(angular_travel);
+  float chord = travel*radius;
+  uint16_t segments = floor(0.5f*chord/sqrt(settings.arc_tolerance*(2*radius - settings.arc_tolerance)));
+  if (segments == 0) {
+    mc_line(target, pl_data); // Shorter than one chord. A line, segmented for the chain bow.
+    return;
+  }
+  float min_length = min(MIN_SEG_LENGTH_MM, chord/segments);
+  float max_angle = max(ARC_CHAIN_MAX_ANGLE, travel/segments); // Never more segments than chords.
+  float tolerance = settings.arc_tolerance + settings.segmentTolerance;
+
+  float center_axis0 = position[axis_0] + offset[axis_0];
+  float center_axis1 = position[axis_1] + offset[axis_1];
+  float linear_start = position[axis_linear];
+  float linear_travel = target[axis_linear] - linear_start;
+
+  // The whole arc in 1/F minutes is the same feed rate for every segment.
+  if (pl_data->condition & PL_COND_FLAG_INVERSE_TIME) {
+    pl_data->feed_rate *= sqrtf(chord*chord + linear_travel*linear_travel);
+    bit_false(pl_data->condition,PL_COND_FLAG_INVERSE_TIME); // Force as feed absolute mode over arc segments.
+  }
+
+  float r_axis0 = -offset[axis_0];  // Radius vector from center to the segment start.
+  float r_axis1 = -offset[axis_1];
+  float mid[N_AXIS], end[N_AXIS];
+  float aStart, bStart, aMid, bMid, aEnd, bEnd;
+  positionToChain(position[X_AXIS], position[Y_AXIS], &aStart, &bStart);
+  memcpy(mid, position, sizeof(mid));
+  memcpy(end, position, sizeof(end));
+
+  float seg_length = min_length;
+  float theta = 0.0;  // Angle travelled at the segment start.
+  uint8_t count = 0;
+  while (theta < travel) {
+    // Rotate the radius vector by half a segment twice, by the same small angle approximation as
+    // below, for the midpoint and the end. The last segment ends exactly on the target.
+    float step = min(seg_length/radius, max_angle);
+    uint8_t last = (theta + step >= travel);
+    if (last) { step = travel - theta; }
+    float half = (angular_travel < 0.0f) ? -0.5f*step : 0.5f*step;
+    float cos_T = 2.0f - half*half;
+    float sin_T = half*0.16666667f*(cos_T + 4.0f);
+    cos_T *= 0.5f;
+    float m_axis0 = r_axis0*cos_T - r_axis1*sin_T;
+    float m_axis1 = r_axis0*sin_T + r_axis1*cos_T;
+    float e_axis0 = m_axis0*cos_T - m_axis1*sin_T;
+    float e_axis1 = m_axis0*sin_T + m_axis1*cos_T;
+
+    mid[axis_0] = center_axis0 + m_axis0;
+    mid[axis_1] = center_axis1 + m_axis1;
+    mid[axis_linear] = linear_start + linear_travel*(theta + 0.5f*step)/travel;
+    if (last) {
+      memcpy(end, target, sizeof(end));
+    } else {
+      end[axis_0] = center_axis0 + e_axis0;
+      end[axis_1] = center_axis1 + e_axis1;
+      end[axis_linear] = linear_start + linear_travel*(theta + step)/travel;
+    }
+    positionToChain(end[X_AXIS], end[Y_AXIS], &aEnd, &bEnd);
+    positionToChain(mid[X_AXIS], mid[Y_AXIS], &aMid, &bMid);
+
+    // Error in x-y from the chain lengths, and in z, which moves linearly, from the midpoint.
+    float xErr, yErr;
+    mc_chain_error_to_xy(mid[X_AXIS], mid[Y_AXIS], 0.5f*(aStart + aEnd) - aMid, 0.5f*(bStart + bEnd) - bMid, &xErr, &yErr);
+    float zErr = 0.5f*(position[Z_AXIS] + end[Z_AXIS]) - mid[Z_AXIS];
+    float error = sqrtf(xErr*xErr + yErr*yErr + zErr*zErr);
+
+    float this_length = step*radius;
+    float scale = 2.0;
+    if (error > 0.0) { scale = min(2.0f, 0.9f*sqrtf(tolerance / error)); }
+    if ((error > tolerance) && (this_length > min_length)) {
+      seg_length = max(min_length, this_length * max(0.25f, scale)); // too long, retry shorter
+      continue;
+    }
+    seg_length = min(MAX_SEG_LENGTH_MM, max(min_length, this_length * scale));
+
+    theta += step;
+    if (++count < N_ARC_CORRECTION) {
+      r_axis0 = e_axis0;
+      r_axis1 = e_axis1;
+    } else {
+      // Arc correction to radius vector, from the initial radius vector(=-offset).
+      float theta_i = (angular_travel < 0.0f) ? -theta : theta;
+      float cos_Ti = cos(theta_i);
+      float sin_Ti = sin(theta_i);
+      r_axis0 = -offset[axis_0]*cos_Ti + offset[axis_1]*sin_Ti;
+      r_axis1 = -offset[axis_0]*sin_Ti - offset[axis_1]*cos_Ti;
+      count = 0;
+    }
+
+    // If enabled, check for soft limit violations, as mc_line() does for each line.
+    if (bit_istrue(settings.flags,BITFLAG_SOFT_LIMIT_ENABLE)) {
+      limits_soft_check(end);
+      if (sys.abort) { return; }
+    }
+    memcpy(position, end, sizeof(end));
+    aStart = aEnd;
+    bStart = bEnd;
+
+    // If in check gcode mode, prevent motion by blocking planner. Soft limits still work.
+    if (sys.state == STATE_CHECK_MODE) { continue; }
+    float chain[2] = { aEnd, bEnd }; // Chain lengths of the segment end, reused by the planner.
+    mc_plan_chain_segment(end, chain, pl_data);
+    if (sys.abort) { return; } // Bail mid-circle on system abort.
+  }
+}
+#endif
+
+
 // Execute an arc in offset mode format. position == current xyz, target == target xyz,
 // offset == offset from current xyz, axis_X defines circle plane in tool space, axis_linear is
 // the direction of helical travel, radius == circle radius, isclockwise boolean. Used
@@ -179,6 +415,10 @@ void mc_arc(float *target, plan_line_data_t *pl_data, float *position, float *of
     if (angular_travel <= ARC_ANGULAR_TRAVEL_EPSILON) { angular_travel += 2*M_PI; }
   }
 
+  #ifdef ARC_CHAIN_SEGMENTATION
+    mc_arc_chain(target, pl_data, position, offset, radius, angular_travel, axis_0, axis_1, axis_linear);
+  #else
+
   // NOTE: Segment end points are on the arc, which can lead to the arc diameter being smaller by up to
   // (2x) settings.arc_tolerance. For 99% of users, this is just fine. If a different arc segment fit
   // is desired, i.e. least-squares, midpoint on arc, just change the mm_per_arc_segment calculation.
@@ -265,6 +505,7 @@ void mc_arc(float *target, plan_line_data_t *pl_data, float *position, float *of
   }
   // Ensure last segment arrives at target location.
   mc_line(target, pl_data);
+  #endif
 }
 
 
@@ -29,14 +29,87 @@
 #endif
 
 static plan_block_t block_buffer[BLOCK_BUFFER_SIZE];  // A ring buffer for motion instructions
-static uint8_t block_buffer_tail;     // Index of the block to process now
-static uint8_t block_buffer_head;     // Index of the next block to be pushed
-static uint8_t next_buffer_head;      // Index of the next buffer head
-static uint8_t block_buffer_planned;  // Index of the optimally planned block
+static plan_index_t block_buffer_tail;     // Index of the block to process now
+static plan_index_t block_buffer_head;     // Index of the next block to be pushed
+static plan_index_t next_buffer_head;      // Index of the next buffer head
+static plan_index_t block_buffer_planned;  // Index of the optimally planned block
+
+#ifdef PLANNER_RECALC_BUDGET_US
+  // Time budgeted recalculation state. When the reverse pass runs out of time, the blocks from
+  // block_buffer_planned up to block_buffer_resume keep their previous (lower, but still feasible)
+  // entry speeds until plan_recalculate_resume() or the next planner_recalculate() gets to them.
+  static uint8_t recalc_pending;            // Reverse pass was cut short. (boolean)
+  static plan_index_t block_buffer_resume;  // Next block for the reverse pass to plan when pending.
+  plan_recalc_stats_t plan_recalc_stats;
+#endif
+
+#ifdef PLAN_SEGMENT_QUEUE_SIZE
+  // Parse-ahead queue of segmented lines waiting for room in the planner buffer.
+  typedef struct {
+    float target[N_AXIS];     // Machine position in mm.
+    float chain[2];           // Chain lengths of the target in mm, from segmenting.
+    plan_line_data_t pl_data;
+  } plan_queued_line_t;
+  static plan_queued_line_t queue[PLAN_SEGMENT_QUEUE_SIZE];
+  static plan_index_t queue_tail;  // Next line to plan.
+  static plan_index_t queue_count; // Lines queued.
+#endif
+
+
+#ifdef JACOBIAN_FEED_LIMITS
+  // Chain Jacobian at the start of the block being planned, for its junction. False where the block
+  // is planned in chain space.
+  static float plan_jacobian[4];
+  static uint8_t plan_jacobian_valid;
+#endif
+
+#ifdef CARTESIAN_PLANNING
+  // Plans the block along its x-y-z move rather than its chain moves. Sets 'path_vec' to the x-y-z
+  // unit vector and scales the chain deltas in 'chain_vec' to chain mm per path mm, so the axis
+  // rate and acceleration limits still hold for each motor. Returns the x-y-z length. Where step
+  // rounding leaves a move of a few steps with less path than chain, plans it in chain space.
+  static float plan_path_vectors(float *target, float *chain_vec, float *path_vec)
+  {
+    path_vec[X_AXIS] = target[X_AXIS] - pl.xy_position[X_AXIS];
+    path_vec[Y_AXIS] = target[Y_AXIS] - pl.xy_position[Y_AXIS];
+    path_vec[Z_AXIS] = chain_vec[Z_AXIS]; // Z moves straight, from its rounded steps.
+    float chain_mm = sqrt(chain_vec[X_AXIS]*chain_vec[X_AXIS] + chain_vec[Y_AXIS]*chain_vec[Y_AXIS] + chain_vec[Z_AXIS]*chain_vec[Z_AXIS]);
+    float path_mm = sqrt(path_vec[X_AXIS]*path_vec[X_AXIS] + path_vec[Y_AXIS]*path_vec[Y_AXIS] + path_vec[Z_AXIS]*path_vec[Z_AXIS]);
+    uint8_t chain_space = (2.0*path_mm < chain_mm); // Chains move at most sqrt(2) times the path, less rounding.
+    if (chain_space) {
+      memcpy(path_vec, chain_vec, N_AXIS*sizeof(float));
+      path_mm = chain_mm;
+    }
+    float inv_path_mm = 1.0/path_mm;
+    uint8_t idx;
+    for (idx=0; idx<N_AXIS; idx++) {
+      path_vec[idx] *= inv_path_mm;
+      chain_vec[idx] *= inv_path_mm;
+    }
+
+    #ifdef JACOBIAN_FEED_LIMITS
+      // The chain mm per path mm above is the average over the block. It changes along the block
+      // with the angle of the chains, so take the local rate at either end where it is higher.
+      plan_jacobian_valid = !chain_space;
+      if (plan_jacobian_valid) {
+        float end_jacobian[4];
+        chainJacobian(pl.xy_position[X_AXIS], pl.xy_position[Y_AXIS], plan_jacobian);
+        chainJacobian(target[X_AXIS], target[Y_AXIS], end_jacobian);
+        for (idx=LEFT_MOTOR; idx<=RIGHT_MOTOR; idx++) {
+          float rate_start = fabs(plan_jacobian[2*idx]*path_vec[X_AXIS] + plan_jacobian[2*idx+1]*path_vec[Y_AXIS]);
+          float rate_end = fabs(end_jacobian[2*idx]*path_vec[X_AXIS] + end_jacobian[2*idx+1]*path_vec[Y_AXIS]);
+          float rate = max(rate_start, rate_end);
+          if (rate > fabs(chain_vec[idx])) { chain_vec[idx] = (chain_vec[idx] < 0.0) ? -rate : rate; }
+        }
+      }
+    #endif
+    return(path_mm);
+  }
+#endif
 
 
 // Returns the index of the next block in the ring buffer. Also called by stepper segment buffer.
-uint8_t plan_next_block_index(uint8_t block_index)
+plan_index_t plan_next_block_index(plan_index_t block_index)
 {
   block_index++;
   if (block_index == BLOCK_BUFFER_SIZE) { block_index = 0; }
@@ -45,7 +118,7 @@ uint8_t plan_next_block_index(uint8_t block_index)
 
 
 // Returns the index of the previous block in the ring buffer
-static uint8_t plan_prev_block_index(uint8_t block_index)
+static plan_index_t plan_prev_block_index(plan_index_t block_index)
 {
   if (block_index == 0) { block_index = BLOCK_BUFFER_SIZE; }
   block_index--;
@@ -118,10 +191,54 @@ static uint8_t plan_prev_block_index(uint8_t block_index)
   ARM versions should have enough memory and speed for look-ahead blocks numbering up to a hundred or more.
 
 */
+// Forward Pass: Forward plan the acceleration curve from block_index onward, up to but not including
+// end_index. Also scans for optimal plan breakpoints and appropriately updates the planned pointer.
+static void planner_forward_pass(plan_index_t block_index, plan_index_t end_index)
+{
+  float entry_speed_sqr;
+  plan_block_t *current;
+  plan_block_t *next = &block_buffer[block_index]; // Begin at the first block to replan
+  block_index = plan_next_block_index(block_index);
+  while (block_index != end_index) {
+    current = next;
+    next = &block_buffer[block_index];
+
+    // Any acceleration detected in the forward pass automatically moves the optimal planned
+    // pointer forward, since everything before this is all optimal. In other words, nothing
+    // can improve the plan from the buffer tail to the planned pointer by logic.
+    // NOTE: Not while a budgeted reverse pass is pending. The blocks it has yet to reach are
+    // feasible, but not optimal.
+    if (current->entry_speed_sqr < next->entry_speed_sqr) {
+      entry_speed_sqr = current->entry_speed_sqr + 2*current->acceleration*current->millimeters;
+      // If true, current block is full-acceleration and we can move the planned pointer forward.
+      if (entry_speed_sqr < next->entry_speed_sqr) {
+        next->entry_speed_sqr = entry_speed_sqr; // Always <= max_entry_speed_sqr. Backward pass sets this.
+        #ifdef PLANNER_RECALC_BUDGET_US
+          if (!recalc_pending)
+        #endif
+        block_buffer_planned = block_index; // Set optimal plan pointer.
+      }
+    }
+
+    // Any block set at its maximum entry speed also creates an optimal plan up to this
+    // point in the buffer. When the plan is bracketed by either the beginning of the
+    // buffer and a maximum entry speed or two maximum entry speeds, every block in between
+    // cannot logically be further improved. Hence, we don't have to recompute them anymore.
+    if (next->entry_speed_sqr == next->max_entry_speed_sqr) {
+      #ifdef PLANNER_RECALC_BUDGET_US
+        if (!recalc_pending)
+      #endif
+      block_buffer_planned = block_index;
+    }
+    block_index = plan_next_block_index( block_index );
+  }
+}
+
+
 static void planner_recalculate()
 {
   // Initialize block index to the last block in the planner buffer.
-  uint8_t block_index = plan_prev_block_index(block_buffer_head);
+  plan_index_t block_index = plan_prev_block_index(block_buffer_head);
 
   // Bail. Can't do anything with one only one plan-able block.
   if (block_index == block_buffer_planned) { return; }
@@ -136,12 +253,27 @@ static void planner_recalculate()
   // Calculate maximum entry speed for last block in buffer, where the exit speed is always zero.
   current->entry_speed_sqr = min( current->max_entry_speed_sqr, 2*current->acceleration*current->millimeters);
 
+  #ifdef PLANNER_RECALC_BUDGET_US
+    // A reverse pass from the new head supersedes any pass left unfinished.
+    recalc_pending = false;
+    uint32_t start_time = micros();
+  #endif
+
   block_index = plan_prev_block_index(block_index);
   if (block_index == block_buffer_planned) { // Only two plannable blocks in buffer. Reverse pass complete.
     // Check if the first block is the tail. If so, notify stepper to update its current parameters.
     if (block_index == block_buffer_tail) { st_update_plan_block_parameters(); }
   } else { // Three or more plan-able blocks
     while (block_index != block_buffer_planned) {
+      #ifdef PLANNER_RECALC_BUDGET_US
+        // Out of time. Leave the older blocks on their previous plan and note where to pick up.
+        if ((micros()-start_time) > PLANNER_RECALC_BUDGET_US) {
+          recalc_pending = true;
+          block_buffer_resume = block_index;
+          plan_recalc_stats.budget_exhausted++;
+          break;
+        }
+      #endif
       next = current;
       current = &block_buffer[block_index];
       block_index = plan_prev_block_index(block_index);
@@ -161,34 +293,61 @@ static void planner_recalculate()
     }
   }
 
-  // Forward Pass: Forward plan the acceleration curve from the planned pointer onward.
-  // Also scans for optimal plan breakpoints and appropriately updates the planned pointer.
-  next = &block_buffer[block_buffer_planned]; // Begin at buffer planned pointer
-  block_index = plan_next_block_index(block_buffer_planned);
-  while (block_index != block_buffer_head) {
-    current = next;
-    next = &block_buffer[block_index];
+  #ifdef PLANNER_RECALC_BUDGET_US
+    // Blocks before the resume point are unchanged and already forward planned.
+    if (recalc_pending) {
+      planner_forward_pass(block_buffer_resume, block_buffer_head);
+      return;
+    }
+  #endif
+  planner_forward_pass(block_buffer_planned, block_buffer_head);
+}
 
-    // Any acceleration detected in the forward pass automatically moves the optimal planned
-    // pointer forward, since everything before this is all optimal. In other words, nothing
-    // can improve the plan from the buffer tail to the planned pointer by logic.
-    if (current->entry_speed_sqr < next->entry_speed_sqr) {
-      entry_speed_sqr = current->entry_speed_sqr + 2*current->acceleration*current->millimeters;
-      // If true, current block is full-acceleration and we can move the planned pointer forward.
-      if (entry_speed_sqr < next->entry_speed_sqr) {
-        next->entry_speed_sqr = entry_speed_sqr; // Always <= max_entry_speed_sqr. Backward pass sets this.
-        block_buffer_planned = block_index; // Set optimal plan pointer.
+
+#ifdef PLANNER_RECALC_BUDGET_US
+// Continues a reverse pass that planner_recalculate() ran out of time for, again within the time
+// budget. Called while waiting on a full planner buffer, when there is otherwise nothing to do.
+// NOTE: Plans back from the stored, forward planned entry speed of the block after the resume
+// point, so the result can always decelerate into it. Entry speeds before that junction can only
+// go up, so the forward pass only has to be redone up to the block after the old resume point.
+// Any speed still left on the table there is recovered by the next planner_recalculate().
+void plan_recalculate_resume()
+{
+  if (!recalc_pending) { return; }
+  plan_recalc_stats.resumes++;
+  recalc_pending = false;
+  uint32_t start_time = micros();
+
+  plan_index_t block_index = block_buffer_resume;
+  plan_index_t end_index = plan_next_block_index(plan_next_block_index(block_buffer_resume));
+  float exit_speed_sqr = block_buffer[plan_next_block_index(block_buffer_resume)].entry_speed_sqr;
+  float entry_speed_sqr;
+  plan_block_t *current;
+  while (block_index != block_buffer_planned) {
+    if ((micros()-start_time) > PLANNER_RECALC_BUDGET_US) {
+      recalc_pending = true;
+      block_buffer_resume = block_index;
+      plan_recalc_stats.budget_exhausted++;
+      break;
+    }
+    current = &block_buffer[block_index];
+    block_index = plan_prev_block_index(block_index);
+    if (block_index == block_buffer_tail) { st_update_plan_block_parameters(); }
+    if (current->entry_speed_sqr != current->max_entry_speed_sqr) {
+      entry_speed_sqr = exit_speed_sqr + 2*current->acceleration*current->millimeters;
+      if (entry_speed_sqr < current->max_entry_speed_sqr) {
+        current->entry_speed_sqr = entry_speed_sqr;
+      } else {
+        current->entry_speed_sqr = current->max_entry_speed_sqr;
       }
     }
-
-    // Any block set at its maximum entry speed also creates an optimal plan up to this
-    // point in the buffer. When the plan is bracketed by either the beginning of the
-    // buffer and a maximum entry speed or two maximum entry speeds, every block in between
-    // cannot logically be further improved. Hence, we don't have to recompute them anymore.
-    if (next->entry_speed_sqr == next->max_entry_speed_sqr) { block_buffer_planned = block_index; }
-    block_index = plan_next_block_index( block_index );
+    exit_speed_sqr = current->entry_speed_sqr;
   }
+
+  if (recalc_pending) { planner_forward_pass(block_buffer_resume, end_index); }
+  else { planner_forward_pass(block_buffer_planned, end_index); }
 }
+#endif
 
 
 void plan_reset()
@@ -204,15 +363,26 @@ void plan_reset_buffer()
   block_buffer_head = 0; // Empty = tail
   next_buffer_head = 1; // plan_next_block_index(block_buffer_head)
   block_buffer_planned = 0; // = block_buffer_tail;
+  #ifdef PLANNER_RECALC_BUDGET_US
+    recalc_pending = false;
+  #endif
+  #ifdef PLAN_SEGMENT_QUEUE_SIZE
+    queue_tail = 0;
+    queue_count = 0;
+  #endif
 }
 
 
 void plan_discard_current_block()
 {
   if (block_buffer_head != block_buffer_tail) { // Discard non-empty buffer.
-    uint8_t block_index = plan_next_block_index( block_buffer_tail );
+    plan_index_t block_index = plan_next_block_index( block_buffer_tail );
     // Push block_buffer_planned pointer, if encountered.
     if (block_buffer_tail == block_buffer_planned) { block_buffer_planned = block_index; }
+    #ifdef PLANNER_RECALC_BUDGET_US
+      // Nothing left to replan once execution catches up with the resume point.
+      if (block_buffer_planned == block_buffer_resume) { recalc_pending = false; }
+    #endif
     block_buffer_tail = block_index;
   }
 }
@@ -235,7 +405,7 @@ plan_block_t *plan_get_current_block()
 
 float plan_get_exec_block_exit_speed_sqr()
 {
-  uint8_t block_index = plan_next_block_index(block_buffer_tail);
+  plan_index_t block_index = plan_next_block_index(block_buffer_tail);
   if (block_index == block_buffer_head) { return( 0.0 ); }
   return( block_buffer[block_index].entry_speed_sqr );
 }
@@ -278,7 +448,7 @@ static void plan_compute_profile_parameters(plan_block_t *block, float nominal_s
 // Re-calculates buffered motions profile parameters upon a motion-based override change.
 void plan_update_velocity_profile_parameters()
 {
-  uint8_t block_index = block_buffer_tail;
+  plan_index_t block_index = block_buffer_tail;
   plan_block_t *block;
   float nominal_speed;
   float prev_nominal_speed = SOME_LARGE_VALUE; // Set high for first block nominal speed calculation.
@@ -307,14 +477,33 @@ void plan_update_velocity_profile_parameters()
    head. It avoids changing the planner state and preserves the buffer to ensure subsequent gcode
    motions are still planned correctly, while the stepper module only points to the block buffer head
    to execute the special system motion. */
+#ifdef MASLOWCNC
 uint8_t plan_buffer_line(float *target, plan_line_data_t *pl_data)
 {
+  float chain[2];
+  // tranformation of target[X],[Y] in mm -- returns chain lengths in mm
+  positionToChain(target[X_AXIS], target[Y_AXIS], &chain[LEFT_MOTOR], &chain[RIGHT_MOTOR]);
+  return(plan_buffer_chain_line(target, chain, pl_data));
+}
+
+
+// As plan_buffer_line(), with the chain lengths of the target already known, i.e. from segmenting.
+uint8_t plan_buffer_chain_line(float *target, float *chain, plan_line_data_t *pl_data)
+#else
+uint8_t plan_buffer_line(float *target, plan_line_data_t *pl_data)
+#endif
+{
+  PROFILE_FUNCTION(PROFILE_PLAN);
   // Prepare and initialize new block. Copy relevant pl_data for block execution.
   plan_block_t *block = &block_buffer[block_buffer_head];
   memset(block,0,sizeof(plan_block_t)); // Zero all block values.
   block->condition = pl_data->condition;
   block->spindle_speed = pl_data->spindle_speed;
   block->line_number = pl_data->line_number;
+  #ifdef REPORT_MPOS_PLANNER_TARGET
+    block->xy_target[X_AXIS] = target[X_AXIS];
+    block->xy_target[Y_AXIS] = target[Y_AXIS];
+  #endif
 
   // Compute and store initial move distance data.
   int32_t target_steps[N_AXIS], position_steps[N_AXIS];
@@ -340,9 +529,7 @@ uint8_t plan_buffer_line(float *target, plan_line_data_t *pl_data)
   #endif
 
   #ifdef MASLOWCNC
-    float leftLen, rightLen;
-    // tranformation of target[X],[Y] in mm -- returns chain lengths in mm
-    positionToChain((float) (target[X_AXIS]),(float) (target[Y_AXIS]), &leftLen, &rightLen);
+    float leftLen = chain[LEFT_MOTOR], rightLen = chain[RIGHT_MOTOR];
 
     target_steps[LEFT_MOTOR] = (int32_t) lround(leftLen * settings.steps_per_mm[LEFT_MOTOR]);
     block->steps[LEFT_MOTOR] = labs((target_steps[LEFT_MOTOR]-pl.position[LEFT_MOTOR]));
@@ -418,7 +605,22 @@ uint8_t plan_buffer_line(float *target, plan_line_data_t *pl_data)
   // down such that no individual axes maximum values are exceeded with respect to the line direction.
   // NOTE: This calculation assumes all axes are orthogonal (Cartesian) and works with ABC-axes,
   // if they are also orthogonal/independent. Operates on the absolute value of the unit vector.
-  block->millimeters = convert_delta_vector_to_unit_vector(unit_vec);
+  #ifdef CARTESIAN_PLANNING
+    // Block length, feed rate and junctions are along the x-y-z path of the sled. The limits are
+    // taken on the chains, moved at unit_vec[] chain mm per path mm.
+    float path_vec[N_AXIS];
+    if (block->condition & PL_COND_FLAG_SYSTEM_MOTION) { // Homing and parking motions stay in chain space.
+      block->millimeters = convert_delta_vector_to_unit_vector(unit_vec);
+      memcpy(path_vec, unit_vec, sizeof(unit_vec));
+      #ifdef JACOBIAN_FEED_LIMITS
+        plan_jacobian_valid = false;
+      #endif
+    } else {
+      block->millimeters = plan_path_vectors(target, unit_vec, path_vec);
+    }
+  #else
+    block->millimeters = convert_delta_vector_to_unit_vector(unit_vec);
+  #endif
   block->acceleration = limit_value_by_axis_maximum(settings.acceleration, unit_vec);
   block->rapid_rate = limit_value_by_axis_maximum(settings.max_rate, unit_vec);
 
@@ -462,10 +664,20 @@ uint8_t plan_buffer_line(float *target, plan_line_data_t *pl_data)
 
     float junction_unit_vec[N_AXIS];
     float junction_cos_theta = 0.0;
-    for (idx=0; idx<N_AXIS; idx++) {
-      junction_cos_theta -= pl.previous_unit_vec[idx]*unit_vec[idx];
-      junction_unit_vec[idx] = unit_vec[idx]-pl.previous_unit_vec[idx];
-    }
+    #ifdef CARTESIAN_PLANNING
+      // Corner of the sled path. Its centripetal acceleration is limited on the chains below.
+      float junction_chain_vec[N_AXIS];
+      for (idx=0; idx<N_AXIS; idx++) {
+        junction_cos_theta -= pl.previous_path_vec[idx]*path_vec[idx];
+        junction_unit_vec[idx] = path_vec[idx]-pl.previous_path_vec[idx];
+        junction_chain_vec[idx] = unit_vec[idx]-pl.previous_unit_vec[idx];
+      }
+    #else
+      for (idx=0; idx<N_AXIS; idx++) {
+        junction_cos_theta -= pl.previous_unit_vec[idx]*unit_vec[idx];
+        junction_unit_vec[idx] = unit_vec[idx]-pl.previous_unit_vec[idx];
+      }
+    #endif
 
     // NOTE: Computed without any expensive trig, sin() or acos(), by trig half angle identity of cos(theta).
     if (junction_cos_theta > 0.999999) {
@@ -476,11 +688,32 @@ uint8_t plan_buffer_line(float *target, plan_line_data_t *pl_data)
         // Junction is a straight line or 180 degrees. Junction speed is infinite.
         block->max_junction_speed_sqr = SOME_LARGE_VALUE;
       } else {
-        convert_delta_vector_to_unit_vector(junction_unit_vec);
-        float junction_acceleration = limit_value_by_axis_maximum(settings.acceleration, junction_unit_vec);
+        #ifdef CARTESIAN_PLANNING
+          // Chain acceleration per unit of path acceleration toward the corner.
+          float inv_magnitude = 1.0/convert_delta_vector_to_unit_vector(junction_unit_vec);
+          for (idx=0; idx<N_AXIS; idx++) { junction_chain_vec[idx] *= inv_magnitude; }
+          #ifdef JACOBIAN_FEED_LIMITS
+            if (plan_jacobian_valid) { // Exactly, with the Jacobian at the junction.
+              for (idx=LEFT_MOTOR; idx<=RIGHT_MOTOR; idx++) {
+                junction_chain_vec[idx] = plan_jacobian[2*idx]*junction_unit_vec[X_AXIS] + plan_jacobian[2*idx+1]*junction_unit_vec[Y_AXIS];
+              }
+            }
+          #endif
+          float junction_acceleration = limit_value_by_axis_maximum(settings.acceleration, junction_chain_vec);
+        #else
+          convert_delta_vector_to_unit_vector(junction_unit_vec);
+          float junction_acceleration = limit_value_by_axis_maximum(settings.acceleration, junction_unit_vec);
+        #endif
         float sin_theta_d2 = sqrt(0.5*(1.0-junction_cos_theta)); // Trig half angle identity. Always positive.
         block->max_junction_speed_sqr = max( MINIMUM_JUNCTION_SPEED*MINIMUM_JUNCTION_SPEED,
                        (junction_acceleration * settings.junction_deviation * sin_theta_d2)/(1.0-sin_theta_d2) );
+        #ifdef S_CURVE_ACCELERATION
+          // The S-curve smoothing crosses a junction at up to half the speed change over its window
+          // above the planned speed. Plan it that much lower.
+          float junction_speed = sqrt(block->max_junction_speed_sqr) - 0.5*block->acceleration*st_scurve_window();
+          if (junction_speed < MINIMUM_JUNCTION_SPEED) { junction_speed = MINIMUM_JUNCTION_SPEED; }
+          block->max_junction_speed_sqr = junction_speed*junction_speed;
+        #endif
       }
     }
   }
@@ -494,6 +727,11 @@ uint8_t plan_buffer_line(float *target, plan_line_data_t *pl_data)
     // Update previous path unit_vector and planner position.
     memcpy(pl.previous_unit_vec, unit_vec, sizeof(unit_vec)); // pl.previous_unit_vec[] = unit_vec[]
     memcpy(pl.position, target_steps, sizeof(target_steps)); // pl.position[] = target_steps[]
+    #ifdef CARTESIAN_PLANNING
+      memcpy(pl.previous_path_vec, path_vec, sizeof(path_vec));
+      pl.xy_position[X_AXIS] = target[X_AXIS];
+      pl.xy_position[Y_AXIS] = target[Y_AXIS];
+    #endif
 
     // New block is all set. Update buffer head and next buffer head indices.
     block_buffer_head = next_buffer_head;
@@ -525,11 +763,14 @@ void plan_sync_position()
         pl.position[idx] = sys_position[idx];
     #endif
   }
+  #ifdef CARTESIAN_PLANNING
+    system_convert_maslow_to_xy(pl.position, &pl.xy_position[X_AXIS], &pl.xy_position[Y_AXIS]);
+  #endif
 }
 
 
 // Returns the number of available blocks are in the planner buffer.
-uint8_t plan_get_block_buffer_available()
+plan_index_t plan_get_block_buffer_available()
 {
   if (block_buffer_head >= block_buffer_tail) { return((BLOCK_BUFFER_SIZE-1)-(block_buffer_head-block_buffer_tail)); }
   return((block_buffer_tail-block_buffer_head-1));
@@ -538,7 +779,7 @@ uint8_t plan_get_block_buffer_available()
 
 // Returns the number of active blocks are in the planner buffer.
 // NOTE: Deprecated. Not used unless classic status reports are enabled in config.h
-uint8_t plan_get_block_buffer_count()
+plan_index_t plan_get_block_buffer_count()
 {
   if (block_buffer_head >= block_buffer_tail) { return(block_buffer_head-block_buffer_tail); }
   return(BLOCK_BUFFER_SIZE - (block_buffer_tail-block_buffer_head));
@@ -554,3 +795,58 @@ void plan_cycle_reinitialize()
   block_buffer_planned = block_buffer_tail;
   planner_recalculate();
 }
+
+
+#ifdef PLAN_SEGMENT_QUEUE_SIZE
+// Adds a line to the parse-ahead queue. Assumes the queue has room. Checked by mc_line().
+void plan_queue_line(float *target, float *chain, plan_line_data_t *pl_data)
+{
+  plan_index_t queue_head = queue_tail + queue_count;
+  if (queue_head >= PLAN_SEGMENT_QUEUE_SIZE) { queue_head -= PLAN_SEGMENT_QUEUE_SIZE; }
+  memcpy(queue[queue_head].target, target, sizeof(queue[queue_head].target));
+  memcpy(queue[queue_head].chain, chain, sizeof(queue[queue_head].chain));
+  memcpy(&queue[queue_head].pl_data, pl_data, sizeof(plan_line_data_t));
+  queue_count++;
+}
+
+
+// Plans queued lines for as long as the planner buffer has room. Called by the main program only.
+void plan_queue_flush()
+{
+  static uint8_t flushing = false;
+  if (flushing) { return; } // The spindle sync below waits on the planner with the later lines held back.
+  flushing = true;
+  while (queue_count && !plan_check_full_buffer()) {
+    plan_queued_line_t *line = &queue[queue_tail];
+    uint8_t plan_status = plan_buffer_chain_line(line->target, line->chain, &line->pl_data);
+    uint8_t condition = line->pl_data.condition;
+    float spindle_speed = line->pl_data.spindle_speed;
+    if (++queue_tail == PLAN_SEGMENT_QUEUE_SIZE) { queue_tail = 0; }
+    queue_count--;
+    if (plan_status == PLAN_EMPTY_BLOCK) {
+      if (bit_istrue(settings.flags,BITFLAG_LASER_MODE)) {
+        // Correctly set spindle state, if there is a coincident position passed. Forces a buffer
+        // sync while in M3 laser mode only.
+        if (condition & PL_COND_FLAG_SPINDLE_CW) {
+          spindle_sync(PL_COND_FLAG_SPINDLE_CW, spindle_speed);
+        }
+      }
+    }
+  }
+  flushing = false;
+}
+
+
+// Returns the status of the parse-ahead queue. True, if full.
+uint8_t plan_check_full_queue()
+{
+  return(queue_count == PLAN_SEGMENT_QUEUE_SIZE);
+}
+
+
+// Returns the number of lines waiting in the parse-ahead queue.
+plan_index_t plan_get_queue_count()
+{
+  return(queue_count);
+}
+#endif
@@ -25,7 +25,17 @@
 
 // The number of linear motions that can be in the plan at any give time
 #ifndef BLOCK_BUFFER_SIZE
-  #define BLOCK_BUFFER_SIZE 36
+  #ifdef MASLOWCNC
+    #define BLOCK_BUFFER_SIZE 256 // The Due has the RAM for deep lookahead over short chain segments.
+  #else
+    #define BLOCK_BUFFER_SIZE 36
+  #endif
+#endif
+
+#ifdef MASLOWCNC
+  typedef uint16_t plan_index_t; // 16-bit ring indices allow planner depths past 255 blocks
+#else
+  typedef uint8_t plan_index_t;
 #endif
 
 // Returned status message from planner.
@@ -78,8 +88,16 @@ typedef struct {
 
   // Stored spindle speed data used by spindle overrides and resuming methods.
   float spindle_speed;    // Block spindle speed. Copied from pl_line_data.
+
+  #ifdef REPORT_MPOS_PLANNER_TARGET
+    // Cartesian X-Y end point of the block in mm, reported as the machine position while it runs.
+    float xy_target[2];
+  #endif
 } plan_block_t;
 
+// Planner block buffer RAM footprint. Reported by the $I build info on Maslow-Due.
+#define PLAN_BLOCK_BUFFER_BYTES (sizeof(plan_block_t)*BLOCK_BUFFER_SIZE)
+
 
 // Planner data prototype. Must be used when passing new motions to the planner.
 typedef struct {
@@ -97,6 +115,11 @@ typedef struct {
                                      // i.e. arcs, canned cycles, and backlash compensation.
   float previous_unit_vec[N_AXIS];   // Unit vector of previous path line segment
   float previous_nominal_speed;  // Nominal speed of previous path line segment
+  #ifdef CARTESIAN_PLANNING
+    float xy_position[2];            // The planner x-y position of the tool in mm.
+    float previous_path_vec[N_AXIS]; // x-y-z unit vector of previous path line segment. previous_unit_vec
+                                     // holds its chain mm per path mm.
+  #endif
 } planner_t;
 static planner_t pl;
 
@@ -110,6 +133,11 @@ void plan_reset_buffer(); // Reset buffer only.
 // rate is taken to mean "frequency" and would complete the operation in 1/feed_rate minutes.
 uint8_t plan_buffer_line(float *target, plan_line_data_t *pl_data);
 
+#ifdef MASLOWCNC
+  // As plan_buffer_line(), with the left and right chain lengths of the target in mm given.
+  uint8_t plan_buffer_chain_line(float *target, float *chain, plan_line_data_t *pl_data);
+#endif
+
 // Called when the current block is no longer needed. Discards the block and makes the memory
 // availible for new blocks.
 void plan_discard_current_block();
@@ -121,7 +149,7 @@ plan_block_t *plan_get_system_motion_block();
 plan_block_t *plan_get_current_block();
 
 // Called periodically by step segment buffer. Mostly used internally by planner.
-uint8_t plan_next_block_index(uint8_t block_index);
+plan_index_t plan_next_block_index(plan_index_t block_index);
 
 // Called by step segment buffer when computing executing block velocity profile.
 float plan_get_exec_block_exit_speed_sqr();
@@ -139,15 +167,41 @@ void plan_sync_position();
 void plan_cycle_reinitialize();
 
 // Returns the number of available blocks are in the planner buffer.
-uint8_t plan_get_block_buffer_available();
+plan_index_t plan_get_block_buffer_available();
 
 // Returns the number of active blocks are in the planner buffer.
 // NOTE: Deprecated. Not used unless classic status reports are enabled in config.h
-uint8_t plan_get_block_buffer_count();
+plan_index_t plan_get_block_buffer_count();
 
 // Returns the status of the block ring buffer. True, if buffer is full.
 uint8_t plan_check_full_buffer();
 
+#ifdef PLANNER_RECALC_BUDGET_US
+  // Budgeted recalculation counters. Reported by the $I build info.
+  typedef struct {
+    uint32_t budget_exhausted; // Reverse passes cut short by PLANNER_RECALC_BUDGET_US.
+    uint32_t resumes;          // Unfinished reverse passes picked back up by plan_recalculate_resume().
+  } plan_recalc_stats_t;
+  extern plan_recalc_stats_t plan_recalc_stats;
+
+  // Continues a reverse pass the last recalculation ran out of time for. Call when idle.
+  void plan_recalculate_resume();
+#endif
+
+#ifdef PLAN_SEGMENT_QUEUE_SIZE
+  // Parse-ahead queue of segmented lines between mc_line() and the planner buffer. Cleared with it.
+  void plan_queue_line(float *target, float *chain, plan_line_data_t *pl_data);
+
+  // Plans queued lines for as long as the planner buffer has room.
+  void plan_queue_flush();
+
+  // Returns the status of the parse-ahead queue. True, if full.
+  uint8_t plan_check_full_queue();
+
+  // Returns the number of lines waiting in the parse-ahead queue.
+  plan_index_t plan_get_queue_count();
+#endif
+
 void plan_get_planner_mpos(float *target);
 
 
@@ -26,8 +26,13 @@
 
 void printString(const char *s)
 {
-  while (*s)
-    serial_write(*s++);
+  size_t length = strlen(s);
+  while (length > 0) { // Whole string in one piece, unless longer than the TX buffer.
+    serial_index_t count = (length > TX_BUFFER_SIZE) ? TX_BUFFER_SIZE : length;
+    serial_write_block((const uint8_t *)s, count);
+    s += count;
+    length -= count;
+  }
 }
 
 
@@ -100,77 +105,64 @@ void print_uint8_base2_ndigit(uint8_t n, uint8_t digits) {
 }
 
 
-void print_uint32_base10(uint32_t n)
+// Generates the digits of a/10^decimal_places backwards into a string on the stack and hands it
+// to the TX buffer in one piece. The lowest 'zeros' digits print as zeros without taking digits
+// of a. Integer '%' and '/' by 10 are a multiply on the Due, so only the caller's scaling is float.
+static void print_fixed_digits(uint32_t a, uint8_t decimal_places, uint8_t zeros, uint8_t negative)
 {
-  if (n == 0) {
-    serial_write('0');
-    return;
+  char buf[4+PRINT_MAX_DECIMAL_PLACES]; // Sign, leading zero, point and 10 digits at most.
+  char *p = &buf[sizeof(buf)];
+  uint8_t i;
+  for (i = 0; (i <= decimal_places) || (a > 0); i++) {
+    if ((i == decimal_places) && (i > 0)) { *--p = '.'; } // Insert decimal point in right place.
+    if (i < zeros) { *--p = '0'; }
+    else {
+      *--p = '0' + (a % 10); // Get digit. Fills in zeros to decimal point for (n < 1).
+      a /= 10;
+    }
   }
+  if (negative) { *--p = '-'; }
+  serial_write_block((uint8_t *)p, &buf[sizeof(buf)] - p);
+}
 
-  unsigned char buf[10];
-  uint8_t i = 0;
-
-  while (n > 0) {
-    buf[i++] = n % 10;
-    n /= 10;
-  }
 
-  for (; i > 0; i--)
-    serial_write('0' + buf[i-1]);
+void print_uint32_base10(uint32_t n)
+{
+  print_fixed_digits(n, 0, 0, false);
 }
 
 
 void printInteger(long n)
 {
   if (n < 0) {
-    serial_write('-');
-    print_uint32_base10(-n);
+    print_fixed_digits(-(uint32_t)n, 0, 0, true);
   } else {
-    print_uint32_base10(n);
+    print_fixed_digits(n, 0, 0, false);
   }
 }
 
 
-// Convert float to string by immediately converting to a long integer, which contains
-// more digits than a float. Number of decimal places, which are tracked by a counter,
-// may be set by the user. The integer is then efficiently converted to a string.
-// NOTE: AVR '%' and '/' integer operations are very efficient. Bitshifting speed-up
-// techniques are actually just slightly slower. Found this out the hard way.
+// Convert float to string by scaling it once to an integer in units of the last decimal place,
+// which is then efficiently converted to a string. A float holds fewer digits than the integer,
+// so a value too large for it loses its lowest decimal places to zeros instead.
 void printFloat(float n, uint8_t decimal_places)
 {
-  if (n < 0) {
-    serial_write('-');
-    n = -n;
-  }
-
-  uint8_t decimals = decimal_places;
-  while (decimals >= 2) { // Quickly convert values expected to be E0 to E-4.
-    n *= 100;
-    decimals -= 2;
-  }
-  if (decimals) { n *= 10; }
-  n += 0.5; // Add rounding factor. Ensures carryover through entire value.
-
-  // Generate digits backwards and store in string.
-  unsigned char buf[13];
-  uint8_t i = 0;
-  uint32_t a = (long)n;
-  while(a > 0) {
-    buf[i++] = (a % 10) + '0'; // Get digit
-    a /= 10;
-  }
-  while (i < decimal_places) {
-     buf[i++] = '0'; // Fill in zeros to decimal point for (n < 1)
-  }
-  if (i == decimal_places) { // Fill in leading zero, if needed.
-    buf[i++] = '0';
-  }
-
-  // Print the generated string.
-  for (; i > 0; i--) {
-    if (i == decimal_places) { serial_write('.'); } // Insert decimal point in right place.
-    serial_write(buf[i-1]);
+  static const float pow10[PRINT_MAX_DECIMAL_PLACES+1] = {
+    1.0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+
+  uint8_t negative = (n < 0);
+  if (negative) { n = -n; }
+  if (decimal_places > PRINT_MAX_DECIMAL_PLACES) { decimal_places = PRINT_MAX_DECIMAL_PLACES; }
+
+  n *= pow10[decimal_places];
+  uint8_t zeros = 0;
+  while ((n >= 4294967040.0f) && (zeros < decimal_places)) { // Largest float below 2^32.
+    n *= 0.1f;
+    zeros++;
   }
+  uint32_t a = 0xFFFFFFFF;
+  if (n < 4294967040.0f) { a = (uint32_t)(n + 0.5f); } // Add rounding factor. Ensures carryover through entire value.
+  print_fixed_digits(a, decimal_places, zeros, negative);
 }
 
 
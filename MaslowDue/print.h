@@ -37,6 +37,9 @@ void print_uint8_base10(uint8_t n);
 // Prints an uint8 variable in base 2 with desired number of desired digits.
 void print_uint8_base2_ndigit(uint8_t n, uint8_t digits);
 
+// Most decimal places printFloat() prints. More are treated as this many.
+#define PRINT_MAX_DECIMAL_PLACES 10
+
 void printFloat(float n, uint8_t decimal_places);
 
 // Floating value printing handlers for special variables types used in Grbl.
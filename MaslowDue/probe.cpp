@@ -22,10 +22,33 @@
 
 #include "grbl.h"
 
+#ifdef MASLOWCNC
+#include "MaslowDue.h"
+#endif
+
 
 // Inverts the probe pin state depending on user settings and probing cycle mode.
 uint8_t probe_invert_mask;
 
+#ifdef MASLOWCNC
+  static Pio *probe_pio;        // PIO controller and bit of Probe_PIN, read directly by probe_get_state().
+  static uint32_t probe_pio_mask;
+
+  // Records the measured probe position at the instant the probe trips, not the planner position.
+  static void probe_latch_position()
+  {
+    system_get_measured_position(sys_probe_position);
+    sys_probe_state = PROBE_OFF;
+    bit_true(sys_rt_exec_state, EXEC_MOTION_CANCEL);
+  }
+
+  // Probe_PIN edge interrupt. Latches on the edge itself, not at the next stepper ISR tick.
+  static void probe_pin_handler()
+  {
+    if ((sys_probe_state == PROBE_ACTIVE) && probe_get_state()) { probe_latch_position(); }
+  }
+#endif
+
 
 // Probe pin initialization routine.
 void probe_init()
@@ -37,6 +60,15 @@ void probe_init()
     #else
       PROBE_PORT |= PROBE_MASK;    // Enable internal pull-up resistors. Normal high operation.
     #endif
+  #else
+    #ifdef DISABLE_PROBE_PIN_PULL_UP
+      pinMode(Probe_PIN, INPUT); // Normal low operation. Requires external pull-down.
+    #else
+      pinMode(Probe_PIN, INPUT_PULLUP); // Normal high operation.
+    #endif
+    probe_pio = g_APinDescription[Probe_PIN].pPort;
+    probe_pio_mask = g_APinDescription[Probe_PIN].ulPin;
+    attachInterrupt(digitalPinToInterrupt(Probe_PIN), probe_pin_handler, CHANGE);
   #endif
   probe_configure_invert_mask(false); // Initialize invert mask.
 }
@@ -56,7 +88,7 @@ void probe_configure_invert_mask(uint8_t is_probe_away)
 // Returns the probe pin state. Triggered = true. Called by gcode parser and probe state monitor.
 uint8_t probe_get_state() { 
   #ifdef MASLOWCNC
-    return 0;
+    return(((probe_pio->PIO_PDSR & probe_pio_mask) ? PROBE_MASK : 0) ^ probe_invert_mask);
   #else
     return((PROBE_PIN & PROBE_MASK) ^ probe_invert_mask); 
   #endif
@@ -66,11 +98,16 @@ uint8_t probe_get_state() {
 // Monitors probe pin state and records the system position when detected. Called by the
 // stepper ISR per ISR tick.
 // NOTE: This function must be extremely efficient as to not bog down the stepper ISR.
+// On the Maslow the Probe_PIN edge interrupt normally latches first. This catches a missed edge.
 void probe_state_monitor()
 {
   if (probe_get_state()) {
-    sys_probe_state = PROBE_OFF;
-    memcpy(sys_probe_position, sys_position, sizeof(sys_position));
-    bit_true(sys_rt_exec_state, EXEC_MOTION_CANCEL);
+    #ifdef MASLOWCNC
+      probe_latch_position();
+    #else
+      sys_probe_state = PROBE_OFF;
+      memcpy(sys_probe_position, sys_position, sizeof(sys_position));
+      bit_true(sys_rt_exec_state, EXEC_MOTION_CANCEL);
+    #endif
   }
 }
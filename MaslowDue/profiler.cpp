@@ -0,0 +1,132 @@
+/* This file is part of the Maslow Due Control Software.
+    The Maslow Due Control Software is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Maslow Due Control Software is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with the Maslow Control Software.  If not, see <http://www.gnu.org/licenses/>.
+
+    profiler.cpp - DWT cycle counter profiler for the interrupt handlers and main loop stages.
+    */
+
+#include "grbl.h"
+
+#ifdef CYCLE_PROFILER
+
+// Call times are binned four to an octave, so a percentile is known to within 25%. Buckets 0-3
+// hold 0-3 cycles and bucket 4*e+k holds (4+k)*2^(e-2) cycles and up, for e of 2 to 31.
+#define PROFILE_BUCKETS 128
+
+typedef struct {
+  uint32_t calls;
+  uint32_t min;
+  uint32_t max;
+  uint64_t total;
+  uint32_t bucket[PROFILE_BUCKETS];
+} profile_t;
+
+static profile_t profile[N_PROFILE];
+static uint32_t profile_start_us; // Start of the load measurement.
+
+static const char *const PROFILE_NAMES[N_PROFILE] = {
+  "PID", "STEP", "ENC", "SER", "PREP", "PLAN", "IK", "FK", "GC", "PIDL", "STPL", "SERL", "CRIT"
+};
+
+
+static uint8_t profile_bucket(uint32_t cycles)
+{
+  if (cycles < 4) { return(cycles); }
+  uint32_t e = 31 - __CLZ(cycles);
+  return((e << 2) | ((cycles >> (e-2)) & 3));
+}
+
+
+// Largest cycle count that falls in a bucket.
+static uint32_t profile_bucket_top(uint8_t idx)
+{
+  if (idx < 4) { return(idx); }
+  uint32_t e = idx >> 2;
+  return(((uint64_t)(4 + (idx & 3) + 1) << (e-2)) - 1);
+}
+
+
+void profile_init()
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; // Enable the trace unit, then its cycle counter.
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  profile_reset();
+}
+
+
+void profile_record(uint8_t id, uint32_t cycles)
+{
+  profile_t *p = &profile[id];
+  p->calls++;
+  p->total += cycles;
+  if (cycles < p->min) { p->min = cycles; }
+  if (cycles > p->max) { p->max = cycles; }
+  p->bucket[profile_bucket(cycles)]++;
+}
+
+
+void profile_reset()
+{
+  uint8_t id;
+  noInterrupts(); // Handlers record into the same tables.
+  memset(profile, 0, sizeof(profile));
+  for (id = 0; id < N_PROFILE; id++) { profile[id].min = 0xFFFFFFFF; }
+  profile_start_us = micros();
+  interrupts();
+}
+
+
+void profile_report()
+{
+  profile_t p;
+  uint8_t id, idx;
+  uint32_t elapsed_us = micros() - profile_start_us;
+
+  for (id = 0; id < N_PROFILE; id++) {
+    noInterrupts(); // Take a consistent copy, as a handler may record while printing.
+    memcpy(&p, &profile[id], sizeof(profile_t));
+    interrupts();
+
+    printPgmString(PSTR("[PRF:"));
+    printString(PROFILE_NAMES[id]);
+    serial_write(',');
+    print_uint32_base10(p.calls);
+    if (p.calls) {
+      // p99 is the top of the bucket holding the call at 99% of the count, but at most the max.
+      uint32_t rank = p.calls - p.calls/100;
+      uint32_t seen = 0;
+      uint32_t p99 = p.max;
+      for (idx = 0; idx < PROFILE_BUCKETS; idx++) {
+        seen += p.bucket[idx];
+        if (seen >= rank) {
+          if (profile_bucket_top(idx) < p99) { p99 = profile_bucket_top(idx); }
+          break;
+        }
+      }
+      serial_write(',');
+      print_uint32_base10(p.min);
+      serial_write(',');
+      print_uint32_base10((uint32_t)(p.total/p.calls));
+      serial_write(',');
+      print_uint32_base10(p99);
+      serial_write(',');
+      print_uint32_base10(p.max);
+      serial_write(',');
+      // Share of the CPU cycles since the reset.
+      printFloat(elapsed_us ? (100.0*p.total)/((VARIANT_MCK/1000000.0)*elapsed_us) : 0.0, 2);
+    }
+    printPgmString(PSTR("]\r\n"));
+  }
+}
+
+#endif
@@ -0,0 +1,83 @@
+/* This file is part of the Maslow Due Control Software.
+    The Maslow Due Control Software is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Maslow Due Control Software is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with the Maslow Control Software.  If not, see <http://www.gnu.org/licenses/>.
+
+    profiler.h - DWT cycle counter profiler for the interrupt handlers and main loop stages.
+    Enabled by CYCLE_PROFILER in config.h.
+    */
+
+#ifndef profiler_h
+#define profiler_h
+
+#include "grbl.h"
+
+// Profiled code. Keep PROFILE_NAMES in profiler.cpp in the same order.
+#define PROFILE_PID         0  // MotorPID_Timer_handler()
+#define PROFILE_STEP        1  // timer4_handler()
+#define PROFILE_ENCODER     2  // encoder pin-change handlers, all axes
+#define PROFILE_SERIAL      3  // serialScanner_handler()
+#define PROFILE_PREP        4  // st_prep_buffer()
+#define PROFILE_PLAN        5  // plan_buffer_line()
+#define PROFILE_INVERSE     6  // positionToChain()
+#define PROFILE_FORWARD     7  // chainToPosition()
+#define PROFILE_GCODE       8  // gc_execute_line()
+#define PROFILE_PID_LATENCY 9  // Timer5 compare to MotorPID_Timer_handler() entry
+#define PROFILE_STEP_LATENCY 10 // Timer4 compare to timer4_handler() entry
+#define PROFILE_SERIAL_LATENCY 11 // SERIAL_TIMER compare to serialScanner_handler() entry
+#define PROFILE_CRITICAL    12 // CRITICAL_ENTER() to CRITICAL_EXIT(), with interrupts disabled
+#define N_PROFILE           13
+
+#ifdef CYCLE_PROFILER
+  // Starts the cycle counter and clears the statistics.
+  void profile_init();
+
+  // Adds one timed call of 'id' to its statistics.
+  void profile_record(uint8_t id, uint32_t cycles);
+
+  // Clears the statistics and restarts the load measurement.
+  void profile_reset();
+
+  // Prints the statistics. [PRF:name,calls,min,mean,p99,max,load%] in cycles, one line per entry.
+  void profile_report();
+
+  // Times the rest of the enclosing function or block, however it returns. Interrupts taken
+  // while it runs are included, so nested handlers are also counted in the time of the outer.
+  struct profile_scope_t {
+    uint8_t id;
+    uint32_t start;
+    profile_scope_t(uint8_t n) : id(n), start(DWT->CYCCNT) {}
+    ~profile_scope_t() { profile_record(id, DWT->CYCCNT - start); }
+  };
+  #define PROFILE_FUNCTION(id) profile_scope_t profile_scope(id)
+
+  // Records how long a timer handler waited to run. The channel counter restarts at its RC
+  // compare, so its count at handler entry is the latency, in units of the channel clock. The
+  // clock is MCK/2 to MCK/128, as DueTimer picks it, which sets the resolution.
+  inline void profile_latency(uint8_t id, TcChannel *channel)
+  {
+    uint32_t clock = channel->TC_CMR & TC_CMR_TCCLKS_Msk;
+    profile_record(id, channel->TC_CV << (1 + 2*clock));
+  }
+  #define PROFILE_LATENCY(id, channel) profile_latency(id, channel)
+
+  // Critical sections on state shared with the interrupt handlers. Every handler waits for them,
+  // so their longest is the worst case added to all latencies, and the latency of the encoders.
+  #define CRITICAL_ENTER() uint32_t critical_start = DWT->CYCCNT; noInterrupts()
+  #define CRITICAL_EXIT() profile_record(PROFILE_CRITICAL, DWT->CYCCNT - critical_start); interrupts()
+#else
+  #define PROFILE_FUNCTION(id)
+  #define PROFILE_LATENCY(id, channel)
+  #define CRITICAL_ENTER() noInterrupts()
+  #define CRITICAL_EXIT() interrupts()
+#endif
+
+#endif
@@ -39,6 +39,22 @@ static char line[LINE_BUFFER_SIZE]; // Line to be executed. Zero-terminated.
 
 static void protocol_exec_rt_suspend();
 
+#ifdef MASLOWCNC
+  static uint32_t auto_report_time;  // millis() of the last status report, pushed or requested.
+  static uint8_t auto_report_state;  // sys.state at the last pushed status report.
+#endif
+
+#ifdef REPORT_FIELD_STARVATION
+  static uint8_t rx_starved = false; // The RX empty counter already counted the current stall.
+#endif
+
+#ifdef SD_JOB_STORAGE
+  // A running job takes the place of the host as the source of lines. Realtime commands are
+  // picked out of the serial stream as received, so they still act on the job.
+  static uint8_t protocol_read_line_char() { return((sd_state == SD_STATE_RUN) ? sd_read() : serial_read()); }
+#else
+  #define protocol_read_line_char() serial_read()
+#endif
 
 #ifdef MASLOWCNC
 
@@ -75,6 +91,17 @@ static void protocol_exec_rt_suspend();
 
       // Reset Grbl primary systems.
       serial_reset_read_buffer(); // Clear serial read buffer
+      #ifdef BINARY_MOTION_PROTOCOL
+        binary_protocol_exit(); // A reset returns the stream to text lines.
+      #endif
+      #ifdef SD_JOB_STORAGE
+        sd_reset(); // A reset ends any upload or running job.
+      #endif
+      #ifdef JOG_VELOCITY_MODE
+        jog_velocity_stop();
+      #endif
+      line_flags = 0; // Drop any partial line received before the reset.
+      char_counter = 0;
       gc_init(); // Set g-code parser to default state
       spindle_init();
       coolant_init();
@@ -154,9 +181,31 @@ int protocol_main_loop()
 
   #endif
 
+    #ifdef BINARY_MOTION_PROTOCOL
+      // In binary mode, execute frames instead of text lines. Frame data may hold 0xFF, so the
+      // buffer count, not SERIAL_NO_DATA, tells when the buffer is empty.
+      while (binary_protocol_active && serial_get_rx_buffer_count()) {
+        #ifdef REPORT_FIELD_STARVATION
+          rx_starved = false;
+        #endif
+        uint8_t status = binary_protocol_read(serial_read());
+        if (status != BINARY_FRAME_PENDING) {
+          protocol_execute_realtime(); // Runtime command check point.
+          if (sys.abort) { return -1; } // Bail to calling function upon system abort
+          report_status_message(status);
+        }
+      }
+    #endif
+
     // Process one line of incoming serial data, as the data becomes available. Performs an
     // initial filtering by removing spaces and comments and capitalizing all letters.
-    while((c = serial_read()) != SERIAL_NO_DATA) {
+    #ifdef BINARY_MOTION_PROTOCOL
+      if (!binary_protocol_active) // Text lines resume after the frame leaving binary mode.
+    #endif
+    while((c = protocol_read_line_char()) != SERIAL_NO_DATA) {
+      #ifdef REPORT_FIELD_STARVATION
+        rx_starved = false;
+      #endif
       if ((c == '\n') || (c == '\r')) { // End of line reached
 
         protocol_execute_realtime(); // Runtime command check point.
@@ -167,23 +216,38 @@ int protocol_main_loop()
           report_echo_line_received(line);
         #endif
 
+        #ifdef SD_JOB_STORAGE
+          uint8_t job_line = (sd_state == SD_STATE_RUN); // Before the line can end the job.
+        #endif
+
         // Direct and execute one line of formatted input, and report status of execution.
+        uint8_t status;
         if (line_flags & LINE_FLAG_OVERFLOW) {
           // Report line overflow error.
-          report_status_message(STATUS_OVERFLOW);
+          status = STATUS_OVERFLOW;
         } else if (line[0] == 0) {
           // Empty or comment line. For syncing purposes.
-          report_status_message(STATUS_OK);
+          status = STATUS_OK;
+        #ifdef SD_JOB_STORAGE
+          } else if (sd_state == SD_STATE_UPLOAD) {
+            // Store the line in the file being uploaded.
+            status = sd_upload_line(line);
+        #endif
         } else if (line[0] == '$') {
           // Grbl '$' system command
-          report_status_message(system_execute_line(line));
+          status = system_execute_line(line);
         } else if (sys.state & (STATE_ALARM | STATE_JOG)) {
           // Everything else is gcode. Block if in alarm or jog mode.
-          report_status_message(STATUS_SYSTEM_GC_LOCK);
+          status = STATUS_SYSTEM_GC_LOCK;
         } else {
           // Parse and execute g-code block.
-          report_status_message(gc_execute_line(line));
+          status = gc_execute_line(line);
         }
+        #ifdef SD_JOB_STORAGE
+          if (job_line) { sd_report_status(status); } // Job lines answer to the job, not the host.
+          else
+        #endif
+        report_status_message(status);
 
         // Reset tracking data for next line.
         line_flags = 0;
@@ -232,10 +296,28 @@ int protocol_main_loop()
       }
     }
 
+    #ifdef REPORT_FIELD_STARVATION
+      // Count the stream running dry mid-cycle with room left to plan, once per occurrence.
+      if ((sys.state == STATE_CYCLE) && !plan_check_full_buffer()) {
+        if (!rx_starved) { sys_starvation.rx_empty++; }
+        rx_starved = true;
+      }
+    #endif
+
+    #ifdef PLAN_SEGMENT_QUEUE_SIZE
+      plan_queue_flush(); // Plan parsed-ahead segments as planner blocks free up.
+    #endif
+    #ifdef JOG_VELOCITY_MODE
+      jog_velocity_service(); // Keep a velocity jog planned ahead of the sled.
+    #endif
+
     // If there are no more characters in the serial read buffer to be processed and executed,
     // this indicates that g-code streaming has either filled the planner buffer or has
     // completed. In either case, auto-cycle start, if enabled, any queued moves.
     protocol_auto_cycle_start();
+    #ifdef PLANNER_RECALC_BUDGET_US
+      plan_recalculate_resume(); // Finish any replanning the streaming path ran out of time for.
+    #endif
 
     protocol_execute_realtime();  // Runtime command check point.
     if (sys.abort) { 
@@ -284,6 +366,9 @@ int protocol_main_loop()
 // during a synchronize call, if it should happen. Also, waits for clean cycle end.
 void protocol_buffer_synchronize()
 {
+  #ifdef PLAN_SEGMENT_QUEUE_SIZE
+    plan_queue_flush();
+  #endif
   // If system is queued, ensure cycle resumes if the auto start flag is present.
   protocol_auto_cycle_start();
   do {
@@ -291,6 +376,12 @@ void protocol_buffer_synchronize()
     if (sys.abort) { 
       return; 
       } // Check for system abort
+    #ifdef PLAN_SEGMENT_QUEUE_SIZE
+      // Segments still queued for the planner are part of the buffer being synchronized.
+      if (plan_get_queue_count()) { plan_queue_flush(); }
+    #endif
+    // A segment buffer underrun ends the cycle with blocks left. Restart it, as the main loop would.
+    if (sys.state == STATE_IDLE) { protocol_auto_cycle_start(); }
   } while (plan_get_current_block() || (sys.state == STATE_CYCLE));
 }
 
@@ -303,6 +394,9 @@ void protocol_buffer_synchronize()
 // execute calls a buffer sync, or the planner buffer is full and ready to go.
 void protocol_auto_cycle_start()
 {
+  #ifdef PIPELINE_BENCHMARK
+    if (bench_active) { bench_drain(); return; } // $BENCH stands in for the stepper.
+  #endif
   if (plan_get_current_block() != NULL) { // Check if there are any blocks in the buffer.
     system_set_exec_state_flag(EXEC_CYCLE_START); // If so, execute them!
   }
@@ -330,6 +424,34 @@ void protocol_execute_realtime()
 // Executes run-time commands, when required. This function primarily operates as Grbl's state
 // machine and controls the various real-time features Grbl has to offer.
 // NOTE: Do not alter this unless you know exactly what you are doing!
+#ifdef MASLOWCNC
+  // Pushes a status report every $97 ms while the machine is busy, every $98 ms at rest, and on any
+  // change of state, so hosts do not need to poll with '?'. A zero period disables its reports,
+  // and with both zero only requested reports are sent. A scheduler task. A due report waits while
+  // the TX buffer has less room than what drains within budget_us, so writing it never blocks on
+  // the port, and returns true until it is sent.
+  #define AUTO_REPORT_MAX_BYTES 200 // Longest status report, with every field.
+  uint8_t protocol_auto_report(uint16_t budget_us)
+  {
+    if (!(settings.autoReportInterval || settings.autoReportIdleInterval)) { return(false); }
+    uint32_t interval = settings.autoReportIdleInterval;
+    if (sys.state & (STATE_HOMING | STATE_CYCLE | STATE_HOLD | STATE_JOG | STATE_SAFETY_DOOR)) {
+      interval = settings.autoReportInterval;
+    }
+    uint32_t now = millis();
+    if (sys.state == auto_report_state) {
+      if ((interval == 0) || ((now - auto_report_time) < interval)) { return(false); }
+    }
+    uint32_t drained = ((uint32_t)budget_us*(BAUD_RATE/10))/1000000; // 10 bits per byte.
+    if ((TX_BUFFER_SIZE - serial_get_tx_buffer_count()) + drained < AUTO_REPORT_MAX_BYTES) { return(true); }
+    auto_report_state = sys.state;
+    auto_report_time = now;
+    report_realtime_status();
+    return(false);
+  }
+#endif
+
+
 void protocol_exec_rt_system()
 {
   uint8_t rt_exec; // Temp variable to avoid calling volatile multiple times.
@@ -340,8 +462,11 @@ void protocol_exec_rt_system()
     // loop until system reset/abort.
     sys.state = STATE_ALARM; // Set system alarm state
     report_alarm_message(rt_exec);
+    #ifdef MASLOWCNC
+      if ((rt_exec == EXEC_ALARM_HARD_LIMIT) || (rt_exec == EXEC_ALARM_DRIVER_FAULT)) { report_fault_position(); }
+    #endif
     // Halt everything upon a critical event flag. Currently hard and soft limits flag this.
-    if ((rt_exec == EXEC_ALARM_HARD_LIMIT) || (rt_exec == EXEC_ALARM_SOFT_LIMIT)) {
+    if ((rt_exec == EXEC_ALARM_HARD_LIMIT) || (rt_exec == EXEC_ALARM_SOFT_LIMIT) || (rt_exec == EXEC_ALARM_DRIVER_FAULT)) {
       report_feedback_message(MESSAGE_CRITICAL_EVENT);
       system_clear_exec_state_flag(EXEC_RESET); // Disable any existing reset
       do {
@@ -368,6 +493,9 @@ void protocol_exec_rt_system()
     if (rt_exec & EXEC_STATUS_REPORT) {
       report_realtime_status();
       system_clear_exec_state_flag(EXEC_STATUS_REPORT);
+      #ifdef MASLOWCNC
+        auto_report_time = millis(); // Restarts the auto report period.
+      #endif
     }
 
     // NOTE: Once hold is initiated, the system immediately enters a suspend state to block all
@@ -611,11 +739,9 @@ void protocol_exec_rt_system()
     }
   #endif
 
-  // Reload step segment buffer
-  if (sys.state & (STATE_CYCLE | STATE_HOLD | STATE_SAFETY_DOOR | STATE_HOMING | STATE_SLEEP| STATE_JOG)) {
-    st_prep_buffer();
-  }
-
+  // Reload step segment buffer, then run background work (status reports, EEPROM write-back,
+  // kinematics grid) in the time left of the slice.
+  scheduler_run();
 }
 
 
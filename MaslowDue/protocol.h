@@ -46,6 +46,11 @@ void protocol_exec_rt_system();
 // Executes the auto cycle feature, if enabled.
 void protocol_auto_cycle_start();
 
+#ifdef MASLOWCNC
+  // Pushes the $97/$98 status reports. A scheduler task.
+  uint8_t protocol_auto_report(uint16_t budget_us);
+#endif
+
 // Block until all buffered steps are executed
 void protocol_buffer_synchronize();
 
@@ -66,6 +66,11 @@ static void report_util_setting_string(uint8_t n) {
     case GRBL_Z_TRAVEL_MIN: printPgmString(PSTR(" (Z-axis minimum travel safe distance, mm)")); break;
     case GRBL_KINEMATICS_SIMPLE: printPgmString(PSTR(" (simple kinematics on?, boolean)")); break;
     case GRBL_HOME_CHAIN_LENGTHS: printPgmString(PSTR(" (calibration chain length, mm)")); break;
+    case GRBL_SEGMENT_TOLERANCE: printPgmString(PSTR(" (line segment tolerance, mm)")); break;
+    case GRBL_PID_RATE: printPgmString(PSTR(" (servo loop rate, Hz)")); break;
+    case GRBL_AUTO_REPORT_INTERVAL: printPgmString(PSTR(" (auto status report, busy, msec)")); break;
+    case GRBL_AUTO_REPORT_IDLE_INTERVAL: printPgmString(PSTR(" (auto status report, idle, msec)")); break;
+    case GRBL_JERK: printPgmString(PSTR(" (s-curve jerk, mm/sec^3)")); break;
 #endif
     default: break;
   }
@@ -165,7 +170,20 @@ void report_init_message()
 
 // Grbl help message
 void report_grbl_help() {
-  printPgmString(PSTR("[HLP:$$ $# $G $I $N $x=val $Nx=line $J=line $SLP $C $X $H ~ ! ? ctrl-x]\r\n"));
+  printPgmString(PSTR("[HLP:$$ $# $G $I $N $x=val $Nx=line $J=line $SLP $C $X $H"));
+  #ifdef JOG_VELOCITY_MODE
+    printPgmString(PSTR(" $JV=line"));
+  #endif
+  #ifdef BINARY_MOTION_PROTOCOL
+    printPgmString(PSTR(" $B"));
+  #endif
+  #ifdef PIPELINE_BENCHMARK
+    printPgmString(PSTR(" $BENCH"));
+  #endif
+  #ifdef SD_JOB_STORAGE
+    printPgmString(PSTR(" $FL $FW=file $FC $FR=file $FD=file"));
+  #endif
+  printPgmString(PSTR(" ~ ! ? ctrl-x]\r\n"));
 }
 
 
@@ -203,18 +221,24 @@ void report_grbl_settings() {
     report_util_uint32_setting(41,settings.x_PID_Ki );
     report_util_uint32_setting(42,settings.x_PID_Kd );
     report_util_uint32_setting(43,settings.x_PID_Imax );
+    report_util_uint32_setting(48,settings.x_PID_Kvff );
+    report_util_uint32_setting(49,settings.x_PID_Kaff );
 
   // y-axis PID
     report_util_uint32_setting(50,settings.y_PID_Kp );
     report_util_uint32_setting(51,settings.y_PID_Ki );
     report_util_uint32_setting(52,settings.y_PID_Kd );
     report_util_uint32_setting(53,settings.y_PID_Imax );
+    report_util_uint32_setting(58,settings.y_PID_Kvff );
+    report_util_uint32_setting(59,settings.y_PID_Kaff );
 
   // z-axis PID
     report_util_uint32_setting(60,settings.z_PID_Kp );
     report_util_uint32_setting(61,settings.z_PID_Ki );
     report_util_uint32_setting(62,settings.z_PID_Kd );
     report_util_uint32_setting(63,settings.z_PID_Imax );
+    report_util_uint32_setting(68,settings.z_PID_Kvff );
+    report_util_uint32_setting(69,settings.z_PID_Kaff );
 
     report_util_uint32_setting(GRBL_CHAIN_OVER_SPROCKET,settings.chainOverSprocket );
     report_util_float_setting(GRBL_MACHINE_WIDTH,settings.machineWidth,N_DECIMAL_SETTINGVALUE);
@@ -235,6 +259,11 @@ void report_grbl_settings() {
     report_util_float_setting(GRBL_SLED_WEIGHT, settings.sledWeight, N_DECIMAL_SETTINGVALUE);
     report_util_float_setting(GRBL_CHAIN_ELONGATION_FACTOR, settings.chainElongationFactor, 10);
     report_util_uint32_setting(GRBL_HOME_CHAIN_LENGTHS, settings.homeChainLengths);
+    report_util_float_setting(GRBL_SEGMENT_TOLERANCE, settings.segmentTolerance, N_DECIMAL_SETTINGVALUE);
+    report_util_uint32_setting(GRBL_PID_RATE, settings.pidRate);
+    report_util_uint32_setting(GRBL_AUTO_REPORT_INTERVAL, settings.autoReportInterval);
+    report_util_uint32_setting(GRBL_AUTO_REPORT_IDLE_INTERVAL, settings.autoReportIdleInterval);
+    report_util_float_setting(GRBL_JERK, settings.jerk, N_DECIMAL_SETTINGVALUE);
 
     #endif
 
@@ -271,6 +300,23 @@ void report_probe_parameters()
 }
 
 
+#ifdef MASLOWCNC
+  // Prints the measured position latched by a limit or driver fault interrupt, and the axes that tripped.
+  void report_fault_position()
+  {
+    printPgmString(PSTR("[FLT:"));
+    float print_position[N_AXIS];
+    system_convert_array_steps_to_mpos(print_position,sys_fault_position);
+    report_util_axis_values(print_position);
+    serial_write(':');
+    for (uint8_t idx = 0; idx < N_AXIS; idx++) {
+      if (bit_istrue(sys_fault_axes,bit(idx))) { serial_write("XYZ"[idx]); }
+    }
+    report_util_feedback_line_feed();
+  }
+#endif
+
+
 // Prints Grbl NGC parameters (coordinate offsets, probing)
 void report_ngc_parameters()
 {
@@ -393,7 +439,7 @@ void report_execute_startup_message(char *line, uint8_t status_code)
 void report_build_info(char *line)
 {
   printPgmString(PSTR("[VER:" GRBL_VERSION "." GRBL_VERSION_BUILD ":"));
-  printString(line);
+  if (line != NULL) { printString(line); } // NULL from the welcome message, with no build info read.
   report_util_feedback_line_feed();
   printPgmString(PSTR("[OPT:")); // Generate compile-time build option list
   serial_write('V'); // Variable spindle standard.
@@ -453,11 +499,58 @@ void report_build_info(char *line)
   #endif
   // NOTE: Compiled values, like override increments/max/min values, may be added at some point later.
   serial_write(',');
-  print_uint8_base10(BLOCK_BUFFER_SIZE-1);
-  serial_write(',');
-  print_uint8_base10(RX_BUFFER_SIZE);
+  #ifdef MASLOWCNC
+    print_uint32_base10(BLOCK_BUFFER_SIZE-1);
+    serial_write(',');
+    print_uint32_base10(RX_BUFFER_SIZE);
+  #else
+    print_uint8_base10(BLOCK_BUFFER_SIZE-1);
+    serial_write(',');
+    print_uint8_base10(RX_BUFFER_SIZE);
+  #endif
 
   report_util_feedback_line_feed();
+
+  #ifdef MASLOWCNC
+    // Planner RAM usage: bytes per block, number of blocks, total bytes of the block buffer.
+    printPgmString(PSTR("[PLAN:"));
+    print_uint32_base10(sizeof(plan_block_t));
+    serial_write(',');
+    print_uint32_base10(BLOCK_BUFFER_SIZE);
+    serial_write(',');
+    print_uint32_base10(PLAN_BLOCK_BUFFER_BYTES);
+    report_util_feedback_line_feed();
+  #endif
+  #ifdef KINEMATICS_CORRECTION_GRID
+    // Kinematics correction grid: columns, rows, bound on the interpolated chain length error in mm.
+    printPgmString(PSTR("[KINGRID:"));
+    print_uint32_base10(KINEMATICS_GRID_COLS);
+    serial_write(',');
+    print_uint32_base10(KINEMATICS_GRID_ROWS);
+    serial_write(',');
+    printFloat(kinematics_grid_error, 4);
+    report_util_feedback_line_feed();
+  #endif
+  #ifdef KINEMATICS_TARGET_CACHE
+    // Kinematics target cache: entries, positionToChain() calls answered from it, calls solved.
+    printPgmString(PSTR("[KINCACHE:"));
+    print_uint32_base10(KINEMATICS_TARGET_CACHE);
+    serial_write(',');
+    print_uint32_base10(kinematics_cache_hits);
+    serial_write(',');
+    print_uint32_base10(kinematics_cache_misses);
+    report_util_feedback_line_feed();
+  #endif
+  #ifdef PLANNER_RECALC_BUDGET_US
+    // Planner recalculation budget: microseconds per pass, passes cut short, passes resumed.
+    printPgmString(PSTR("[PLANRC:"));
+    print_uint32_base10(PLANNER_RECALC_BUDGET_US);
+    serial_write(',');
+    print_uint32_base10(plan_recalc_stats.budget_exhausted);
+    serial_write(',');
+    print_uint32_base10(plan_recalc_stats.resumes);
+    report_util_feedback_line_feed();
+  #endif
 }
 
 
@@ -479,9 +572,27 @@ void report_realtime_status()
 {
   uint8_t idx;
   int32_t current_position[N_AXIS]; // Copy current state of the system position variable
-  memcpy(current_position,sys_position,sizeof(sys_position));
+  #ifdef MASLOWCNC
+    CRITICAL_ENTER(); // All axes from the same step interpolator tick.
+    memcpy(current_position,sys_position,sizeof(sys_position));
+    CRITICAL_EXIT();
+  #else
+    memcpy(current_position,sys_position,sizeof(sys_position));
+  #endif
   float print_position[N_AXIS];
-  system_convert_array_steps_to_mpos(print_position,current_position);
+  #ifdef REPORT_MPOS_PLANNER_TARGET
+    // While cutting, report the end point of the executing block rather than solving the kinematics.
+    plan_block_t *exec_block = plan_get_current_block();
+    if ((sys.state & (STATE_CYCLE | STATE_JOG)) && (exec_block != NULL)) {
+      print_position[X_AXIS] = exec_block->xy_target[X_AXIS];
+      print_position[Y_AXIS] = exec_block->xy_target[Y_AXIS];
+      print_position[Z_AXIS] = current_position[Z_AXIS]/settings.steps_per_mm[Z_AXIS];
+    } else {
+      system_convert_array_steps_to_mpos(print_position,current_position);
+    }
+  #else
+    system_convert_array_steps_to_mpos(print_position,current_position);
+  #endif
 
   // Report current machine state and sub-states
   serial_write('<');
@@ -543,9 +654,30 @@ void report_realtime_status()
   #ifdef REPORT_FIELD_BUFFER_STATE
     if (bit_istrue(settings.status_report_mask,BITFLAG_RT_STATUS_BUFFER_STATE)) {
       printPgmString(PSTR("|Bf:"));
-      print_uint8_base10(plan_get_block_buffer_available());
+      #ifdef MASLOWCNC
+        print_uint32_base10(plan_get_block_buffer_available());
+      #else
+        print_uint8_base10(plan_get_block_buffer_available());
+      #endif
       serial_write(',');
-      print_uint8_base10(serial_get_rx_buffer_available());
+      #ifdef MASLOWCNC
+        print_uint32_base10(serial_get_rx_buffer_available());
+      #else
+        print_uint8_base10(serial_get_rx_buffer_available());
+      #endif
+    }
+  #endif
+
+  #ifdef REPORT_FIELD_STARVATION
+    if (bit_istrue(settings.status_report_mask,BITFLAG_RT_STATUS_STARVATION)) {
+      printPgmString(PSTR("|Sv:"));
+      print_uint32_base10(sys_starvation.segment_underruns);
+      serial_write(',');
+      print_uint32_base10(sys_starvation.planner_empty);
+      serial_write(',');
+      print_uint32_base10(sys_starvation.rx_empty);
+      serial_write(',');
+      print_uint32_base10(sys_starvation.planner_wait_ms);
     }
   #endif
 
@@ -561,6 +693,10 @@ void report_realtime_status()
     }
   #endif
 
+  #ifdef SD_JOB_STORAGE
+    sd_report_progress();
+  #endif
+
   // Report realtime feed speed
   #ifdef REPORT_FIELD_CURRENT_FEED_SPEED
     printPgmString(PSTR("|FS:"));
@@ -39,6 +39,8 @@
 #define STATUS_TRAVEL_EXCEEDED 15
 #define STATUS_INVALID_JOG_COMMAND 16
 #define STATUS_SETTING_DISABLED_LASER 17
+#define STATUS_PID_AUTOTUNE_FAILED 18
+#define STATUS_BINARY_FRAME_ERROR 19
 
 #define STATUS_GCODE_UNSUPPORTED_COMMAND 20
 #define STATUS_GCODE_MODAL_GROUP_VIOLATION 21
@@ -60,6 +62,11 @@
 #define STATUS_GCODE_G43_DYNAMIC_AXIS_ERROR 37
 #define STATUS_GCODE_MAX_VALUE_EXCEEDED 38
 
+#define STATUS_SD_FAILED_MOUNT 60
+#define STATUS_SD_FAILED_OPEN 61
+#define STATUS_SD_FAILED_WRITE 62
+#define STATUS_SD_BUSY 63
+
 // Define Grbl alarm codes. Valid values (1-255). 0 is reserved.
 #define ALARM_HARD_LIMIT_ERROR      EXEC_ALARM_HARD_LIMIT
 #define ALARM_SOFT_LIMIT_ERROR      EXEC_ALARM_SOFT_LIMIT
@@ -111,6 +118,11 @@ void report_realtime_status();
 // Prints recorded probe position
 void report_probe_parameters();
 
+#ifdef MASLOWCNC
+  // Prints the position latched by a hard limit or driver fault alarm as [FLT:x,y,z:axes]
+  void report_fault_position();
+#endif
+
 // Prints Grbl NGC parameters (coordinate offsets, probe)
 void report_ngc_parameters();
 
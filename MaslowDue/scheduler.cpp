@@ -0,0 +1,154 @@
+/* This file is part of the Maslow Due Control Software.
+    The Maslow Due Control Software is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Maslow Due Control Software is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with the Maslow Control Software.  If not, see <http://www.gnu.org/licenses/>.
+
+    scheduler.cpp - cooperative scheduler of the main loop background work, behind the segment refill.
+    */
+
+#include "grbl.h"
+
+#ifdef MASLOWCNC
+  #include "MaslowDue.h"
+#endif
+
+typedef struct {
+  const char *name;
+  task_function_t run;  // NULL where the feature is not built.
+  uint16_t budget_us;   // Longest increment. Deferred when it would overrun the slice.
+} task_t;
+
+#ifdef SCHEDULER_STATS
+  typedef struct {
+    uint32_t runs;
+    uint32_t deferred;    // Times it had work but no time left in the slice.
+    uint32_t max_us;
+    uint64_t total_us;
+  } task_stats_t;
+#endif
+
+static uint8_t scheduler_prep(uint16_t budget_us);
+
+static const task_t SCHEDULER_TASKS[N_TASK] = {
+  { "PREP", scheduler_prep, 0 },
+  #ifdef MASLOWCNC
+    { "RPT", protocol_auto_report, 1000 },
+  #else
+    { "RPT", NULL, 0 },
+  #endif
+  #if defined(MASLOWCNC) && defined(EEPROM_WRITE_BEHIND)
+    { "EEP", eeprom_service, 1500 },  // A bit-banged page write of EEPROM_WRITE_BEHIND_BYTES.
+  #else
+    { "EEP", NULL, 0 },
+  #endif
+  #if defined(MASLOWCNC) && defined(KINEMATICS_CORRECTION_GRID)
+    { "GRID", kinematicsGridService, 1000 },
+  #else
+    { "GRID", NULL, 0 },
+  #endif
+};
+
+static uint8_t task_next = TASK_PREP+1;  // Round robin start of the next slice.
+static uint8_t scheduler_busy = false;
+#ifdef SCHEDULER_STATS
+  static task_stats_t task_stats[N_TASK];
+  static uint8_t task_pending[N_TASK];  // Returned more work pending last run, to count deferrals.
+  static uint32_t scheduler_start_us;   // Start of the load measurement.
+#endif
+
+
+static uint8_t scheduler_prep(uint16_t budget_us)
+{
+  if (sys.state & (STATE_CYCLE | STATE_HOLD | STATE_SAFETY_DOOR | STATE_HOMING | STATE_SLEEP| STATE_JOG)) {
+    st_prep_buffer();
+  }
+  return(false);
+}
+
+
+static void scheduler_run_task(uint8_t id)
+{
+  #ifdef SCHEDULER_STATS
+    uint32_t start = micros();
+    task_pending[id] = SCHEDULER_TASKS[id].run(SCHEDULER_TASKS[id].budget_us);
+    uint32_t elapsed = micros() - start;
+    task_stats_t *s = &task_stats[id];
+    s->runs++;
+    s->total_us += elapsed;
+    if (elapsed > s->max_us) { s->max_us = elapsed; }
+  #else
+    SCHEDULER_TASKS[id].run(SCHEDULER_TASKS[id].budget_us);
+  #endif
+}
+
+
+// The segment refill comes first, and again after every task, so background work only ever
+// spends the time the segment buffer already holds. The first task of a slice always runs, so
+// every task makes progress, even one whose increment is longer than the slice.
+// NOTE: Tasks may be entered again from protocol_execute_realtime(), i.e. while waiting on a
+// full planner. A nested call only refills the segment buffer.
+void scheduler_run()
+{
+  scheduler_run_task(TASK_PREP);
+  if (scheduler_busy) { return; }
+  scheduler_busy = true;
+
+  uint32_t slice_start = micros();
+  uint8_t id = task_next;
+  uint8_t first = true;
+  for (uint8_t n = 1; n < N_TASK; n++) {
+    if (SCHEDULER_TASKS[id].run != NULL) {
+      if (first || ((micros() - slice_start) + SCHEDULER_TASKS[id].budget_us <= SCHEDULER_SLICE_US)) {
+        scheduler_run_task(id);
+        scheduler_run_task(TASK_PREP);
+        if (first) { task_next = (id == N_TASK-1) ? TASK_PREP+1 : id+1; }
+        first = false;
+      }
+      #ifdef SCHEDULER_STATS
+        else if (task_pending[id]) { task_stats[id].deferred++; }
+      #endif
+    }
+    id = (id == N_TASK-1) ? TASK_PREP+1 : id+1;
+  }
+  scheduler_busy = false;
+}
+
+
+#ifdef SCHEDULER_STATS
+  void scheduler_reset()
+  {
+    memset(task_stats, 0, sizeof(task_stats));
+    scheduler_start_us = micros();
+  }
+
+
+  void scheduler_report()
+  {
+    uint32_t elapsed_us = micros() - scheduler_start_us;
+    for (uint8_t id = 0; id < N_TASK; id++) {
+      if (SCHEDULER_TASKS[id].run == NULL) { continue; }
+      task_stats_t *s = &task_stats[id];
+      printPgmString(PSTR("[TSK:"));
+      printString(SCHEDULER_TASKS[id].name);
+      serial_write(',');
+      print_uint32_base10(s->runs);
+      serial_write(',');
+      print_uint32_base10(s->deferred);
+      serial_write(',');
+      print_uint32_base10(s->runs ? (uint32_t)(s->total_us/s->runs) : 0);
+      serial_write(',');
+      print_uint32_base10(s->max_us);
+      serial_write(',');
+      printFloat(elapsed_us ? (100.0*s->total_us)/elapsed_us : 0.0, 2); // Share of all time since the reset.
+      printPgmString(PSTR("]\r\n"));
+    }
+  }
+#endif
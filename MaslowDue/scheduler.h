@@ -0,0 +1,44 @@
+/* This file is part of the Maslow Due Control Software.
+    The Maslow Due Control Software is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Maslow Due Control Software is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with the Maslow Control Software.  If not, see <http://www.gnu.org/licenses/>.
+
+    scheduler.h - cooperative scheduler of the main loop background work, behind the segment refill.
+    */
+
+#ifndef scheduler_h
+#define scheduler_h
+
+#include "grbl.h"
+
+// Timed main loop work. Register tasks in SCHEDULER_TASKS in scheduler.cpp, in this order.
+#define TASK_PREP     0  // st_prep_buffer(). Always first and never deferred.
+#define TASK_REPORT   1  // protocol_auto_report()
+#define TASK_EEPROM   2  // eeprom_service()
+#define TASK_KINGRID  3  // kinematicsGridService()
+#define N_TASK        4
+
+// A task does one increment of its work in about budget_us, and returns true while more is pending.
+typedef uint8_t (*task_function_t)(uint16_t budget_us);
+
+// Refills the segment buffer, when in motion, then runs the background tasks in turn until
+// SCHEDULER_SLICE_US has passed. Called by protocol_exec_rt_system().
+void scheduler_run();
+
+#ifdef SCHEDULER_STATS
+  // Clears the task statistics and restarts the load measurement.
+  void scheduler_reset();
+
+  // Prints [TSK:name,runs,deferred,mean,max,load%] per task, times in microseconds.
+  void scheduler_report();
+#endif
+
+#endif
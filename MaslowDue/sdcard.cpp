@@ -0,0 +1,199 @@
+/* This file is part of the Maslow Due Control Software.
+    The Maslow Due Control Software is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Maslow Due Control Software is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with the Maslow Control Software.  If not, see <http://www.gnu.org/licenses/>.
+
+    sdcard.cpp - g-code job files stored on an SD card and run without the host.
+    */
+
+#include "grbl.h"
+
+#ifdef SD_JOB_STORAGE
+
+#include <SPI.h>
+#include <SD.h>
+
+#define SD_NAME_LENGTH 12  // FAT 8.3 file names.
+
+uint8_t sd_state = SD_STATE_IDLE;
+
+static uint8_t sd_mounted = false;
+static File sd_file;
+static char sd_name[SD_NAME_LENGTH+1];  // Name of the open file.
+
+// Running job. Read a block at a time and handed to the main loop a character at a time.
+static uint8_t sd_block[SD_JOB_BLOCK_SIZE];
+static uint16_t sd_block_count;  // Bytes in sd_block.
+static uint16_t sd_block_index;  // Next byte of sd_block to hand out.
+static uint32_t sd_job_size;
+static uint32_t sd_job_read_count;  // Bytes read from the file so far.
+static uint32_t sd_job_lines;       // Lines executed so far.
+static uint8_t sd_job_last_char;
+
+
+void sd_reset()
+{
+  if (sd_state != SD_STATE_IDLE) { sd_file.close(); }
+  sd_state = SD_STATE_IDLE;
+}
+
+
+static uint8_t sd_mount()
+{
+  if (!sd_mounted) { sd_mounted = SD.begin(SD_CS_PIN); }
+  return(sd_mounted);
+}
+
+
+// Prints [JOB:event,name,lines] and closes the job.
+static void sd_job_close(const char *event)
+{
+  printPgmString(PSTR("[JOB:"));
+  printPgmString(event);
+  serial_write(',');
+  printString(sd_name);
+  serial_write(',');
+  print_uint32_base10(sd_job_lines);
+  printPgmString(PSTR("]\r\n"));
+  sd_reset();
+}
+
+
+static uint8_t sd_list_files()
+{
+  File root = SD.open("/");
+  if (!root) { return(STATUS_SD_FAILED_OPEN); }
+  File entry;
+  while ((entry = root.openNextFile())) {
+    if (!entry.isDirectory()) {
+      printPgmString(PSTR("[FILE:"));
+      printString(entry.name());
+      serial_write(',');
+      print_uint32_base10(entry.size());
+      printPgmString(PSTR("]\r\n"));
+    }
+    entry.close();
+  }
+  root.close();
+  return(STATUS_OK);
+}
+
+
+static uint8_t sd_start_upload()
+{
+  if (SD.exists(sd_name)) { SD.remove(sd_name); } // Replaces the file, as FILE_WRITE appends.
+  sd_file = SD.open(sd_name, FILE_WRITE);
+  if (!sd_file) { return(STATUS_SD_FAILED_OPEN); }
+  sd_state = SD_STATE_UPLOAD;
+  return(STATUS_OK);
+}
+
+
+static uint8_t sd_start_job()
+{
+  if (sys.state != STATE_IDLE) { return(STATUS_IDLE_ERROR); }
+  sd_file = SD.open(sd_name, FILE_READ);
+  if (!sd_file) { return(STATUS_SD_FAILED_OPEN); }
+  sd_job_size = sd_file.size();
+  sd_job_read_count = 0;
+  sd_job_lines = 0;
+  sd_block_count = 0;
+  sd_block_index = 0;
+  sd_job_last_char = '\n';
+  sd_state = SD_STATE_RUN;
+  return(STATUS_OK);
+}
+
+
+uint8_t sd_execute_line(char *line)
+{
+  // Commands are $F<letter>, with a file name after '=' for all but $FL.
+  if (line[3] == '=') {
+    if ((line[4] == 0) || (strlen(&line[4]) > SD_NAME_LENGTH)) { return(STATUS_INVALID_STATEMENT); }
+  } else if ((line[2] != 'L') || (line[3] != 0)) {
+    return(STATUS_INVALID_STATEMENT);
+  }
+  if (sd_state != SD_STATE_IDLE) { return(STATUS_SD_BUSY); }
+  if (!sd_mount()) { return(STATUS_SD_FAILED_MOUNT); }
+  // Only now, so a refused command leaves the name of a running job or upload alone.
+  if (line[3] == '=') { strcpy(sd_name, &line[4]); }
+
+  switch (line[2]) {
+    case 'L': return(sd_list_files());
+    case 'W': return(sd_start_upload());
+    case 'R': return(sd_start_job());
+    case 'D':
+      if (!SD.remove(sd_name)) { return(STATUS_SD_FAILED_OPEN); }
+      return(STATUS_OK);
+  }
+  return(STATUS_INVALID_STATEMENT);
+}
+
+
+uint8_t sd_upload_line(char *line)
+{
+  if (strcmp(line, "$FC") == 0) {
+    sd_file.close();
+    sd_state = SD_STATE_IDLE;
+    return(STATUS_OK);
+  }
+  size_t length = strlen(line);
+  if ((sd_file.write((const uint8_t *)line, length) != length) || (sd_file.write('\n') != 1)) {
+    sd_reset(); // Card full or removed. Ends the upload.
+    return(STATUS_SD_FAILED_WRITE);
+  }
+  return(STATUS_OK);
+}
+
+
+uint8_t sd_read()
+{
+  if (sd_state != SD_STATE_RUN) { return(SERIAL_NO_DATA); }
+  if (sd_block_index == sd_block_count) {
+    int count = sd_file.read(sd_block, SD_JOB_BLOCK_SIZE);
+    if (count <= 0) {
+      // End of file. A last line without a line feed still ends like any other.
+      if (sd_job_last_char != '\n') {
+        sd_job_last_char = '\n';
+        return('\n');
+      }
+      sd_job_close(PSTR("END"));
+      return(SERIAL_NO_DATA);
+    }
+    sd_block_count = count;
+    sd_block_index = 0;
+    sd_job_read_count += count;
+  }
+  uint8_t c = sd_block[sd_block_index++];
+  if (c == SERIAL_NO_DATA) { c = ' '; } // Not an end of data. Dropped as a control character.
+  sd_job_last_char = c;
+  return(c);
+}
+
+
+void sd_report_status(uint8_t status_code)
+{
+  sd_job_lines++;
+  if (status_code == STATUS_OK) { return; }
+  report_status_message(status_code);
+  sd_job_close(PSTR("HALT")); // Lines already planned still run. Feed hold or reset to stop them.
+}
+
+
+void sd_report_progress()
+{
+  if ((sd_state != SD_STATE_RUN) || (sd_job_size == 0)) { return; }
+  uint32_t position = sd_job_read_count - (sd_block_count - sd_block_index);
+  printPgmString(PSTR("|SD:"));
+  print_uint8_base10((uint8_t)((100*(uint64_t)position)/sd_job_size));
+}
+
+#endif
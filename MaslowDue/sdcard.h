@@ -0,0 +1,49 @@
+/* This file is part of the Maslow Due Control Software.
+    The Maslow Due Control Software is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Maslow Due Control Software is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with the Maslow Control Software.  If not, see <http://www.gnu.org/licenses/>.
+
+    sdcard.h - g-code job files stored on an SD card and run without the host.
+    Enabled by SD_JOB_STORAGE in config.h.
+    */
+
+#ifndef sdcard_h
+#define sdcard_h
+
+#include "grbl.h"
+
+#define SD_JOB_BLOCK_SIZE 512  // Bytes read from the card at a time. One card sector.
+
+// States of the job storage.
+#define SD_STATE_IDLE   0
+#define SD_STATE_UPLOAD 1  // Received lines are written to the open file, until $FC.
+#define SD_STATE_RUN    2  // The main loop reads its lines from the open file.
+extern uint8_t sd_state;
+
+// Closes any open file. Called on reset, which ends an upload or a running job.
+void sd_reset();
+
+// Executes the $F commands: $FL lists the files, $FW=name uploads, $FR=name runs, $FD=name deletes.
+uint8_t sd_execute_line(char *line);
+
+// Writes one received line to the file being uploaded, or closes it when the line is $FC.
+uint8_t sd_upload_line(char *line);
+
+// Returns the next character of the running job, or SERIAL_NO_DATA once all of it has been read.
+uint8_t sd_read();
+
+// Takes the status of an executed job line in place of the 'ok' response. Errors halt the job.
+void sd_report_status(uint8_t status_code);
+
+// Prints the |SD:percent read| status report field while a job runs.
+void sd_report_progress();
+
+#endif
@@ -28,44 +28,58 @@
 #define TX_RING_BUFFER (TX_BUFFER_SIZE+1)
 
 uint8_t serial_rx_buffer[RX_RING_BUFFER];
-uint8_t serial_rx_buffer_head = 0;
-volatile uint8_t serial_rx_buffer_tail = 0;
+serial_index_t serial_rx_buffer_head = 0;
+volatile serial_index_t serial_rx_buffer_tail = 0;
+
+uint8_t serial_tx_buffer[TX_RING_BUFFER];
+serial_index_t serial_tx_buffer_head = 0;
+volatile serial_index_t serial_tx_buffer_tail = 0;
+
+#ifdef BINARY_MOTION_PROTOCOL
+  #define SERIAL_FRAME_FLAGS_NEXT 0xFF
+  static uint8_t serial_frame_remaining = 0; // Binary frame bytes still to pass through as data.
+#endif
 
 #ifdef MASLOWCNC
   #include "MaslowDue.h"
   #include "DueTimer.h"
 
   void serialScanner_handler(void);
+  static void serial_tx_pump(void);
 
     
   void serial_reset_read_buffer() 
   {
+      SERIAL_TIMER.stop();  // hold off the scanner while the port is flushed
       while(MACHINE_COM_PORT.available() != 0)
         MACHINE_COM_PORT.read();
       serial_rx_buffer_tail = serial_rx_buffer_head;
+      #ifdef BINARY_MOTION_PROTOCOL
+        serial_frame_remaining = 0;
+      #endif
 
       #ifdef ENABLE_XONXOFF
         flow_ctrl = XON_SENT;
         MACHINE_COM_PORT.write(flow_ctrl);
       #endif
+      SERIAL_TIMER.start();
   }
 
 #else
-uint8_t serial_tx_buffer[TX_RING_BUFFER];
-uint8_t serial_tx_buffer_head = 0;
-volatile uint8_t serial_tx_buffer_tail = 0;
-
   void serial_reset_read_buffer()
   {
     serial_rx_buffer_tail = serial_rx_buffer_head;
+    #ifdef BINARY_MOTION_PROTOCOL
+      serial_frame_remaining = 0;
+    #endif
   }
 #endif
 
 
 // Returns the number of bytes available in the RX serial buffer.
-uint8_t serial_get_rx_buffer_available()
+serial_index_t serial_get_rx_buffer_available()
 {
-  uint8_t rtail = serial_rx_buffer_tail; // Copy to limit multiple calls to volatile
+  serial_index_t rtail = serial_rx_buffer_tail; // Copy to limit multiple calls to volatile
   if (serial_rx_buffer_head >= rtail) { return(RX_BUFFER_SIZE - (serial_rx_buffer_head-rtail)); }
   return((rtail-serial_rx_buffer_head-1));
 }
@@ -73,9 +87,9 @@ uint8_t serial_get_rx_buffer_available()
 
 // Returns the number of bytes used in the RX serial buffer.
 // NOTE: Deprecated. Not used unless classic status reports are enabled in config.h.
-uint8_t serial_get_rx_buffer_count()
+serial_index_t serial_get_rx_buffer_count()
 {
-  uint8_t rtail = serial_rx_buffer_tail; // Copy to limit multiple calls to volatile
+  serial_index_t rtail = serial_rx_buffer_tail; // Copy to limit multiple calls to volatile
   if (serial_rx_buffer_head >= rtail) { return(serial_rx_buffer_head-rtail); }
   return (RX_BUFFER_SIZE - (rtail-serial_rx_buffer_head));
 }
@@ -83,15 +97,11 @@ uint8_t serial_get_rx_buffer_count()
 
 // Returns the number of bytes used in the TX serial buffer.
 // NOTE: Not used except for debugging and ensuring no TX bottlenecks.
-uint8_t serial_get_tx_buffer_count()
+serial_index_t serial_get_tx_buffer_count()
 {
-  #ifdef MASLOWCNC
-      return (TX_BUFFER_SIZE - MACHINE_COM_PORT.availableForWrite());
-  #else
-    uint8_t ttail = serial_tx_buffer_tail; // Copy to limit multiple calls to volatile
-    if (serial_tx_buffer_head >= ttail) { return(serial_tx_buffer_head-ttail); }
-    return (TX_RING_BUFFER - (ttail-serial_tx_buffer_head));
-  #endif
+  serial_index_t ttail = serial_tx_buffer_tail; // Copy to limit multiple calls to volatile
+  if (serial_tx_buffer_head >= ttail) { return(serial_tx_buffer_head-ttail); }
+  return (TX_RING_BUFFER - (ttail-serial_tx_buffer_head));
 }
 
 
@@ -100,6 +110,9 @@ void serial_init()
   #ifdef MASLOWCNC
         MACHINE_COM_PORT.begin(BAUD_RATE);
     // defaults to 8-bit, no parity, 1 stop bit
+    // The core UART interrupt already queues incoming bytes, so a dedicated timer drains that
+    // queue into serial_rx_buffer and picks off realtime commands. Independent of the spindle.
+    SERIAL_TIMER.attachInterrupt(serialScanner_handler).setPeriod(Serial_PERIOD);
     serial_reset_read_buffer();
   #else
     // Set baud rate
@@ -121,40 +134,74 @@ void serial_init()
 
 
 // Writes one byte to the TX serial buffer. Called by main program.
+// NOTE: Never from an interrupt handler. The ring is only drained by the serial scanner, which
+// a handler at or above IRQ_PRIORITY_SERIAL would keep from running while it waits for room.
 void serial_write(uint8_t data) 
 {
-  #ifdef MASLOWCNC
-      while(MACHINE_COM_PORT.availableForWrite() == 0)
-      { 
-        if (sys_rt_exec_state & EXEC_RESET) 
-          return;  // Only check for abort to avoid an endless loop.
-      }     
-      MACHINE_COM_PORT.write(data);
-  #else      
-    // Calculate next head
-    uint8_t next_head = serial_tx_buffer_head + 1;
-    if (next_head == TX_RING_BUFFER) { next_head = 0; }
-
-    // Wait until there is space in the buffer
-    while (next_head == serial_tx_buffer_tail) {
-      // TODO: Restructure st_prep_buffer() calls to be executed here during a long print.
-      if (sys_rt_exec_state & EXEC_RESET) { return; } // Only check for abort to avoid an endless loop.
-    }
+  // Calculate next head
+  serial_index_t next_head = serial_tx_buffer_head + 1;
+  if (next_head == TX_RING_BUFFER) { next_head = 0; }
+
+  // Wait until there is space in the buffer
+  while (next_head == serial_tx_buffer_tail) {
+    // TODO: Restructure st_prep_buffer() calls to be executed here during a long print.
+    if (sys_rt_exec_state & EXEC_RESET) { return; } // Only check for abort to avoid an endless loop.
+  }
 
-    // Store data and advance head
-    serial_tx_buffer[serial_tx_buffer_head] = data;
-    serial_tx_buffer_head = next_head;
+  // Store data and advance head
+  serial_tx_buffer[serial_tx_buffer_head] = data;
+  serial_tx_buffer_head = next_head;
 
+  #ifndef MASLOWCNC
     // Enable Data Register Empty Interrupt to make sure tx-streaming is running
     UCSR0B |=  (1 << UDRIE0);
   #endif
 }
 
-#ifndef MASLOWCNC
+
+// Writes a block of bytes to the TX serial buffer, waiting once for room for all of them and
+// advancing the head once. Called by main program.
+void serial_write_block(const uint8_t *data, serial_index_t length)
+{
+  // Wait until there is space in the buffer for the whole block
+  while ((TX_BUFFER_SIZE - serial_get_tx_buffer_count()) < length) {
+    if (sys_rt_exec_state & EXEC_RESET) { return; } // Only check for abort to avoid an endless loop.
+  }
+
+  // Store data and advance head
+  serial_index_t head = serial_tx_buffer_head;
+  while (length--) {
+    serial_tx_buffer[head] = *data++;
+    if (++head == TX_RING_BUFFER) { head = 0; }
+  }
+  serial_tx_buffer_head = head;
+
+  #ifndef MASLOWCNC
+    // Enable Data Register Empty Interrupt to make sure tx-streaming is running
+    UCSR0B |=  (1 << UDRIE0);
+  #endif
+}
+
+#ifdef MASLOWCNC
+  // Moves queued bytes into the Arduino serial driver, only as many as it can take without blocking.
+  // Called by the serial scanner timer, which makes this the Due equivalent of ISR(SERIAL_UDRE).
+  static void serial_tx_pump(void)
+  {
+    serial_index_t tail = serial_tx_buffer_tail; // Temporary serial_tx_buffer_tail (to optimize for volatile)
+    int room = MACHINE_COM_PORT.availableForWrite();
+
+    while ((tail != serial_tx_buffer_head) && (room-- > 0)) {
+      MACHINE_COM_PORT.write(serial_tx_buffer[tail]);
+      tail++;
+      if (tail == TX_RING_BUFFER) { tail = 0; }
+    }
+    serial_tx_buffer_tail = tail;
+  }
+#else
   // Data Register Empty Interrupt handler
   ISR(SERIAL_UDRE)
   {
-    uint8_t tail = serial_tx_buffer_tail; // Temporary serial_tx_buffer_tail (to optimize for volatile)
+    serial_index_t tail = serial_tx_buffer_tail; // Temporary serial_tx_buffer_tail (to optimize for volatile)
 
     // Send a byte from the buffer
     UDR0 = serial_tx_buffer[tail];
@@ -172,7 +219,7 @@ void serial_write(uint8_t data)
 
 // Fetches the first byte in the serial read buffer. Called by main program.
 uint8_t serial_read() {
-  uint8_t tail = serial_rx_buffer_tail; // Temporary serial_rx_buffer_tail (to optimize for volatile)
+  serial_index_t tail = serial_rx_buffer_tail; // Temporary serial_rx_buffer_tail (to optimize for volatile)
 
   if (serial_rx_buffer_head == tail) {
     return SERIAL_NO_DATA;
@@ -187,21 +234,40 @@ uint8_t serial_read() {
   }
 }
 
-#ifdef MASLOWCNC
- void serialScanner_handler(void)  // Ardino serial service requires this to be timer scanned vs char-interrupt driven
- {                                 // its a working compromise for sure...
-     uint8_t data = 0;     
-
-    if(MACHINE_COM_PORT.available() == 0) // a little trick to make rx queing look the same
-        return;
-    
-    data = MACHINE_COM_PORT.read();
-#else
-  ISR(SERIAL_RX)
- {
-    uint8_t data = UDR0;
+#ifdef BINARY_MOTION_PROTOCOL
+  // Queues one byte of a binary frame as is, so frame data matching a realtime command is kept.
+  static void serial_queue_frame_byte(uint8_t data)
+  {
+    serial_index_t next_head = serial_rx_buffer_head + 1;
+    if (next_head == RX_RING_BUFFER) { next_head = 0; }
+    if (next_head != serial_rx_buffer_tail) {
+      serial_rx_buffer[serial_rx_buffer_head] = data;
+      serial_rx_buffer_head = next_head;
+    }
+  }
 #endif
-    uint8_t next_head;
+
+// Pick off realtime command characters directly from the serial stream and queue the rest.
+// Shared by the AVR receive interrupt and the Maslow-Due serial scanner.
+static void serial_process_rx_byte(uint8_t data)
+{
+    serial_index_t next_head;
+
+  #ifdef BINARY_MOTION_PROTOCOL
+    // In binary mode, the frame start byte and its flags tell how many bytes of frame data follow.
+    // Realtime commands are still picked off between frames.
+    if (serial_frame_remaining) {
+      if (serial_frame_remaining == SERIAL_FRAME_FLAGS_NEXT) { serial_frame_remaining = binary_frame_length(data)-2; }
+      else { serial_frame_remaining--; }
+      serial_queue_frame_byte(data);
+      return;
+    }
+    if (binary_protocol_active && (data == BINARY_FRAME_START)) {
+      serial_frame_remaining = SERIAL_FRAME_FLAGS_NEXT;
+      serial_queue_frame_byte(data);
+      return;
+    }
+  #endif
 
   // Pick off realtime command characters directly from the serial stream. These characters are
   // not passed into the main buffer, but these set system state flag bits for realtime execution.
@@ -257,3 +323,19 @@ uint8_t serial_read() {
   }
 }
 
+#ifdef MASLOWCNC
+ void serialScanner_handler(void)  // Arduino serial service owns the UART interrupt, so drain what it
+ {                                 // has queued -- every byte available, not just one per tick.
+    PROFILE_LATENCY(PROFILE_SERIAL_LATENCY, SERIAL_TIMER_CHANNEL);
+    PROFILE_FUNCTION(PROFILE_SERIAL);
+    while(MACHINE_COM_PORT.available() != 0)
+      serial_process_rx_byte(MACHINE_COM_PORT.read());
+
+    serial_tx_pump();  // keep the outgoing ring streaming into the driver
+ }
+#else
+  ISR(SERIAL_RX)
+  {
+    serial_process_rx_byte(UDR0);
+  }
+#endif
@@ -23,11 +23,29 @@
 #define serial_h
 
 
+#ifdef MASLOWCNC
+  typedef uint16_t serial_index_t; // 16-bit ring indices allow multi-KB buffers on the Due
+#else
+  typedef uint8_t serial_index_t;
+#endif
+
 #ifndef RX_BUFFER_SIZE
-  #define RX_BUFFER_SIZE 255
+  #ifdef MASLOWCNC
+    #ifdef USE_NATIVE_USB_PORT
+      #define RX_BUFFER_SIZE 4096
+    #else
+      #define RX_BUFFER_SIZE 1024
+    #endif
+  #else
+    #define RX_BUFFER_SIZE 255
+  #endif
 #endif
 #ifndef TX_BUFFER_SIZE
-  #define TX_BUFFER_SIZE 255
+  #ifdef MASLOWCNC
+    #define TX_BUFFER_SIZE 2048 // holds a full $$ dump, so reports never wait on the port
+  #else
+    #define TX_BUFFER_SIZE 255
+  #endif
 #endif
 
 #define SERIAL_NO_DATA 0xff
@@ -35,9 +53,14 @@
 
 void serial_init();
 
-// Writes one byte to the TX serial buffer. Called by main program.
+// Writes one byte to the TX serial buffer. Called by main program only, never by an interrupt
+// handler: it waits for room in the ring, which only the serial scanner interrupt makes.
 void serial_write(uint8_t data);
 
+// Writes a block of bytes to the TX serial buffer in one piece. Called by main program only.
+// NOTE: length must not exceed TX_BUFFER_SIZE.
+void serial_write_block(const uint8_t *data, serial_index_t length);
+
 // Fetches the first byte in the serial read buffer. Called by main program.
 uint8_t serial_read();
 
@@ -45,14 +68,14 @@ uint8_t serial_read();
 void serial_reset_read_buffer();
 
 // Returns the number of bytes available in the RX serial buffer.
-uint8_t serial_get_rx_buffer_available();
+serial_index_t serial_get_rx_buffer_available();
 
 // Returns the number of bytes used in the RX serial buffer.
 // NOTE: Deprecated. Not used unless classic status reports are enabled in config.h.
-uint8_t serial_get_rx_buffer_count();
+serial_index_t serial_get_rx_buffer_count();
 
 // Returns the number of bytes used in the TX serial buffer.
-// NOTE: Not used except for debugging and ensuring no TX bottlenecks.
-uint8_t serial_get_tx_buffer_count();
+// NOTE: Used by the status auto report to avoid TX bottlenecks, and for debugging.
+serial_index_t serial_get_tx_buffer_count();
 
 #endif
@@ -26,6 +26,9 @@
 #ifdef MASLOWCNC
   #include "MaslowDue.h"
 #endif
+#ifdef SETTINGS_FLASH_SNAPSHOT
+  #include <flash_efc.h>
+#endif
 
 settings_t settings;
 
@@ -65,16 +68,22 @@ settings_t settings;
     .x_PID_Ki = default_xKi,
     .x_PID_Kd = default_xKd,
     .x_PID_Imax = default_xImax,
+    .x_PID_Kvff = default_xKvff,
+    .x_PID_Kaff = default_xKaff,
 
     .y_PID_Kp = default_yKp,
     .y_PID_Ki = default_yKi,
     .y_PID_Kd = default_yKd,
     .y_PID_Imax = default_yImax,
+    .y_PID_Kvff = default_yKvff,
+    .y_PID_Kaff = default_yKaff,
 
     .z_PID_Kp = default_zKp,
     .z_PID_Ki = default_zKi,
     .z_PID_Kd = default_zKd,
     .z_PID_Imax = default_zImax,
+    .z_PID_Kvff = default_zKvff,
+    .z_PID_Kaff = default_zKaff,
 
     .chainOverSprocket = default_chainOverSprocket,
     .distBetweenMotors = default_distBetweenMotors,
@@ -98,7 +107,12 @@ settings_t settings;
 
     .zTravelMin = default_ZTravelMin,
     .simpleKinematics = default_SimpleKinematics,
-    .homeChainLengths = default_HomeChainLengths };
+    .homeChainLengths = default_HomeChainLengths,
+    .segmentTolerance = default_SegmentTolerance,
+    .pidRate = default_PidRate,
+    .autoReportInterval = default_AutoReportInterval,
+    .autoReportIdleInterval = default_AutoReportIdleInterval,
+    .jerk = default_Jerk };
 
 #else
 
@@ -172,12 +186,71 @@ void settings_write_coord_data(uint8_t coord_select, float *coord_data)
 }
 
 
+#ifdef SETTINGS_FLASH_SNAPSHOT
+  // Copy of the last good settings record in the last pages of internal flash bank 1, where the
+  // sketch never reaches. Uploading firmware erases it, so the first boot after reads the EEPROM.
+  typedef struct {
+    uint32_t magic;
+    uint16_t version;   // SETTINGS_VERSION
+    uint16_t size;      // sizeof(settings_t)
+    uint32_t checksum;  // FNV-1a of the settings record
+    settings_t settings;
+  } settings_snapshot_t;
+  #define SETTINGS_SNAPSHOT_MAGIC 0x5053534DUL  // "MSSP"
+  #define SETTINGS_SNAPSHOT_SIZE (((sizeof(settings_snapshot_t)+IFLASH1_PAGE_SIZE-1)/IFLASH1_PAGE_SIZE)*IFLASH1_PAGE_SIZE)
+  #define SETTINGS_SNAPSHOT_ADDR (IFLASH1_ADDR + IFLASH1_SIZE - SETTINGS_SNAPSHOT_SIZE)
+
+  static uint32_t settings_snapshot_checksum(const settings_t *record)
+  {
+    const uint8_t *data = (const uint8_t *)record;
+    uint32_t hash = 2166136261UL;
+    for (uint16_t idx = 0; idx < sizeof(settings_t); idx++) { hash = (hash ^ data[idx]) * 16777619UL; }
+    return(hash);
+  }
+
+  // Loads the settings from the snapshot. Returns false, if there is no valid snapshot.
+  static uint8_t settings_read_snapshot()
+  {
+    const settings_snapshot_t *snapshot = (const settings_snapshot_t *)SETTINGS_SNAPSHOT_ADDR;
+    if ((snapshot->magic != SETTINGS_SNAPSHOT_MAGIC) || (snapshot->version != SETTINGS_VERSION) ||
+        (snapshot->size != sizeof(settings_t))) { return(false); }
+    if (snapshot->checksum != settings_snapshot_checksum(&snapshot->settings)) { return(false); }
+    memcpy(&settings, &snapshot->settings, sizeof(settings_t));
+    return(true);
+  }
+
+  // Rewrites the snapshot with the current settings, unless it already holds them.
+  static void settings_write_snapshot()
+  {
+    static settings_snapshot_t snapshot; // Kept off the stack.
+    snapshot.magic = SETTINGS_SNAPSHOT_MAGIC;
+    snapshot.version = SETTINGS_VERSION;
+    snapshot.size = sizeof(settings_t);
+    memcpy(&snapshot.settings, &settings, sizeof(settings_t));
+    snapshot.checksum = settings_snapshot_checksum(&snapshot.settings);
+    if (memcmp((const void *)SETTINGS_SNAPSHOT_ADDR, &snapshot, sizeof(settings_snapshot_t)) == 0) { return; }
+
+    // Bank 1 is written while the code runs from bank 0. Erases and writes a page at a time.
+    flash_init(FLASH_ACCESS_MODE_128, 4); // Same wait states as the core sets for 84MHz.
+    flash_unlock(SETTINGS_SNAPSHOT_ADDR, SETTINGS_SNAPSHOT_ADDR + SETTINGS_SNAPSHOT_SIZE - 1, 0, 0);
+    flash_write(SETTINGS_SNAPSHOT_ADDR, &snapshot, sizeof(settings_snapshot_t), 1);
+    flash_lock(SETTINGS_SNAPSHOT_ADDR, SETTINGS_SNAPSHOT_ADDR + SETTINGS_SNAPSHOT_SIZE - 1, 0, 0);
+  }
+#endif
+
+
 // Method to store Grbl global settings struct and version number into EEPROM
 // NOTE: This function can only be called in IDLE state.
 void write_global_settings()
 {
   eeprom_put_char(0, SETTINGS_VERSION);
   memcpy_to_eeprom_with_checksum(EEPROM_ADDR_GLOBAL, (char*)&settings, sizeof(settings_t));
+  #ifdef SETTINGS_FLASH_SNAPSHOT
+    settings_write_snapshot();
+  #endif
+  #ifdef MASLOWCNC
+    recomputeGeometry(); // Refresh cached kinematics constants with the new settings.
+  #endif
 }
 
 
@@ -256,6 +329,9 @@ uint8_t settings_read_coord_data(uint8_t coord_select, float *coord_data)
 
 // Reads Grbl global settings struct from EEPROM.
 uint8_t read_global_settings() {
+  #ifdef SETTINGS_FLASH_SNAPSHOT
+    if (settings_read_snapshot()) { return(true); } // Skips the EEPROM.
+  #endif
   // Check version-byte of eeprom
   uint8_t version = eeprom_get_char(0);
   if (version == SETTINGS_VERSION) {
@@ -266,6 +342,9 @@ uint8_t read_global_settings() {
   } else {
     return(false);
   }
+  #ifdef SETTINGS_FLASH_SNAPSHOT
+    settings_write_snapshot(); // For the next boot.
+  #endif
   return(true);
 }
 
@@ -380,16 +459,22 @@ uint8_t settings_store_global_setting(uint8_t parameter, float value) {
         case 41: settings.x_PID_Ki = (uint32_t)value ; break;
         case 42: settings.x_PID_Kd = (uint32_t)value ; break;
         case 43: settings.x_PID_Imax = (uint32_t)value ; break;
+        case 48: settings.x_PID_Kvff = (uint32_t)value ; break;
+        case 49: settings.x_PID_Kaff = (uint32_t)value ; break;
 
         case 50: settings.y_PID_Kp = (uint32_t)value ; break;
         case 51: settings.y_PID_Ki = (uint32_t)value ; break;
         case 52: settings.y_PID_Kd = (uint32_t)value ; break;
         case 53: settings.y_PID_Imax = (uint32_t)value ; break;
+        case 58: settings.y_PID_Kvff = (uint32_t)value ; break;
+        case 59: settings.y_PID_Kaff = (uint32_t)value ; break;
 
         case 60: settings.z_PID_Kp = (uint32_t)value ; break;
         case 61: settings.z_PID_Ki = (uint32_t)value ; break;
         case 62: settings.z_PID_Kd = (uint32_t)value ; break;
         case 63: settings.z_PID_Imax = (uint32_t)value ; break;
+        case 68: settings.z_PID_Kvff = (uint32_t)value ; break;
+        case 69: settings.z_PID_Kaff = (uint32_t)value ; break;
 
         case GRBL_CHAIN_OVER_SPROCKET: settings.chainOverSprocket = (uint32_t)value ; break;
         case GRBL_MACHINE_WIDTH: settings.machineWidth = (float)value ; break;
@@ -411,6 +496,21 @@ uint8_t settings_store_global_setting(uint8_t parameter, float value) {
         case GRBL_SLED_WEIGHT: settings.sledWeight = (float)value; break;
         case GRBL_CHAIN_ELONGATION_FACTOR: settings.chainElongationFactor = (float)value; break;
         case GRBL_HOME_CHAIN_LENGTHS: settings.homeChainLengths = (uint32_t)value; break;
+        case GRBL_SEGMENT_TOLERANCE:
+          if (value <= 0.0) { return(STATUS_NEGATIVE_VALUE); }
+          settings.segmentTolerance = value; break;
+        case GRBL_PID_RATE: // Reset to ensure change. Takes effect with the loop gains at power-up.
+          if ((value < PID_RATE_MIN) || (value > PID_RATE_MAX)) { return(STATUS_INVALID_STATEMENT); }
+          settings.pidRate = (uint32_t)value; break;
+        case GRBL_AUTO_REPORT_INTERVAL:
+          if ((value != 0) && ((value < AUTO_REPORT_INTERVAL_MIN) || (value > AUTO_REPORT_INTERVAL_MAX))) { return(STATUS_INVALID_STATEMENT); }
+          settings.autoReportInterval = (uint32_t)value; break;
+        case GRBL_AUTO_REPORT_IDLE_INTERVAL:
+          if ((value != 0) && ((value < AUTO_REPORT_INTERVAL_MIN) || (value > AUTO_REPORT_INTERVAL_MAX))) { return(STATUS_INVALID_STATEMENT); }
+          settings.autoReportIdleInterval = (uint32_t)value; break;
+        case GRBL_JERK: // Used with S_CURVE_ACCELERATION only.
+          if (value < 0.0) { return(STATUS_NEGATIVE_VALUE); }
+          settings.jerk = value; break;
       #endif
 
       default:
@@ -429,6 +529,9 @@ void settings_init() {
     settings_restore(SETTINGS_RESTORE_ALL); // Force restore all EEPROM data.
     report_grbl_settings();
   }
+  #ifdef MASLOWCNC
+    recomputeGeometry(); // Cache kinematics constants derived from the loaded settings.
+  #endif
 }
 
 
@@ -33,7 +33,7 @@
 
 // Version of the EEPROM data. Will be used to migrate existing data from older versions of Grbl
 // when firmware is upgraded. Always stored in byte 0 of eeprom
-#define SETTINGS_VERSION 10  // NOTE: Check settings_reset() when moving to next version.
+#define SETTINGS_VERSION 15  // NOTE: Check settings_reset() when moving to next version.
 
 // Define bit flag masks for the boolean settings in settings.flag.
 #define BIT_REPORT_INCHES      0
@@ -57,6 +57,7 @@
 // Define status reporting boolean enable bit flags in settings.status_report_mask
 #define BITFLAG_RT_STATUS_POSITION_TYPE     bit(0)
 #define BITFLAG_RT_STATUS_BUFFER_STATE      bit(1)
+#define BITFLAG_RT_STATUS_STARVATION        bit(2)
 
 // Define settings restore bitflags.
 #define SETTINGS_RESTORE_DEFAULTS bit(0)
@@ -126,14 +127,20 @@ typedef struct {
     uint32_t x_PID_Ki;
     uint32_t x_PID_Kd;
     uint32_t x_PID_Imax;
+    uint32_t x_PID_Kvff;  // feed-forward of the commanded chain velocity and acceleration
+    uint32_t x_PID_Kaff;
     uint32_t y_PID_Kp;  // PID coefficients
     uint32_t y_PID_Ki;
     uint32_t y_PID_Kd;
     uint32_t y_PID_Imax;
+    uint32_t y_PID_Kvff;  // feed-forward of the commanded chain velocity and acceleration
+    uint32_t y_PID_Kaff;
     uint32_t z_PID_Kp;  // PID coefficients
     uint32_t z_PID_Ki;
     uint32_t z_PID_Kd;
     uint32_t z_PID_Imax;
+    uint32_t z_PID_Kvff;  // feed-forward of the commanded chain velocity and acceleration
+    uint32_t z_PID_Kaff;
 
     uint32_t chainOverSprocket;
     float distBetweenMotors;
@@ -155,6 +162,11 @@ typedef struct {
     float zTravelMin;
     uint32_t simpleKinematics;
     uint32_t homeChainLengths;
+    float segmentTolerance;   // max x-y deviation of a chain-space line segment, mm
+    uint32_t pidRate;         // servo loop rate, Hz. PID gains are stored for the 100Hz loop.
+    uint32_t autoReportInterval;     // pushed status report period while busy, ms. 0 is off.
+    uint32_t autoReportIdleInterval; // pushed status report period at rest, ms. 0 is off.
+    float jerk;               // S-curve ramp jerk, mm/sec^3. 0 is the trapezoid profile.
   #endif
 
 
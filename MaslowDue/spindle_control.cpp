@@ -25,14 +25,11 @@
 
 #ifdef MASLOWCNC
   #include "MaslowDue.h"
-  #include "DueTimer.h"
 
-  uint16_t current_pwm;
   int spindle_running = 0;
+  static uint32_t spindle_pwm_scale; // PWM channel counts per spindle pwm value, 16 fractional bits.
 
-  void serialScanner_handler(void);
-  void Spindle_SPINDLE_TIMER_handler(void);
-
+  #define SPINDLE_PWM_DUTY PWM->PWM_CH_NUM[SPINDLE_PWM_CHANNEL].PWM_CDTYUPD // Applied at the next period.
 #endif
 
 static float pwm_gradient; // Precalulated value to speed up rpm to PWM conversions.
@@ -49,53 +46,30 @@ void spindle_init()
     SPINDLE_ENABLE_DDR |= (1<<SPINDLE_ENABLE_BIT); // Configure as output pin.
     SPINDLE_DIRECTION_DDR |= (1<<SPINDLE_DIRECTION_BIT); // Configure as output pin.
 
-  #else 
-     SPINDLE_TIMER.attachInterrupt(Spindle_SPINDLE_TIMER_handler).setPeriod(Spindle_PERIOD).start();
-     spindle_running = 0;
+  #else
+    // Run the spindle pin from its hardware PWM channel. The channel counts MCK, divided by the
+    // smallest power of two that fits the period in its 16 bit counter. The output starts each
+    // period high, so the duty count is the high time and a full period holds the pin high.
+    uint32_t prescale = 0;
+    while ((VARIANT_MCK / ((uint32_t)SPINDLE_PWM_FREQUENCY << prescale)) > 0xFFFF) { prescale++; }
+    uint32_t period = VARIANT_MCK / ((uint32_t)SPINDLE_PWM_FREQUENCY << prescale);
+
+    pmc_enable_periph_clk(PWM_INTERFACE_ID);
+    PWMC_DisableChannel(PWM_INTERFACE, SPINDLE_PWM_CHANNEL);
+    PWMC_ConfigureChannel(PWM_INTERFACE, SPINDLE_PWM_CHANNEL, prescale, 0, PWM_CMR_CPOL);
+    PWMC_SetPeriod(PWM_INTERFACE, SPINDLE_PWM_CHANNEL, period);
+    PWMC_SetDutyCycle(PWM_INTERFACE, SPINDLE_PWM_CHANNEL, 0);
+    PWMC_EnableChannel(PWM_INTERFACE, SPINDLE_PWM_CHANNEL);
+    PIO_Configure(Spindle_PWM_PIO, PIO_PERIPH_B, Spindle_PWM_PERIPH, PIO_DEFAULT);
+
+    spindle_pwm_scale = (period << 16) / (uint32_t)SPINDLE_PWM_MAX_VALUE;
+    spindle_running = 0;
   #endif
 
   pwm_gradient = SPINDLE_PWM_RANGE/(settings.rpm_max-settings.rpm_min);
   spindle_stop();
 }
 
-#ifdef MASLOWCNC
-
-void Spindle_SPINDLE_TIMER_handler(void)
-{
-    float high_side_time = (float)current_pwm;
-
-    high_side_time /= SPINDLE_PWM_MAX_VALUE;    // percent of total time
-    float low_side_time = 1 - high_side_time;
-
-    SPINDLE_TIMER.stop();
-    if(current_pwm != 0)
-    {
-      if(current_pwm >= SPINDLE_PWM_MAX_VALUE)
-      {
-        digitalWrite(Spindle_PWM, 1); // set output high (full speed)
-        SPINDLE_TIMER.setPeriod((int)(Spindle_PERIOD)).start();             
-      }
-      else if(digitalRead(Spindle_PWM))
-      {
-          digitalWrite(Spindle_PWM, 0); // set output low
-          SPINDLE_TIMER.setPeriod((int)(Spindle_PERIOD * low_side_time)).start();       
-      }
-      else
-      {
-          digitalWrite(Spindle_PWM, 1); // set output low
-          SPINDLE_TIMER.setPeriod((int)(Spindle_PERIOD * high_side_time)).start();            
-      }    
-    }
-    else
-    {
-          digitalWrite(Spindle_PWM, 0); // set output low    
-          SPINDLE_TIMER.setPeriod((int)(Spindle_PERIOD)).start();     
-    }
-
-    serialScanner_handler(); // borrow this timer for serial preprocessing if available
-}
-#endif
-
 uint8_t spindle_get_state()
 {
   #ifndef MASLOWCNC
@@ -120,7 +94,7 @@ uint8_t spindle_get_state()
 void spindle_stop()
 {
   #ifdef MASLOWCNC
-    current_pwm = 0;
+    SPINDLE_PWM_DUTY = 0;
     spindle_running = 0;
   #else
     SPINDLE_TCCRA_REGISTER &= ~(1<<SPINDLE_COMB_BIT); // Disable PWM. Output voltage is zero.
@@ -138,8 +112,8 @@ void spindle_stop()
 void spindle_set_speed(uint16_t pwm_value)
 {
   #ifdef MASLOWCNC
-    current_pwm = pwm_value;
-    if(current_pwm != 0)
+    SPINDLE_PWM_DUTY = (pwm_value * spindle_pwm_scale + 0x8000) >> 16;
+    if(pwm_value != 0)
       spindle_running = 1;
   #else
     SPINDLE_OCR_REGISTER = pwm_value; // Set PWM output level.
@@ -45,6 +45,24 @@
 #define PREP_FLAG_PARKING bit(2)
 #define PREP_FLAG_DECEL_OVERRIDE bit(3)
 
+#ifdef STEP_PREP_FIXED_POINT
+  // Fixed-point segment preparation units. Distances are in 1/4096 steps (blocks up to 524k steps),
+  // time in 2^-20 sec ticks (~0.954us), speeds in 1/256 steps/sec and accelerations in 1/256
+  // steps/sec^2. Binary time lets every speed*time product reduce to a shift, so only ramp
+  // junctions need a division. The fine distance keeps the last step into a full stop, where the
+  // time is the remaining distance over a near-zero speed, close to the float result.
+  #define FX_DIST_SHIFT 12
+  #define FX_SPEED_SHIFT 8
+  #define FX_TIME_SHIFT 20
+  #define FX_MOVE_SHIFT (FX_TIME_SHIFT+FX_SPEED_SHIFT-FX_DIST_SHIFT) // speed*time to distance
+  #define FX_DT_SEGMENT (((1UL<<FX_TIME_SHIFT)+ACCELERATION_TICKS_PER_SECOND/2)/ACCELERATION_TICKS_PER_SECOND) // ticks/segment
+  #define FX_REQ_INCREMENT ((int32_t)(REQ_MM_INCREMENT_SCALAR*(1<<FX_DIST_SHIFT))) // 1.25 steps
+  // Microseconds per tick, as the ratio FX_US_PER_TICK_NUM/FX_US_PER_TICK_DEN (=1e6/2^20).
+  // NOTE: FX_US_PER_TICK_DEN must stay a multiple of 2^FX_DIST_SHIFT.
+  #define FX_US_PER_TICK_NUM 15625UL
+  #define FX_US_PER_TICK_DEN 16384UL
+#endif
+
 // Define Adaptive Multi-Axis Step-Smoothing(AMASS) levels and cutoff frequencies. The highest level
 // frequency bin starts at 0Hz and ends at its cutoff frequency. The next lower level frequency bin
 // starts at the next higher cutoff frequency, and so on. The cutoff frequencies for each level must
@@ -91,7 +109,11 @@ static st_block_t st_block_buffer[SEGMENT_BUFFER_SIZE-1];
 // the planner, where the remaining planner block steps still can.
 typedef struct {
   uint16_t n_step;           // Number of step events to be executed for this segment
-  uint16_t cycles_per_tick;  // Step distance traveled per ISR tick, aka step rate.
+  #ifdef STEP_STREAMING_INTERPOLATOR
+    uint32_t cycles_per_tick;  // Microseconds per step event. Never loaded into a timer, so not limited to 16 bits.
+  #else
+    uint16_t cycles_per_tick;  // Step distance traveled per ISR tick, aka step rate.
+  #endif
   uint8_t  st_block_index;   // Stepper block data index. Uses this information to execute this segment.
   #ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
     uint8_t amass_level;    // Indicates AMASS level for the ISR to execute this segment
@@ -99,6 +121,13 @@ typedef struct {
     uint8_t prescaler;      // Without AMASS, a prescaler is required to adjust for slow timing.
   #endif
   uint16_t spindle_pwm;
+  #if defined(MASLOWCNC) && defined(LASER_DYNAMIC_POWER)
+    uint16_t spindle_pwm_entry; // Laser power at the segment entry speed. spindle_pwm is at the exit speed.
+  #endif
+  #ifdef MASLOWCNC
+    int32_t ff_velocity[N_AXIS];     // Commanded axis velocity for the PID feed-forward (counts/sec)
+    int32_t ff_acceleration[N_AXIS]; // Commanded axis acceleration (counts/sec^2)
+  #endif
 } segment_t;
 static segment_t segment_buffer[SEGMENT_BUFFER_SIZE];
 
@@ -131,6 +160,16 @@ typedef struct {
 
   uint16_t step_count;       // Steps remaining in line segment motion
   uint8_t exec_block_index; // Tracks the current st_block index. Change indicates new block.
+  #ifdef STEP_STREAMING_INTERPOLATOR
+    uint32_t stream_elapsed;         // Microseconds of the executing segment already interpolated
+    uint32_t stream_events;          // Step events of the executing block done by earlier segments (Q7)
+    uint32_t stream_offset[N_AXIS];  // Interpolated distance from the block start in encoder counts (Q7)
+    uint32_t stream_steps[N_AXIS];   // Whole steps of stream_offset already added to sys_position
+  #endif
+  #if defined(MASLOWCNC) && defined(LASER_DYNAMIC_POWER)
+    int32_t spindle_pwm_ramp;        // Laser power through the executing segment (Q16)
+    int32_t spindle_pwm_rate;        // Laser power change per step event (Q16)
+  #endif
   st_block_t *exec_block;   // Pointer to the block data for the segment being executed
   segment_t *exec_segment;  // Pointer to the segment being executed
 } stepper_t;
@@ -141,6 +180,39 @@ static volatile uint8_t segment_buffer_tail;
 static uint8_t segment_buffer_head;
 static uint8_t segment_next_head;
 
+#ifdef S_CURVE_ACCELERATION
+  // Segments from segment_buffer_head up to segment_prep_head are prepped but wait for the S-curve
+  // smoothing to time them. segment_next_head follows segment_prep_head instead.
+  static uint8_t segment_prep_head;
+
+  // Planned profile of each prepped segment, by segment buffer index. Kept after the segment has
+  // run, for as long as the smoothing window still covers it.
+  typedef struct {
+    float dt;           // Profile segment time, without the partial step time (min)
+    float mm;           // Path distance of the segment (mm)
+    float inv_rate;     // Profile step period, with the partial step time (min/step)
+    float step_per_mm;  // Step events per mm of path of the segment block
+    float entry_speed;  // Profile speeds at the segment ends (mm/min)
+    float exit_speed;
+    float rate_rpm;     // Spindle speed per mm/min of a rate adjusted laser segment. Negative if not.
+  } st_scurve_piece_t;
+  static st_scurve_piece_t scurve_piece[SEGMENT_BUFFER_SIZE];
+
+  // Moving average window over the planned profile. See st_scurve_commit().
+  typedef struct {
+    float window;       // Smoothing time (min). Zero runs the profile as planned.
+    uint8_t lead;       // Segment the leading edge of the window is in
+    uint8_t trail;      // Segment the trailing edge is in. Older segments are free.
+    float lead_time;    // Time of the edges into their segments (min). A negative trail time is
+    float trail_time;   // rest before the trail segment.
+    float elapsed;      // Window travel since the end of the last timed segment (min)
+    float speed;        // Smoothed speed at the end of the last timed segment (mm/min)
+    uint8_t restart;    // From rest. The window is set from the settings at the next segment.
+  } st_scurve_t;
+  static st_scurve_t scurve;
+  static void st_scurve_reset();
+#endif
+
 // Step and direction port invert masks.
 #ifdef DEFAULTS_RAMPS_BOARD
   static uint8_t step_port_invert_mask[N_AXIS];
@@ -187,6 +259,31 @@ typedef struct {
 
   float inv_rate;    // Used by PWM laser mode to speed up segment calculations.
   uint16_t current_spindle_pwm; 
+  #if defined(MASLOWCNC) && defined(LASER_DYNAMIC_POWER)
+    uint16_t entry_spindle_pwm; // Laser power at the entry speed of the segment being prepped.
+  #endif
+
+  #ifdef STEP_PREP_FIXED_POINT
+    // Fixed-point copies of the profile above, converted once per block or profile update.
+    // NOTE: steps_remaining and dt_remainder are not used. fx_steps_remaining and fx_dt_remainder
+    // hold the same data in whole steps and time ticks.
+    int32_t fx_mm_remaining;     // Distance to end of block. Mirrors pl_block->millimeters.
+    int32_t fx_mm_complete;
+    int32_t fx_accelerate_until;
+    int32_t fx_decelerate_after;
+    int32_t fx_current_speed;
+    int32_t fx_maximum_speed;
+    int32_t fx_exit_speed;
+    int32_t fx_acceleration;
+    uint32_t fx_steps_remaining;
+    uint32_t fx_dt_remainder;
+    float fx_dist_to_mm;         // Converts fixed distance back to mm for the planner.
+    float fx_speed_to_mm_min;    // Converts fixed speed back to mm/min for reporting and the planner.
+    #ifdef PARKING_ENABLE
+      uint32_t last_fx_steps_remaining;
+      uint32_t last_fx_dt_remainder;
+    #endif
+  #endif
 } st_prep_t;
 static st_prep_t prep;
 
@@ -281,7 +378,9 @@ void st_wake_up()
       st.step_pulse_time = -(((settings.pulse_microseconds-2)*TICKS_PER_MICROSECOND) >> 3);
     #endif
   
-  #ifdef MASLOWCNC
+  #ifdef STEP_STREAMING_INTERPOLATOR
+      Timer4.attachInterrupt(timer4_handler).start(STREAM_INTERPOLATION_US); // Fixed rate. Never reloaded.
+  #elif defined(MASLOWCNC)
       Timer4.attachInterrupt(timer4_handler).start(settings.pulse_microseconds * 100);
   #else
     // Enable Stepper Driver Interrupt
@@ -309,6 +408,9 @@ void st_go_idle()
     bool pin_state = false; // Keep enabled.
   #else
       Timer4.stop();
+      x_axis.ff_velocity = x_axis.ff_acceleration = 0; // Nothing commanded. Feedback only.
+      y_axis.ff_velocity = y_axis.ff_acceleration = 0;
+      z_axis.ff_velocity = z_axis.ff_acceleration = 0;
   #endif
 
   busy = false;
@@ -395,12 +497,192 @@ void st_go_idle()
 // int8 variables and update position counters only when a segment completes. This can get complicated
 // with probing and homing cycles that require true real-time positions.
 
+#ifdef MASLOWCNC
+  // Computes the commanded axis velocity and acceleration of a prepped segment for the PID
+  // feed-forward terms. Uses the mean speed and the speed change of the segment, given its entry
+  // and exit speeds and duration (min), scaled by the axis steps per mm of path of its stepper
+  // block. Signed as sys_position.
+  static void st_prep_feed_forward(segment_t *segment, float step_per_mm, float entry_speed, float exit_speed, float dt)
+  {
+    uint8_t idx;
+    st_block_t *block = &st_block_buffer[segment->st_block_index];
+    float speed = (entry_speed+exit_speed)*(0.5/60.0); // mm/sec
+    float accel = 0.0;
+    if (dt > 0.0) { accel = (exit_speed-entry_speed)/(dt*(60.0*60.0)); } // mm/sec^2
+    float steps_per_path_mm = step_per_mm/block->step_event_count; // Same ratio with AMASS scaling.
+    for (idx=0; idx<N_AXIS; idx++) {
+      float axis_steps_per_mm = block->steps[idx]*steps_per_path_mm;
+      int32_t velocity = lroundf(speed*axis_steps_per_mm);
+      int32_t acceleration = lroundf(accel*axis_steps_per_mm);
+      if (block->direction_bits & get_direction_pin_mask(idx)) {
+        velocity = -velocity;
+        acceleration = -acceleration;
+      }
+      segment->ff_velocity[idx] = velocity;
+      segment->ff_acceleration[idx] = acceleration;
+    }
+  }
+
+  // Hands the feed-forward of the segment being executed to the PID loops, signed as the targets.
+  static void st_load_feed_forward(segment_t *segment)
+  {
+    int32_t sign[N_AXIS] = { 1, -1, 1 }; // REVERSED 'Right Motor'
+    uint8_t idx;
+    for (idx=0; idx<N_AXIS; idx++) {
+      if (dir_port_invert_mask & get_direction_pin_mask(idx)) { sign[idx] = -sign[idx]; }
+      if ((sys.state == STATE_HOMING) && !(sys.homing_axis_lock & get_step_pin_mask(idx))) { sign[idx] = 0; }
+    }
+    x_axis.ff_velocity = sign[X_AXIS]*segment->ff_velocity[X_AXIS];
+    x_axis.ff_acceleration = sign[X_AXIS]*segment->ff_acceleration[X_AXIS];
+    y_axis.ff_velocity = sign[Y_AXIS]*segment->ff_velocity[Y_AXIS];
+    y_axis.ff_acceleration = sign[Y_AXIS]*segment->ff_acceleration[Y_AXIS];
+    z_axis.ff_velocity = sign[Z_AXIS]*segment->ff_velocity[Z_AXIS];
+    z_axis.ff_acceleration = sign[Z_AXIS]*segment->ff_acceleration[Z_AXIS];
+  }
+#endif
+
+
+#ifdef REPORT_FIELD_STARVATION
+  // Counts the step ISR running out of segments while the planner still holds blocks to run. The
+  // end of a feed hold or jog cancel stops the motion on purpose and is not counted.
+  static void st_count_underrun()
+  {
+    if ((sys.state & (STATE_CYCLE | STATE_JOG)) && !(sys.step_control & STEP_CONTROL_END_MOTION) &&
+        (plan_get_current_block() != NULL)) {
+      sys_starvation.segment_underruns++;
+    }
+  }
+#endif
+
+
+#ifdef STEP_STREAMING_INTERPOLATOR
+/* Step-less position streaming interpolator. On the Maslow a "step" only ever moves a PID target
+   by one encoder count, so Timer4 is not reloaded per step. It runs at the fixed
+   STREAM_INTERPOLATION_US period instead, and each tick advances through the segment buffer by
+   that much time. The step events completed in the executing block are tracked with 7 fractional
+   bits, and every axis is placed at the same fraction of its block step count. The result goes
+   straight into the PID_MOTION target_PS, with target = target_PS >> 7 as in the TUNING_MODE step
+   test. sys_position follows the whole steps for status reports, probing and homing.
+   NOTE: Segments keep the whole step counts from st_prep_buffer(), so every block still ends
+   exactly on its planned steps. AMASS is not used, as there are no step pulses to smooth.
+*/
+
+// Moves one axis to the interpolated distance from the block start. While homing, a locked out
+// axis keeps its target, like the masked step bits of the stepping ISR, but sys_position still
+// tracks it.
+static void st_stream_axis(uint8_t idx, struct PID_MOTION *axis_ptr, uint8_t reverse, uint32_t events)
+{
+  uint32_t steps = st.exec_block->steps[idx];
+  if (steps == 0) { return; }
+
+  uint32_t offset;
+  if (events <= (0xFFFFFFFFUL/steps)) { offset = (events*steps)/st.exec_block->step_event_count; }
+  else { offset = ((uint64_t)events*steps)/st.exec_block->step_event_count; }
+  uint32_t delta = offset - st.stream_offset[idx];
+  st.stream_offset[idx] = offset;
+
+  uint32_t whole_steps = (offset + 64) >> 7; // Rounded, as the Bresenham counters start half way.
+  if (st.exec_block->direction_bits & get_direction_pin_mask(idx)) { sys_position[idx] -= whole_steps-st.stream_steps[idx]; }
+  else { sys_position[idx] += whole_steps-st.stream_steps[idx]; }
+  st.stream_steps[idx] = whole_steps;
+
+  if ((sys.state == STATE_HOMING) && !(sys.homing_axis_lock & get_step_pin_mask(idx))) { return; }
+  if ((st.exec_block->direction_bits ^ dir_port_invert_mask) & get_direction_pin_mask(idx)) { reverse = !reverse; }
+  if (reverse) { axis_ptr->target_PS -= delta; }
+  else { axis_ptr->target_PS += delta; }
+  axis_ptr->target = axis_ptr->target_PS >> 7;
+}
+
+static void st_stream_position(uint32_t events)
+{
+  st_stream_axis(X_AXIS, &x_axis, false, events); // 'Left Motor'
+  st_stream_axis(Y_AXIS, &y_axis, true, events);  // REVERSED 'Right Motor'
+  st_stream_axis(Z_AXIS, &z_axis, false, events);
+}
+
+void timer4_handler(void)
+{
+  PROFILE_LATENCY(PROFILE_STEP_LATENCY, STEP_TIMER_CHANNEL);
+  PROFILE_FUNCTION(PROFILE_STEP);
+  if (busy) { return; } // The busy-flag is used to avoid reentering this interrupt
+  busy = true;
+
+  uint32_t tick_us = STREAM_INTERPOLATION_US;
+  for (;;) {
+    // If there is no step segment, attempt to pop one from the stepper buffer
+    if (st.exec_segment == NULL) {
+      if (segment_buffer_head != segment_buffer_tail) {
+        st.exec_segment = &segment_buffer[segment_buffer_tail];
+        st.stream_elapsed = 0;
+        // A new planner block restarts the interpolation from its first step event.
+        if ( st.exec_block_index != st.exec_segment->st_block_index ) {
+          st.exec_block_index = st.exec_segment->st_block_index;
+          st.exec_block = &st_block_buffer[st.exec_block_index];
+          st.stream_events = 0;
+          memset(st.stream_offset, 0, sizeof(st.stream_offset));
+          memset(st.stream_steps, 0, sizeof(st.stream_steps));
+        }
+        // Set real-time spindle output as segment is loaded.
+        #ifdef LASER_DYNAMIC_POWER
+          spindle_set_speed(st.exec_segment->spindle_pwm_entry);
+        #else
+          spindle_set_speed(st.exec_segment->spindle_pwm);
+        #endif
+        st_load_feed_forward(st.exec_segment);
+      } else {
+        // Segment buffer empty. Shutdown.
+        #ifdef REPORT_FIELD_STARVATION
+          st_count_underrun();
+        #endif
+        if (sys_probe_state == PROBE_ACTIVE) { probe_state_monitor(); }
+        st_go_idle();
+        // Ensure pwm is set properly upon completion of rate-controlled motion.
+        if (st.exec_block->is_pwm_rate_adjusted) { spindle_set_speed(SPINDLE_PWM_OFF_VALUE); }
+        system_set_exec_state_flag(EXEC_CYCLE_STOP); // Flag main program for cycle end
+        return; // Nothing to do but exit.
+      }
+    }
+
+    uint32_t segment_us = st.exec_segment->n_step*st.exec_segment->cycles_per_tick;
+    if (st.stream_elapsed + tick_us < segment_us) {
+      // Tick ends inside this segment. Interpolate the partial step events.
+      st.stream_elapsed += tick_us;
+      st_stream_position(st.stream_events + (st.stream_elapsed << 7)/st.exec_segment->cycles_per_tick);
+      #ifdef LASER_DYNAMIC_POWER
+        // Laser power follows the commanded speed from the segment entry to its exit.
+        if (st.exec_segment->spindle_pwm != st.exec_segment->spindle_pwm_entry) {
+          int32_t pwm_change = (int32_t)st.exec_segment->spindle_pwm - st.exec_segment->spindle_pwm_entry;
+          spindle_set_speed(st.exec_segment->spindle_pwm_entry + (pwm_change*(int32_t)st.stream_elapsed)/(int32_t)segment_us);
+        }
+      #endif
+      break;
+    }
+
+    // Segment is complete within this tick. Place it exactly, then carry the time left over into
+    // the next segment.
+    tick_us -= segment_us - st.stream_elapsed;
+    st.stream_events += ((uint32_t)st.exec_segment->n_step << 7);
+    st_stream_position(st.stream_events);
+    st.exec_segment = NULL;
+    if ( ++segment_buffer_tail == SEGMENT_BUFFER_SIZE) { segment_buffer_tail = 0; }
+  }
+
+  // Check probing state.
+  if (sys_probe_state == PROBE_ACTIVE) { probe_state_monitor(); }
+
+  busy = false;
+}
+
+#else
+
 #ifdef MASLOWCNC
   void timer4_handler(void)
 #else
   ISR(TIMER1_COMPA_vect)
 #endif
 {
+  PROFILE_LATENCY(PROFILE_STEP_LATENCY, STEP_TIMER_CHANNEL);
+  PROFILE_FUNCTION(PROFILE_STEP);
   #ifdef DEFAULTS_RAMPS_BOARD
     int i;
   #endif // Ramps Board
@@ -514,10 +796,26 @@ void st_go_idle()
       #endif
 
       // Set real-time spindle output as segment is loaded, just prior to the first step.
-      spindle_set_speed(st.exec_segment->spindle_pwm);
+      #if defined(MASLOWCNC) && defined(LASER_DYNAMIC_POWER)
+        // Start at the entry speed power and ramp toward the exit speed power a step event at a time.
+        st.spindle_pwm_ramp = (int32_t)st.exec_segment->spindle_pwm_entry << 16;
+        st.spindle_pwm_rate = 0;
+        if (st.step_count) {
+          st.spindle_pwm_rate = (((int32_t)st.exec_segment->spindle_pwm - st.exec_segment->spindle_pwm_entry) << 16)/(int32_t)st.step_count;
+        }
+        spindle_set_speed(st.exec_segment->spindle_pwm_entry);
+      #else
+        spindle_set_speed(st.exec_segment->spindle_pwm);
+      #endif
+      #ifdef MASLOWCNC
+        st_load_feed_forward(st.exec_segment);
+      #endif
 
     } else {
       // Segment buffer empty. Shutdown.
+      #ifdef REPORT_FIELD_STARVATION
+        st_count_underrun();
+      #endif
       st_go_idle();
       // Ensure pwm is set properly upon completion of rate-controlled motion.
       if (st.exec_block->is_pwm_rate_adjusted) { spindle_set_speed(SPINDLE_PWM_OFF_VALUE); }
@@ -609,6 +907,12 @@ void st_go_idle()
     if (sys.state == STATE_HOMING) { st.step_outbits &= sys.homing_axis_lock; }
   #endif // Ramps Board
   st.step_count--; // Decrement step events count
+  #if defined(MASLOWCNC) && defined(LASER_DYNAMIC_POWER)
+    if (st.spindle_pwm_rate) {
+      st.spindle_pwm_ramp += st.spindle_pwm_rate;
+      spindle_set_speed((st.spindle_pwm_ramp + 0x8000) >> 16);
+    }
+  #endif
   if (st.step_count == 0) {
     // Segment is complete. Discard current segment and advance segment indexing.
     st.exec_segment = NULL;
@@ -626,6 +930,7 @@ void st_go_idle()
     Timer4.start();
   #endif
 }
+#endif // STEP_STREAMING_INTERPOLATOR
 
 
 /* The Stepper Port Reset Interrupt: Timer0 OVF interrupt handles the falling edge of the step
@@ -720,6 +1025,10 @@ void st_reset()
   segment_buffer_tail = 0;
   segment_buffer_head = 0; // empty = tail
   segment_next_head = 1;
+  #ifdef S_CURVE_ACCELERATION
+    segment_prep_head = 0;
+    st_scurve_reset();
+  #endif
   busy = false;
 
   st_generate_step_dir_invert_masks();
@@ -824,6 +1133,10 @@ static uint8_t st_next_block_index(uint8_t block_index)
       prep.last_steps_remaining = prep.steps_remaining;
       prep.last_dt_remainder = prep.dt_remainder;
       prep.last_step_per_mm = prep.step_per_mm;
+      #ifdef STEP_PREP_FIXED_POINT
+        prep.last_fx_steps_remaining = prep.fx_steps_remaining;
+        prep.last_fx_dt_remainder = prep.fx_dt_remainder;
+      #endif
     }
     // Set flags to execute a parking motion
     prep.recalculate_flag |= PREP_FLAG_PARKING;
@@ -842,6 +1155,10 @@ static uint8_t st_next_block_index(uint8_t block_index)
       prep.steps_remaining = prep.last_steps_remaining;
       prep.dt_remainder = prep.last_dt_remainder;
       prep.step_per_mm = prep.last_step_per_mm;
+      #ifdef STEP_PREP_FIXED_POINT
+        prep.fx_steps_remaining = prep.last_fx_steps_remaining;
+        prep.fx_dt_remainder = prep.last_fx_dt_remainder;
+      #endif
       prep.recalculate_flag = (PREP_FLAG_HOLD_PARTIAL_BLOCK | PREP_FLAG_RECALCULATE);
       prep.req_mm_increment = REQ_MM_INCREMENT_SCALAR/prep.step_per_mm; // Recompute this value.
     } else {
@@ -852,6 +1169,309 @@ static uint8_t st_next_block_index(uint8_t block_index)
 #endif
 
 
+#ifdef STEP_PREP_FIXED_POINT
+  // Speed change over 'time' ticks at 'accel'. All products round to nearest, so the distance
+  // and speed integrations do not walk apart over a long ramp.
+  static inline int32_t fx_speed_change(int32_t accel, int32_t time)
+  {
+    return((int32_t)(((int64_t)accel*time + (1L<<(FX_TIME_SHIFT-1))) >> FX_TIME_SHIFT));
+  }
+
+  // Distance traveled over 'time' ticks at 'speed'.
+  static inline int32_t fx_distance(int32_t speed, int32_t time)
+  {
+    return((int32_t)(((int64_t)speed*time + (1L<<(FX_MOVE_SHIFT-1))) >> FX_MOVE_SHIFT));
+  }
+
+  // Distance traveled over 'time' ticks while ramping linearly, given the sum of the start and
+  // end speeds.
+  static inline int32_t fx_ramp_distance(int32_t speed_sum, int32_t time)
+  {
+    return((int32_t)(((int64_t)speed_sum*time + (1L<<FX_MOVE_SHIFT)) >> (FX_MOVE_SHIFT+1)));
+  }
+
+  // Ticks needed to travel 'dist' at 'speed'. Only used at ramp junctions and block ends.
+  static inline int32_t fx_time(int32_t dist, int32_t speed)
+  {
+    if (speed <= 0) { return(0); }
+    return((int32_t)(((int64_t)dist << FX_MOVE_SHIFT)/speed));
+  }
+
+  // Ticks needed to change speed by 'delta' at 'accel'.
+  static inline int32_t fx_time_to_speed(int32_t delta, int32_t accel)
+  {
+    if (accel <= 0) { return(0); }
+    return((int32_t)(((int64_t)delta << FX_TIME_SHIFT)/accel));
+  }
+
+  // Converts the float profile of the prepped block into the fixed-point units above.
+  static void fx_load_profile()
+  {
+    float dist_scale = prep.step_per_mm*(1<<FX_DIST_SHIFT);
+    float speed_scale = prep.step_per_mm*((1<<FX_SPEED_SHIFT)/60.0);
+    prep.fx_dist_to_mm = 1.0/dist_scale;
+    prep.fx_speed_to_mm_min = 1.0/speed_scale;
+    prep.fx_mm_remaining = lroundf(pl_block->millimeters*dist_scale);
+    prep.fx_mm_complete = lroundf(prep.mm_complete*dist_scale);
+    prep.fx_accelerate_until = lroundf(prep.accelerate_until*dist_scale);
+    prep.fx_decelerate_after = lroundf(prep.decelerate_after*dist_scale);
+    prep.fx_current_speed = lroundf(prep.current_speed*speed_scale);
+    prep.fx_maximum_speed = lroundf(prep.maximum_speed*speed_scale);
+    prep.fx_exit_speed = lroundf(prep.exit_speed*speed_scale);
+    prep.fx_acceleration = lroundf(pl_block->acceleration*speed_scale*(1.0/60.0));
+  }
+#endif
+
+
+// Sets the step rate of a prepped segment from its step period in timer cycles, which on the
+// Maslow are microseconds.
+static void st_prep_segment_timing(segment_t *segment, uint32_t cycles)
+{
+  #if defined(STEP_STREAMING_INTERPOLATOR)
+    // No step pulses to smooth. Keep whole step events and the full microsecond step period.
+    segment->cycles_per_tick = cycles;
+  #elif defined(ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING)
+    // Compute step timing and multi-axis smoothing level.
+    // NOTE: AMASS overdrives the timer with each level, so only one prescalar is required.
+    if (cycles < AMASS_LEVEL1) { segment->amass_level = 0; }
+    else {
+      if (cycles < AMASS_LEVEL2) { segment->amass_level = 1; }
+      else if (cycles < AMASS_LEVEL3) { segment->amass_level = 2; }
+      else { segment->amass_level = 3; }
+      cycles >>= segment->amass_level;
+      segment->n_step <<= segment->amass_level;
+    }
+    #ifndef MASLOWCNC
+      if (cycles < (1UL << 16)) { segment->cycles_per_tick = cycles; } // < 65536 (4.1ms @ 16MHz)
+      else { segment->cycles_per_tick = 0xffff; } // Just set the slowest speed possible.
+    #else
+      segment->cycles_per_tick = cycles;  // use the BIG number // LDO
+    #endif
+
+  #else
+    // Compute step timing and timer prescalar for normal step generation.
+    if (cycles < (1UL << 16)) { // < 65536  (4.1ms @ 16MHz)
+      segment->prescaler = 1; // prescaler: 0
+      segment->cycles_per_tick = cycles;
+    } else if (cycles < (1UL << 19)) { // < 524288 (32.8ms@16MHz)
+      segment->prescaler = 2; // prescaler: 8
+      segment->cycles_per_tick = cycles >> 3;
+    } else {
+      segment->prescaler = 3; // prescaler: 64
+      if (cycles < (1UL << 22)) { // < 4194304 (262ms@16MHz)
+        segment->cycles_per_tick =  cycles >> 6;
+      } else { // Just set the slowest speed possible. (Around 4 step/sec.)
+        segment->cycles_per_tick = 0xffff;
+      }
+    }
+  #endif
+}
+
+
+#ifdef S_CURVE_ACCELERATION
+  #define SCURVE_MOVING 0 // The planned profile goes on past the prepped segments.
+  #define SCURVE_REST   1 // The planned profile ends at rest with the prepped segments.
+  #define SCURVE_EXTEND 2 // The prepped segments fill the buffer. Take the profile on at its current speed.
+  #define SCURVE_COMMITTED_SEGMENTS 9 // Segments the stepper ISR may have queued. All of a 10 segment buffer.
+
+  // Smoothing window for the jerk setting. Averaging over a window T, an acceleration a builds up
+  // over T, and reverses over T at a jerk of 2a/T, so T is set from the largest axis acceleration.
+  float st_scurve_window()
+  {
+    if (settings.jerk <= 0.0) { return(0.0); }
+    float acceleration = max(settings.acceleration[X_AXIS], max(settings.acceleration[Y_AXIS], settings.acceleration[Z_AXIS]));
+    float window = 2.0*acceleration/(settings.jerk*(60.0*60.0*60.0)); // min
+    return(min(window, S_CURVE_MAX_WINDOW*(1.0/60.0)));
+  }
+
+
+  // Segments timed and handed to the stepper ISR, but not yet run.
+  static uint8_t st_scurve_committed_segments()
+  {
+    uint8_t tail = segment_buffer_tail;
+    if (segment_buffer_head >= tail) { return(segment_buffer_head - tail); }
+    return(SEGMENT_BUFFER_SIZE - (tail - segment_buffer_head));
+  }
+
+
+  // Restarts the smoothing from rest, at the next segment to prep.
+  static void st_scurve_reset()
+  {
+    scurve.lead = scurve.trail = segment_prep_head;
+    scurve.lead_time = scurve.trail_time = 0.0;
+    scurve.elapsed = 0.0;
+    scurve.speed = 0.0;
+    scurve.restart = true;
+  }
+
+
+  static float st_scurve_piece_speed(uint8_t idx)
+  {
+    if (scurve_piece[idx].dt > 0.0) { return(scurve_piece[idx].mm/scurve_piece[idx].dt); }
+    return(0.0);
+  }
+
+
+  // Times the oldest untimed segment to run for 'duration' (min) between the given speeds, and
+  // hands it to the stepper ISR.
+  static void st_scurve_time_segment(float duration, float entry_speed, float exit_speed)
+  {
+    segment_t *segment = &segment_buffer[segment_buffer_head];
+    st_scurve_piece_t *piece = &scurve_piece[segment_buffer_head];
+
+    float inv_rate = piece->inv_rate;
+    if (piece->dt > 0.0) { inv_rate *= duration/piece->dt; }
+    st_prep_feed_forward(segment, piece->step_per_mm, entry_speed, exit_speed, duration);
+    if ((scurve.window > 0.0) && (piece->rate_rpm >= 0.0)) { // Laser power follows the smoothed speed.
+      #ifdef LASER_DYNAMIC_POWER
+        segment->spindle_pwm_entry = spindle_compute_pwm_value(piece->rate_rpm*entry_speed);
+      #endif
+      segment->spindle_pwm = spindle_compute_pwm_value(piece->rate_rpm*exit_speed);
+    }
+    uint32_t cycles = ceil( (1000000 * 60) * inv_rate ); // in uS
+    if (cycles == 0) { cycles = 1; }
+    st_prep_segment_timing(segment, cycles);
+
+    scurve.speed = exit_speed;
+    if ( ++segment_buffer_head == SEGMENT_BUFFER_SIZE ) { segment_buffer_head = 0; }
+  }
+
+
+  /* Times the prepped segments on the planned profile smoothed by a moving average over the
+     window. The smoothed position at time t is the mean planned position over t-window to t, so
+     a stepped acceleration becomes a ramp over the window, while the smoothed speed never leaves
+     the range of planned speeds in the window and the acceleration never leaves the range of
+     planned accelerations. The segments keep their steps and blocks. Each one is only re-timed to
+     end when the smoothed position reaches its end, and is handed to the stepper ISR once the
+     window gets there. As the window spans segments and blocks alike, the acceleration carries
+     across block junctions and profile recalculations.
+       The planned position is taken as linear through each segment. The window is tracked by its
+     leading and trailing edges, between which the smoothed position changes with the square of
+     time, and is solved for each segment end from one edge crossing a segment boundary to the next.
+     The smoothed motion ends the window after the planned one, at the same place.
+  */
+  static void st_scurve_commit(uint8_t mode)
+  {
+    while (segment_buffer_head != segment_prep_head) {
+      if (scurve.window <= 0.0) { // Not smoothed. Runs as planned.
+        st_scurve_piece_t *piece = &scurve_piece[segment_buffer_head];
+        st_scurve_time_segment(piece->dt, piece->entry_speed, piece->exit_speed);
+        scurve.lead = scurve.trail = segment_buffer_head;
+        continue;
+      }
+      float inv_window = 1.0/scurve.window;
+
+      // Mean planned position over the window and the end of the segment to time, from the start
+      // of the trail segment.
+      while ((scurve.lead != segment_prep_head) && (scurve.lead_time > scurve_piece[scurve.lead].dt)) {
+        scurve.lead_time -= scurve_piece[scurve.lead].dt; // Extended past a segment prepped since.
+        if ( ++scurve.lead == SEGMENT_BUFFER_SIZE ) { scurve.lead = 0; }
+      }
+      float virtual_speed = (mode == SCURVE_REST) ? 0.0 : prep.current_speed; // Past the prepped segments.
+      float position = 0.0;
+      float integral = 0.0;
+      float target = 0.0;
+      float lead_position = 0.0;
+      uint8_t idx = scurve.trail;
+      uint8_t found = 0;
+      while (found != 3) {
+        float start_time = 0.0;
+        if ((idx == scurve.trail) && (scurve.trail_time > 0.0)) { start_time = scurve.trail_time; }
+        if (idx == scurve.lead) {
+          lead_position = position;
+          float speed = (idx == segment_prep_head) ? virtual_speed : st_scurve_piece_speed(idx);
+          integral += (scurve.lead_time-start_time)*(position + 0.5*speed*(scurve.lead_time+start_time));
+          found |= 1;
+        } else if (!(found & 1)) {
+          integral += (scurve_piece[idx].dt-start_time)*(position + 0.5*st_scurve_piece_speed(idx)*(scurve_piece[idx].dt+start_time));
+        }
+        if (idx == segment_prep_head) { break; } // Past the prepped segments.
+        position += scurve_piece[idx].mm;
+        if (idx == segment_buffer_head) {
+          target = position;
+          found |= 2;
+        }
+        if ( ++idx == SEGMENT_BUFFER_SIZE ) { idx = 0; }
+      }
+      float trail_position = 0.0;
+      float remaining = target - integral*inv_window;
+
+      // Move the window on until the smoothed position reaches the target.
+      for (;;) {
+        uint8_t lead_virtual = (scurve.lead == segment_prep_head);
+        if (scurve.trail == segment_prep_head) { remaining = 0.0; } // Whole window at rest at the end.
+        float lead_speed = virtual_speed;
+        float lead_span = 0.0;
+        if (!lead_virtual) {
+          lead_speed = st_scurve_piece_speed(scurve.lead);
+          lead_span = scurve_piece[scurve.lead].dt - scurve.lead_time;
+        }
+        float trail_speed = 0.0;
+        float trail_span = -scurve.trail_time;
+        if (scurve.trail_time >= 0.0) {
+          trail_speed = st_scurve_piece_speed(scurve.trail);
+          trail_span = scurve_piece[scurve.trail].dt - scurve.trail_time;
+        }
+        float trail_travel = 0.0;
+        if (scurve.trail_time > 0.0) { trail_travel = trail_speed*scurve.trail_time; }
+        float speed = (lead_position + lead_speed*scurve.lead_time - trail_position - trail_travel)*inv_window;
+        float curve = 0.5*(lead_speed - trail_speed)*inv_window;
+
+        float span = trail_span;
+        if (lead_virtual) {
+          if ((mode == SCURVE_MOVING) && (remaining > 0.0)) { return; } // Wait for more segments.
+        } else if (lead_span < span) { span = lead_span; }
+        float delta = span;
+        uint8_t reached = (remaining <= 0.0);
+        if (reached) { delta = 0.0; }
+        else if (span*(speed + curve*span) >= remaining) {
+          float root = speed*speed + 4.0*curve*remaining;
+          if (root < 0.0) { root = 0.0; }
+          root = speed + sqrt(root);
+          if (root > 0.0) { delta = 2.0*remaining/root; }
+          if (delta > span) { delta = span; }
+          reached = true;
+        } else {
+          remaining -= span*(speed + curve*span);
+        }
+
+        // Advance both edges, stepping each into the next segment at a boundary.
+        uint8_t wait = false;
+        scurve.elapsed += delta;
+        if (lead_virtual || (delta < lead_span)) { scurve.lead_time += delta; }
+        else {
+          scurve.lead_time = scurve_piece[scurve.lead].dt;
+          uint8_t next = scurve.lead+1;
+          if (next == SEGMENT_BUFFER_SIZE) { next = 0; }
+          if ((next != segment_prep_head) || (mode != SCURVE_MOVING)) {
+            lead_position += scurve_piece[scurve.lead].mm;
+            scurve.lead = next;
+            scurve.lead_time = 0.0;
+          } else { wait = !reached; } // At the end of the prepped profile.
+        }
+        if (scurve.trail == segment_prep_head) { } // At rest at the end.
+        else if (delta < trail_span) { scurve.trail_time += delta; }
+        else if (scurve.trail_time < 0.0) { scurve.trail_time = 0.0; }
+        else {
+          trail_position += scurve_piece[scurve.trail].mm;
+          if ( ++scurve.trail == SEGMENT_BUFFER_SIZE ) { scurve.trail = 0; }
+          scurve.trail_time = 0.0;
+        }
+        if (wait) { return; } // Until more segments are prepped.
+
+        if (reached) {
+          st_scurve_time_segment(scurve.elapsed, scurve.speed, speed + 2.0*curve*delta);
+          scurve.elapsed = 0.0;
+          break;
+        }
+      }
+      if (mode == SCURVE_EXTEND) { return; } // One at a time, until the window frees a segment.
+    }
+    if (mode == SCURVE_REST) { st_scurve_reset(); }
+  }
+#endif
+
+
 /* Prepares step segment buffer. Continuously called from main program.
 
    The segment buffer is an intermediary buffer interface between the execution of steps
@@ -865,12 +1485,37 @@ static uint8_t st_next_block_index(uint8_t block_index)
    Currently, the segment buffer conservatively holds roughly up to 40-50 msec of steps.
    NOTE: Computation units are in steps, millimeters, and minutes.
 */
+#ifdef PIPELINE_BENCHMARK
+uint8_t st_bench_pop_segment()
+{
+  if (segment_buffer_tail == segment_buffer_head) { return(false); }
+  if ( ++segment_buffer_tail == SEGMENT_BUFFER_SIZE) { segment_buffer_tail = 0; }
+  return(true);
+}
+#endif
+
+
 void st_prep_buffer()
 {
+  PROFILE_FUNCTION(PROFILE_PREP);
   // Block step prep buffer, while in a suspend state and there is no suspend motion to execute.
   if (bit_istrue(sys.step_control,STEP_CONTROL_END_MOTION)) { return; }
 
+  #ifdef S_CURVE_ACCELERATION
+    // Segments the smoothing window still covers fill the buffer, and none can be timed without
+    // more. Unlikely but for many blocks shorter than a segment. Time them as if the profile
+    // went on at its current speed, until the window frees a segment.
+    while ((segment_next_head == scurve.trail) && (segment_buffer_head != segment_prep_head)) {
+      st_scurve_commit(SCURVE_EXTEND);
+    }
+    // The segments handed to the stepper ISR are held to what the unsmoothed buffer holds, so a feed
+    // hold or override takes effect as soon as without the S-curve, plus the window still to be
+    // timed. With $99=0 that window is empty, and the buffer runs exactly as SEGMENT_BUFFER_SIZE 10.
+    while ((segment_buffer_tail != segment_next_head) && (scurve.trail != segment_next_head) &&
+           (st_scurve_committed_segments() < SCURVE_COMMITTED_SEGMENTS)) { // Check if we need to fill the buffer.
+  #else
   while (segment_buffer_tail != segment_next_head) { // Check if we need to fill the buffer.
+  #endif
 
     // Determine if we need to load a new planner block or if the block needs to be recomputed.
     if (pl_block == NULL) {
@@ -878,7 +1523,18 @@ void st_prep_buffer()
       // Query planner for a queued block
       if (sys.step_control & STEP_CONTROL_EXECUTE_SYS_MOTION) { pl_block = plan_get_system_motion_block(); }
       else { pl_block = plan_get_current_block(); }
-      if (pl_block == NULL) { return; } // No planner blocks. Exit.
+      #ifdef REPORT_FIELD_STARVATION
+        // Count the planner running dry once per occurrence, not on every call while it stays empty.
+        static uint8_t planner_starved = false;
+        if (pl_block == NULL) {
+          if (!planner_starved && (sys.state & (STATE_CYCLE | STATE_JOG))) { sys_starvation.planner_empty++; }
+          planner_starved = true;
+          return;
+        }
+        planner_starved = false;
+      #else
+        if (pl_block == NULL) { return; } // No planner blocks. Exit.
+      #endif
 
       // Check if we need to only recompute the velocity profile or load a new block.
       if (prep.recalculate_flag & PREP_FLAG_RECALCULATE) {
@@ -899,6 +1555,9 @@ void st_prep_buffer()
         // when the segment buffer completes the planner block, it may be discarded when the
         // segment buffer finishes the prepped block, but the stepper ISR is still executing it.
         st_prep_block = &st_block_buffer[prep.st_block_index];
+        #ifdef MOTOR_SIMULATION
+          motor_sim_block(pl_block->millimeters, pl_block->programmed_rate);
+        #endif
         uint8_t idx;
         #ifdef DEFAULTS_RAMPS_BOARD
           for (idx=0; idx<N_AXIS; idx++) {
@@ -908,7 +1567,11 @@ void st_prep_buffer()
           st_prep_block->direction_bits = pl_block->direction_bits;
         #endif // Ramps Board
 
-        #ifndef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+        #if defined(STEP_STREAMING_INTERPOLATOR)
+          // The interpolator scales the block directly and needs the plain step counts.
+          for (idx=0; idx<N_AXIS; idx++) { st_prep_block->steps[idx] = pl_block->steps[idx]; }
+          st_prep_block->step_event_count = pl_block->step_event_count;
+        #elif !defined(ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING)
           for (idx=0; idx<N_AXIS; idx++) { st_prep_block->steps[idx] = (pl_block->steps[idx] << 1); }
           st_prep_block->step_event_count = (pl_block->step_event_count << 1);
         #else
@@ -924,6 +1587,10 @@ void st_prep_buffer()
         prep.step_per_mm = prep.steps_remaining/pl_block->millimeters;
         prep.req_mm_increment = REQ_MM_INCREMENT_SCALAR/prep.step_per_mm;
         prep.dt_remainder = 0.0; // Reset for new segment block
+        #ifdef STEP_PREP_FIXED_POINT
+          prep.fx_steps_remaining = pl_block->step_event_count;
+          prep.fx_dt_remainder = 0;
+        #endif
 
         if ((sys.step_control & STEP_CONTROL_EXECUTE_HOLD) || (prep.recalculate_flag & PREP_FLAG_DECEL_OVERRIDE)) {
           // New block loaded mid-hold. Override planner block entry speed to enforce deceleration.
@@ -1037,14 +1704,25 @@ void st_prep_buffer()
 				}
 			}
       
+      #ifdef STEP_PREP_FIXED_POINT
+        fx_load_profile();
+      #endif
+
       bit_true(sys.step_control, STEP_CONTROL_UPDATE_SPINDLE_PWM); // Force update whenever updating block.
     }
     
     // Initialize new segment
-    segment_t *prep_segment = &segment_buffer[segment_buffer_head];
+    #ifdef S_CURVE_ACCELERATION
+      segment_t *prep_segment = &segment_buffer[segment_prep_head];
+    #else
+      segment_t *prep_segment = &segment_buffer[segment_buffer_head];
+    #endif
 
     // Set new segment to point to the current segment data block.
     prep_segment->st_block_index = prep.st_block_index;
+    #ifdef MASLOWCNC
+      float ff_entry_speed = prep.current_speed; // Segment start speed for the feed-forward terms
+    #endif
 
     /*------------------------------------------------------------------------------------
         Compute the average velocity of this new segment by determining the total distance
@@ -1060,6 +1738,97 @@ void st_prep_buffer()
       the end of planner block (typical) or mid-block at the end of a forced deceleration,
       such as from a feed hold.
     */
+    #ifdef STEP_PREP_FIXED_POINT
+    // Same ramp sequence as the float path below, in integer fixed-point units.
+    int32_t dt_max = FX_DT_SEGMENT; // Maximum segment time
+    int32_t dt = 0; // Initialize segment time
+    int32_t time_var = dt_max; // Time worker variable
+    int32_t mm_var; // Distance worker variable
+    int32_t speed_var; // Speed worker variable
+    int32_t mm_start = prep.fx_mm_remaining; // Segment start distance from end of block.
+    int32_t mm_remaining = mm_start; // New segment distance from end of block.
+    int32_t minimum_mm = mm_remaining-FX_REQ_INCREMENT; // Guarantee at least one step.
+    if (minimum_mm < 0) { minimum_mm = 0; }
+
+    do {
+      switch (prep.ramp_type) {
+        case RAMP_DECEL_OVERRIDE:
+          speed_var = fx_speed_change(prep.fx_acceleration,time_var);
+          if (prep.fx_current_speed-prep.fx_maximum_speed <= speed_var) {
+            // Cruise or cruise-deceleration types only for deceleration override.
+            mm_remaining = prep.fx_accelerate_until;
+            time_var = fx_time(2*(mm_start-mm_remaining),prep.fx_current_speed+prep.fx_maximum_speed);
+            prep.ramp_type = RAMP_CRUISE;
+            prep.fx_current_speed = prep.fx_maximum_speed;
+          } else { // Mid-deceleration override ramp.
+            mm_remaining -= fx_ramp_distance(2*prep.fx_current_speed-speed_var,time_var);
+            prep.fx_current_speed -= speed_var;
+          }
+          break;
+        case RAMP_ACCEL:
+          // NOTE: Acceleration ramp only computes during first do-while loop.
+          speed_var = fx_speed_change(prep.fx_acceleration,time_var);
+          mm_remaining -= fx_ramp_distance(2*prep.fx_current_speed+speed_var,time_var);
+          if (mm_remaining < prep.fx_accelerate_until) { // End of acceleration ramp.
+            // Acceleration-cruise, acceleration-deceleration ramp junction, or end of block.
+            mm_remaining = prep.fx_accelerate_until; // NOTE: 0 at EOB
+            time_var = fx_time(2*(mm_start-mm_remaining),prep.fx_current_speed+prep.fx_maximum_speed);
+            if (mm_remaining == prep.fx_decelerate_after) { prep.ramp_type = RAMP_DECEL; }
+            else { prep.ramp_type = RAMP_CRUISE; }
+            prep.fx_current_speed = prep.fx_maximum_speed;
+          } else { // Acceleration only.
+            prep.fx_current_speed += speed_var;
+          }
+          break;
+        case RAMP_CRUISE:
+          mm_var = mm_remaining - fx_distance(prep.fx_maximum_speed,time_var);
+          if (mm_var < prep.fx_decelerate_after) { // End of cruise.
+            // Cruise-deceleration junction or end of block.
+            time_var = fx_time(mm_remaining-prep.fx_decelerate_after,prep.fx_maximum_speed);
+            mm_remaining = prep.fx_decelerate_after; // NOTE: 0 at EOB
+            prep.ramp_type = RAMP_DECEL;
+          } else { // Cruising only.
+            mm_remaining = mm_var;
+          }
+          break;
+        default: // case RAMP_DECEL:
+          speed_var = fx_speed_change(prep.fx_acceleration,time_var); // Used as delta speed
+          if (prep.fx_current_speed > speed_var) { // Check if at or below zero speed.
+            // Compute distance from end of segment to end of block.
+            mm_var = mm_remaining - fx_ramp_distance(2*prep.fx_current_speed-speed_var,time_var);
+            if (mm_var > prep.fx_mm_complete) { // Typical case. In deceleration ramp.
+              mm_remaining = mm_var;
+              prep.fx_current_speed -= speed_var;
+              break; // Segment complete. Exit switch-case statement. Continue do-while loop.
+            }
+          }
+          // Otherwise, at end of block or end of forced-deceleration. The exact ramp also takes
+          // (current-exit)/acceleration to get here. Use it as a bound, since a rounding residue
+          // over a near-zero final speed would otherwise turn into a long crawl at the end of a stop.
+          time_var = fx_time(2*(mm_remaining-prep.fx_mm_complete),prep.fx_current_speed+prep.fx_exit_speed);
+          if (prep.fx_current_speed > prep.fx_exit_speed) {
+            speed_var = fx_time_to_speed(prep.fx_current_speed-prep.fx_exit_speed,prep.fx_acceleration);
+            if (speed_var < time_var) { time_var = speed_var; }
+          }
+          mm_remaining = prep.fx_mm_complete;
+          prep.fx_current_speed = prep.fx_exit_speed;
+      }
+      dt += time_var; // Add computed ramp time to total segment time.
+      if (dt < dt_max) { time_var = dt_max - dt; } // **Incomplete** At ramp junction.
+      else {
+        if (mm_remaining > minimum_mm) { // Check for very slow segments with zero steps.
+          // Increase segment time to ensure at least one step in segment. Override and loop
+          // through distance calculations until minimum_mm or mm_complete.
+          dt_max += FX_DT_SEGMENT;
+          time_var = dt_max - dt;
+        } else {
+          break; // **Complete** Exit loop. Segment execution time maxed.
+        }
+      }
+    } while (mm_remaining > prep.fx_mm_complete); // **Complete** Exit loop. Profile complete.
+    prep.current_speed = prep.fx_current_speed*prep.fx_speed_to_mm_min;
+
+    #else
     float dt_max = DT_SEGMENT; // Maximum segment time
     float dt = 0.0; // Initialize segment time
     float time_var = dt_max; // Time worker variable
@@ -1143,6 +1912,15 @@ void st_prep_buffer()
         }
       }
     } while (mm_remaining > prep.mm_complete); // **Complete** Exit loop. Profile complete.
+    #endif // STEP_PREP_FIXED_POINT
+
+    #ifdef MASLOWCNC
+      #ifdef STEP_PREP_FIXED_POINT
+        st_prep_feed_forward(prep_segment, prep.step_per_mm, ff_entry_speed, prep.current_speed, dt*(1.0/(60.0*(1UL<<FX_TIME_SHIFT))));
+      #elif !defined(S_CURVE_ACCELERATION) // Otherwise on the smoothed profile, in st_scurve_time_segment().
+        st_prep_feed_forward(prep_segment, prep.step_per_mm, ff_entry_speed, prep.current_speed, dt);
+      #endif
+    #endif
 
 
     /* -----------------------------------------------------------------------------------
@@ -1153,7 +1931,12 @@ void st_prep_buffer()
       if (pl_block->condition & (PL_COND_FLAG_SPINDLE_CW | PL_COND_FLAG_SPINDLE_CCW)) {
         float rpm = pl_block->spindle_speed;
         // NOTE: Feed and rapid overrides are independent of PWM value and do not alter laser power/rate.        
-        if (st_prep_block->is_pwm_rate_adjusted) { rpm *= (prep.current_speed * prep.inv_rate); }
+        if (st_prep_block->is_pwm_rate_adjusted) {
+          #if defined(MASLOWCNC) && defined(LASER_DYNAMIC_POWER)
+            prep.entry_spindle_pwm = spindle_compute_pwm_value(rpm*(ff_entry_speed*prep.inv_rate));
+          #endif
+          rpm *= (prep.current_speed * prep.inv_rate);
+        }
         // If current_speed is zero, then may need to be rpm_min*(100/MAX_SPINDLE_SPEED_OVERRIDE)
         // but this would be instantaneous only and during a motion. May not matter at all.
         prep.current_spindle_pwm = spindle_compute_pwm_value(rpm);
@@ -1164,6 +1947,13 @@ void st_prep_buffer()
       bit_false(sys.step_control,STEP_CONTROL_UPDATE_SPINDLE_PWM);
     }
     prep_segment->spindle_pwm = prep.current_spindle_pwm; // Reload segment PWM value
+    #if defined(MASLOWCNC) && defined(LASER_DYNAMIC_POWER)
+      if (st_prep_block->is_pwm_rate_adjusted && (pl_block->condition & (PL_COND_FLAG_SPINDLE_CW | PL_COND_FLAG_SPINDLE_CCW))) {
+        prep_segment->spindle_pwm_entry = prep.entry_spindle_pwm;
+      } else {
+        prep_segment->spindle_pwm_entry = prep.current_spindle_pwm; // Constant power through the segment.
+      }
+    #endif
 
     
     /* -----------------------------------------------------------------------------------
@@ -1176,10 +1966,16 @@ void st_prep_buffer()
        Fortunately, this scenario is highly unlikely and unrealistic in CNC machines
        supported by Grbl (i.e. exceeding 10 meters axis travel at 200 step/mm).
     */
-    float step_dist_remaining = prep.step_per_mm*mm_remaining; // Convert mm_remaining to steps
-    float n_steps_remaining = ceil(step_dist_remaining); // Round-up current steps remaining
-    float last_n_steps_remaining = ceil(prep.steps_remaining); // Round-up last steps remaining
-    prep_segment->n_step = last_n_steps_remaining-n_steps_remaining; // Compute number of steps to execute.
+    #ifdef STEP_PREP_FIXED_POINT
+      uint32_t n_steps_remaining = (mm_remaining+((1<<FX_DIST_SHIFT)-1)) >> FX_DIST_SHIFT; // Round-up current steps remaining
+      uint32_t last_n_steps_remaining = prep.fx_steps_remaining; // Always whole steps.
+      prep_segment->n_step = last_n_steps_remaining-n_steps_remaining; // Compute number of steps to execute.
+    #else
+      float step_dist_remaining = prep.step_per_mm*mm_remaining; // Convert mm_remaining to steps
+      float n_steps_remaining = ceil(step_dist_remaining); // Round-up current steps remaining
+      float last_n_steps_remaining = ceil(prep.steps_remaining); // Round-up last steps remaining
+      prep_segment->n_step = last_n_steps_remaining-n_steps_remaining; // Compute number of steps to execute.
+    #endif
 
     // Bail if we are at the end of a feed hold and don't have a step to execute.
     if (prep_segment->n_step == 0) {
@@ -1190,6 +1986,9 @@ void st_prep_buffer()
         #ifdef PARKING_ENABLE
           if (!(prep.recalculate_flag & PREP_FLAG_PARKING)) { prep.recalculate_flag |= PREP_FLAG_HOLD_PARTIAL_BLOCK; }
         #endif
+        #ifdef S_CURVE_ACCELERATION
+          st_scurve_commit(SCURVE_REST);
+        #endif
         return; // Segment not generated, but current step data still retained.
       }
     }
@@ -1202,65 +2001,94 @@ void st_prep_buffer()
     // adjusts the whole segment rate to keep step output exact. These rate adjustments are
     // typically very small and do not adversely effect performance, but ensures that Grbl
     // outputs the exact acceleration and velocity profiles as computed by the planner.
-    dt += prep.dt_remainder; // Apply previous segment partial step execute time
-    float inv_rate = dt/(last_n_steps_remaining - step_dist_remaining); // Compute adjusted step rate inverse
-
-    // Compute CPU cycles per step for the prepped segment.
-    #ifdef MASLOWCNC
-        uint32_t cycles = ceil( (1000000 * 60) * inv_rate ); // (cycles/step) // in uS -- LDO
-    #else
-      uint32_t cycles = ceil( (TICKS_PER_MICROSECOND*1000000*60)*inv_rate ); // (cycles/step)
-    #endif
-
-    #ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
-      // Compute step timing and multi-axis smoothing level.
-      // NOTE: AMASS overdrives the timer with each level, so only one prescalar is required.
-      if (cycles < AMASS_LEVEL1) { prep_segment->amass_level = 0; }
-      else {
-        if (cycles < AMASS_LEVEL2) { prep_segment->amass_level = 1; }
-        else if (cycles < AMASS_LEVEL3) { prep_segment->amass_level = 2; }
-        else { prep_segment->amass_level = 3; }
-        cycles >>= prep_segment->amass_level;
-        prep_segment->n_step <<= prep_segment->amass_level;
+    #ifdef STEP_PREP_FIXED_POINT
+      dt += prep.fx_dt_remainder; // Apply previous segment partial step execute time
+      // Step distance, in fixed units, the segment time is spread over.
+      uint32_t step_dist = (last_n_steps_remaining << FX_DIST_SHIFT) - mm_remaining;
+      if (step_dist == 0) { step_dist = 1; }
+
+      // Compute step timer microseconds per step for the prepped segment, rounded up.
+      // cycles = dt*(1e6/2^20)*(2^12/step_dist). Stays in 32-bit hardware division unless dt is long.
+      uint32_t cycles;
+      uint32_t cycles_den = (FX_US_PER_TICK_DEN >> FX_DIST_SHIFT)*step_dist;
+      if ((uint32_t)dt < (0xFFFFFFFFUL/FX_US_PER_TICK_NUM)) {
+        cycles = ((uint32_t)dt*FX_US_PER_TICK_NUM + cycles_den-1)/cycles_den;
+      } else {
+        cycles = ((uint64_t)dt*FX_US_PER_TICK_NUM + cycles_den-1)/cycles_den;
       }
-      #ifndef MASLOWCNC
-        if (cycles < (1UL << 16)) { prep_segment->cycles_per_tick = cycles; } // < 65536 (4.1ms @ 16MHz)
-        else { prep_segment->cycles_per_tick = 0xffff; } // Just set the slowest speed possible.
+    #else
+      #ifdef S_CURVE_ACCELERATION
+        float profile_dt = dt; // Rescaled to the smoothed profile with the step period below.
+      #endif
+      dt += prep.dt_remainder; // Apply previous segment partial step execute time
+      float inv_rate = dt/(last_n_steps_remaining - step_dist_remaining); // Compute adjusted step rate inverse
+
+      // Compute CPU cycles per step for the prepped segment.
+      #ifdef S_CURVE_ACCELERATION
+        // Left to st_scurve_time_segment(), once the segment is timed on the smoothed profile.
+      #elif defined(MASLOWCNC)
+          uint32_t cycles = ceil( (1000000 * 60) * inv_rate ); // (cycles/step) // in uS -- LDO
       #else
-        prep_segment->cycles_per_tick = cycles;  // use the BIG number // LDO
+        uint32_t cycles = ceil( (TICKS_PER_MICROSECOND*1000000*60)*inv_rate ); // (cycles/step)
       #endif
+    #endif
 
-    #else
-      // Compute step timing and timer prescalar for normal step generation.
-      if (cycles < (1UL << 16)) { // < 65536  (4.1ms @ 16MHz)
-        prep_segment->prescaler = 1; // prescaler: 0
-        prep_segment->cycles_per_tick = cycles;
-      } else if (cycles < (1UL << 19)) { // < 524288 (32.8ms@16MHz)
-        prep_segment->prescaler = 2; // prescaler: 8
-        prep_segment->cycles_per_tick = cycles >> 3;
-      } else {
-        prep_segment->prescaler = 3; // prescaler: 64
-        if (cycles < (1UL << 22)) { // < 4194304 (262ms@16MHz)
-          prep_segment->cycles_per_tick =  cycles >> 6;
-        } else { // Just set the slowest speed possible. (Around 4 step/sec.)
-          prep_segment->cycles_per_tick = 0xffff;
-        }
-      }
+    #ifndef S_CURVE_ACCELERATION
+      st_prep_segment_timing(prep_segment, cycles);
     #endif
 
+    #ifdef S_CURVE_ACCELERATION
+      // Segment prepped. The smoothing times it and hands it to the stepper ISR.
+      st_scurve_piece_t *piece = &scurve_piece[segment_prep_head];
+      piece->dt = profile_dt;
+      piece->mm = pl_block->millimeters - mm_remaining;
+      piece->inv_rate = inv_rate;
+      piece->step_per_mm = prep.step_per_mm;
+      piece->entry_speed = ff_entry_speed;
+      piece->exit_speed = prep.current_speed;
+      piece->rate_rpm = -1.0;
+      if (st_prep_block->is_pwm_rate_adjusted && (pl_block->condition & (PL_COND_FLAG_SPINDLE_CW | PL_COND_FLAG_SPINDLE_CCW))) {
+        piece->rate_rpm = pl_block->spindle_speed*prep.inv_rate;
+      }
+      if (scurve.restart) { // Window of rest before the first segment.
+        scurve.window = st_scurve_window();
+        scurve.trail_time = -scurve.window;
+        scurve.restart = false;
+      }
+      segment_prep_head = segment_next_head;
+      if ( ++segment_next_head == SEGMENT_BUFFER_SIZE ) { segment_next_head = 0; }
+      st_scurve_commit((prep.current_speed > 0.0) ? SCURVE_MOVING : SCURVE_REST);
+    #else
     // Segment complete! Increment segment buffer indices, so stepper ISR can immediately execute it.
     segment_buffer_head = segment_next_head;
     if ( ++segment_next_head == SEGMENT_BUFFER_SIZE ) { segment_next_head = 0; }
+    #endif
 
     // Update the appropriate planner and segment data.
-    pl_block->millimeters = mm_remaining;
-    prep.steps_remaining = n_steps_remaining;
-    prep.dt_remainder = (n_steps_remaining - step_dist_remaining)*inv_rate;
+    #ifdef STEP_PREP_FIXED_POINT
+      // Partial step time carried into the next segment: dt*(partial step distance)/step_dist.
+      uint32_t partial_dist = (n_steps_remaining << FX_DIST_SHIFT) - mm_remaining;
+      if ((uint32_t)dt < (0xFFFFFFFFUL >> FX_DIST_SHIFT)) {
+        prep.fx_dt_remainder = (partial_dist*(uint32_t)dt)/step_dist;
+      } else {
+        prep.fx_dt_remainder = ((uint64_t)partial_dist*(uint32_t)dt)/step_dist;
+      }
+      prep.fx_steps_remaining = n_steps_remaining;
+      prep.fx_mm_remaining = mm_remaining;
+      pl_block->millimeters = mm_remaining*prep.fx_dist_to_mm;
 
-    // Check for exit conditions and flag to load next planner block.
-    if (mm_remaining == prep.mm_complete) {
+      // Check for exit conditions and flag to load next planner block.
+      if (mm_remaining == prep.fx_mm_complete) {
+    #else
+      pl_block->millimeters = mm_remaining;
+      prep.steps_remaining = n_steps_remaining;
+      prep.dt_remainder = (n_steps_remaining - step_dist_remaining)*inv_rate;
+
+      // Check for exit conditions and flag to load next planner block.
+      if (mm_remaining == prep.mm_complete) {
+    #endif
       // End of planner block or forced-termination. No more distance to be executed.
-      if (mm_remaining > 0.0) { // At end of forced-termination.
+      if (mm_remaining > 0) { // At end of forced-termination.
         // Reset prep parameters for resuming and then bail. Allow the stepper ISR to complete
         // the segment queue, where realtime protocol will set new state upon receiving the
         // cycle stop flag from the ISR. Prep_segment is blocked until then.
@@ -1291,6 +2119,9 @@ void st_prep_buffer()
 float st_get_realtime_rate()
 {
   if (sys.state & (STATE_CYCLE | STATE_HOMING | STATE_HOLD | STATE_JOG | STATE_SAFETY_DOOR)){
+    #ifdef S_CURVE_ACCELERATION
+      return scurve.speed;
+    #endif
     return prep.current_speed;
   }
   return 0.0f;
@@ -23,7 +23,13 @@
 #define stepper_h
 
 #ifndef SEGMENT_BUFFER_SIZE
-  #define SEGMENT_BUFFER_SIZE 10
+  #ifdef S_CURVE_ACCELERATION
+    // Also holds the segments the smoothing window covers, twice over for blocks shorter than a segment.
+    // Only the 9 segments of the default size are handed to the stepper ISR at a time.
+    #define SEGMENT_BUFFER_SIZE (10 + 2*(int)(S_CURVE_MAX_WINDOW*ACCELERATION_TICKS_PER_SECOND + 1))
+  #else
+    #define SEGMENT_BUFFER_SIZE 10
+  #endif
 #endif
 
 // Initialize and setup the stepper motor subsystem
@@ -56,4 +62,15 @@ void st_update_plan_block_parameters();
 // Called by realtime status reporting if realtime rate reporting is enabled in config.h.
 float st_get_realtime_rate();
 
+#ifdef S_CURVE_ACCELERATION
+  // Returns the S-curve smoothing window for the jerk setting (min). Zero with no smoothing.
+  float st_scurve_window();
+#endif
+
+#ifdef PIPELINE_BENCHMARK
+  // Drops the oldest prepped segment as if the stepper had run it. Returns false if there is none.
+  // Only for $BENCH, with the stepper idle.
+  uint8_t st_bench_pop_segment();
+#endif
+
 #endif
@@ -23,7 +23,7 @@
 #ifdef MASLOWCNC
   #include "MaslowDue.h"
 
-  #define KINEMATICS_MAX_GUESS  200
+  #define KINEMATICS_MAX_GUESS  20 // Newton iterations before giving up. At most 6 measured over the work area.
   // #define KINEMATICS_DBG 1 // output to serial while computing kinematics.
   #define KINEMATICS_MAX_ERR    0.01 // maximum error value in forward kinematics. bigger = faster.
 
@@ -31,16 +31,80 @@
   void  triangularInverse(float xTarget, float yTarget, float* aChainLength, float* bChainLength);
   void  triangularForward(float chainALength, float chainBLength, float* xPos, float* yPos);
   void  triangularSimple(float aChainLength, float bChainLength, float *x,float *y );
-  void _recomputeGeometry(void);
 
-  // Various cached pre-computed values.
+  // Working precision of triangularInverse(). See KINEMATICS_SINGLE_PRECISION in config.h.
+  #ifdef KINEMATICS_SINGLE_PRECISION
+    typedef float kin_real_t;
+    #define KIN_SQRT(x)  sqrtf(x)
+    #define KIN_ASIN(x)  asinf(x)
+    #define KIN_SIN(x)   sinf(x)
+    #define KIN_COS(x)   cosf(x)
+    #define KIN_SINH(x)  sinhf(x)
+  #else
+    typedef double kin_real_t;
+    #define KIN_SQRT(x)  sqrt(x)
+    #define KIN_ASIN(x)  asin(x)
+    #define KIN_SIN(x)   sin(x)
+    #define KIN_COS(x)   cos(x)
+    #define KIN_SINH(x)  sinh(x)
+  #endif
+
+  // Various cached pre-computed values. Refreshed by recomputeGeometry() whenever settings change.
   float _sprocketRadius = 10.1f;                      //sprocket radius
-  double _xCordOfMotor;
-  double _yCordOfMotor;
+  kin_real_t _xCordOfMotor;
+  kin_real_t _yCordOfMotor;
+  kin_real_t _srsqrd;                 // sprocket radius squared
+  kin_real_t _chainDensity;           // Newtons / mm
+  kin_real_t _halfChainDensity;
+  kin_real_t _invChainDensity;
+  kin_real_t _chainElasticity;        // mm/mm/Newton
+  kin_real_t _sledWeight;
+  kin_real_t _leftToleranceScale;     // 1/(1 + leftChainTolerance/100)
+  kin_real_t _rightToleranceScale;    // 1/(1 + rightChainTolerance/100)
+  kin_real_t _rotationDiskRadius;
+  uint8_t _chainOverSprocket;
 
   // Cached between triangularForward computations to provide a good guess (performance).
   float _xLastPosition;
   float _yLastPosition;
+
+  #ifdef REPORT_MPOS_CACHE
+    // Forward solution of the last system_convert_maslow_to_xy() call, keyed on its chain steps.
+    // The inverse Jacobian at the cached position turns a chain change into a position change and
+    // seeds the next solve. Invalidated by recomputeGeometry().
+    static uint8_t mpos_cache_valid = false;
+    static int32_t mpos_cache_steps[2];
+    static float mpos_cache_chain[2];
+    static float mpos_cache_xy[2];
+    static float mpos_cache_inv_jacobian[4]; // dx/da, dx/db, dy/da, dy/db
+    static uint8_t mpos_solve_failed;        // The last triangularForward() gave up. Not cached.
+  #endif
+
+  #ifdef KINEMATICS_TARGET_CACHE
+    // Last positionToChain() solutions, keyed on the exact target x and y, newest at
+    // kin_cache_next-1. Invalidated by recomputeGeometry() and on completing the correction grid.
+    static float kin_cache_xy[KINEMATICS_TARGET_CACHE][2];
+    static float kin_cache_chain[KINEMATICS_TARGET_CACHE][2];
+    static uint8_t kin_cache_count = 0; // Valid entries.
+    static uint8_t kin_cache_next = 0;  // Entry replaced by the next solve.
+    uint32_t kinematics_cache_hits, kinematics_cache_misses;
+  #endif
+
+  #ifdef KINEMATICS_CORRECTION_GRID
+    // Chain length corrections to the straight motor-to-sled distances over the work area, as
+    // { left, right } at each grid node. Restarted by kinematicsBuildGrid() from recomputeGeometry()
+    // and solved a few nodes at a time by the kinematicsGridService() scheduler task.
+    #define KIN_GRID_NODES ((KINEMATICS_GRID_ROWS+1)*(KINEMATICS_GRID_COLS+1))
+    static float kin_grid[KINEMATICS_GRID_ROWS+1][KINEMATICS_GRID_COLS+1][2];
+    static uint8_t kin_grid_valid = false;  // In use by positionToChain() and chainToPosition().
+    static uint8_t kin_grid_built = false;  // Solved, waiting for the machine to stop to take it up.
+    static uint16_t kin_grid_build_node = KIN_GRID_NODES; // Next node to solve. KIN_GRID_NODES when idle.
+    static float kin_grid_dx, kin_grid_dy;          // Node spacing (mm)
+    static float kin_grid_x0, kin_grid_y0;          // Work area corner (mm)
+    static float kin_grid_inv_dx, kin_grid_inv_dy;  // Nodes per mm
+    float kinematics_grid_error;                    // Interpolation error bound (mm)
+    void kinematicsBuildGrid(void);
+  #endif
 #endif
 
 void system_init()
@@ -148,6 +212,9 @@ uint8_t system_execute_line(char *line)
     case 'J' : // Jogging
       // Execute only if in IDLE or JOG states.
       if (sys.state != STATE_IDLE && sys.state != STATE_JOG) { return(STATUS_IDLE_ERROR); }
+      #ifdef JOG_VELOCITY_MODE
+        if ((line[2] == 'V') && (line[3] == '=')) { return(jog_velocity_execute(&line[4])); }
+      #endif
       if(line[2] != '=') { return(STATUS_INVALID_STATEMENT); }
       return(gc_execute_line(line)); // NOTE: $J= is ignored inside g-code parser and used to detect jog motions.
       break;
@@ -186,6 +253,57 @@ uint8_t system_execute_line(char *line)
           break;
       }
       break;
+    #if defined(BINARY_MOTION_PROTOCOL) || defined(PIPELINE_BENCHMARK)
+      case 'B' :
+        #ifdef PIPELINE_BENCHMARK
+          if (strcmp(&line[2], "ENCH") == 0) { return(bench_run()); } // Pipeline benchmark [IDLE]
+        #endif
+        #ifdef BINARY_MOTION_PROTOCOL
+          // Enter binary motion frames. Also while running, so a job can switch after its preamble.
+          if ( line[2] != 0 ) { return(STATUS_INVALID_STATEMENT); }
+          if (sys.state & (STATE_ALARM | STATE_JOG | STATE_SLEEP)) { return(STATUS_SYSTEM_GC_LOCK); }
+          binary_protocol_enter();
+        #else
+          return(STATUS_INVALID_STATEMENT);
+        #endif
+        break;
+    #endif
+    #ifdef CYCLE_PROFILER
+      case 'L' : // Cycle profiler report, or clear with $LR. Any state, so a running job can be measured.
+        if (line[2] == 0) { profile_report(); }
+        else if ((line[2] == 'R') && (line[3] == 0)) { profile_reset(); }
+        else { return(STATUS_INVALID_STATEMENT); }
+        break;
+    #endif
+    #if defined(MASLOWCNC) && defined(PID_TELEMETRY_SAMPLES)
+      case 'T' : // PID telemetry capture. Arming and triggering work in any state.
+        if ( (line[2] != 0) && (line[3] != 0) ) { return(STATUS_INVALID_STATEMENT); }
+        switch( line[2] ) {
+          case 0 : pid_telemetry_report(); break;
+          case 'A' : pid_telemetry_arm(); break;
+          case 'T' : pid_telemetry_trigger(); break;
+          case 'D' : // Dump the capture.
+            if ( sys.state & (STATE_CYCLE | STATE_HOLD) ) { return(STATUS_IDLE_ERROR); } // Block during cycle. Takes too long to print.
+            pid_telemetry_dump();
+            break;
+          default : return(STATUS_INVALID_STATEMENT);
+        }
+        break;
+    #endif
+    #if defined(MASLOWCNC) && defined(MOTOR_SIMULATION)
+      case 'M' : // Simulated run report, or clear with $MR. Any state, so a running job can be measured.
+        if (line[2] == 0) { motor_sim_report(); }
+        else if ((line[2] == 'R') && (line[3] == 0)) { motor_sim_reset(); }
+        else { return(STATUS_INVALID_STATEMENT); }
+        break;
+    #endif
+    #ifdef SCHEDULER_STATS
+      case 'Q' : // Background task report, or clear with $QR. Any state, so a running job can be measured.
+        if (line[2] == 0) { scheduler_report(); }
+        else if ((line[2] == 'R') && (line[3] == 0)) { scheduler_reset(); }
+        else { return(STATUS_INVALID_STATEMENT); }
+        break;
+    #endif
     default :
       // Block any system command that requires the state as IDLE/ALARM. (i.e. EEPROM, homing)
       if ( !(sys.state == STATE_IDLE || sys.state == STATE_ALARM) ) { return(STATUS_IDLE_ERROR); }
@@ -196,6 +314,33 @@ uint8_t system_execute_line(char *line)
             EEPROM_viewer();
             break;
         #endif
+        #ifdef SD_JOB_STORAGE
+          case 'F' : return(sd_execute_line(line)); // SD card job files [IDLE/ALARM]
+        #endif
+        #if defined(MASLOWCNC) && defined(PID_AUTOTUNE)
+          case 'P' : // PID autotune cycle [IDLE/ALARM]
+            if (line[2] != 'T') { return(STATUS_INVALID_STATEMENT); }
+            if (line[3] == 0) {
+              for (helper_var=0; helper_var<N_AXIS; helper_var++) {
+                uint8_t status = pid_autotune(helper_var);
+                if (status != STATUS_OK) { return(status); }
+              }
+            } else if (line[4] == 0) {
+              switch (line[3]) {
+                case 'X': return(pid_autotune(X_AXIS));
+                case 'Y': return(pid_autotune(Y_AXIS));
+                case 'Z': return(pid_autotune(Z_AXIS));
+                default: return(STATUS_INVALID_STATEMENT);
+              }
+            } else { return(STATUS_INVALID_STATEMENT); }
+            break;
+        #endif
+        #if defined(MASLOWCNC) && defined(KINEMATICS_BENCHMARK)
+          case 'K' : // Kinematics benchmark and round trip check [IDLE/ALARM]
+            if ( line[2] != 0 ) { return(STATUS_INVALID_STATEMENT); }
+            kinematicsBenchmark();
+            break;
+        #endif
         case '#' : // Print Grbl NGC parameters
           if ( line[2] != 0 ) { return(STATUS_INVALID_STATEMENT); }
           else { report_ngc_parameters(); }
@@ -338,11 +483,8 @@ float system_convert_axis_steps_to_mpos(int32_t *steps, uint8_t idx)
 void system_convert_array_steps_to_mpos(float *position, int32_t *steps)
 {
   #ifdef MASLOWCNC
-    // Optimization: do not call system_convert_maslow_to_xy_steps multiple times in a loop!
-    int32_t x_steps, y_steps;
-    system_convert_maslow_to_xy_steps(steps, &x_steps, &y_steps);
-    position[X_AXIS] = (float)x_steps / settings.steps_per_mm[LEFT_MOTOR];
-    position[Y_AXIS] = (float)y_steps / settings.steps_per_mm[RIGHT_MOTOR];
+    // Optimization: do not call system_convert_maslow_to_xy multiple times in a loop!
+    system_convert_maslow_to_xy(steps, &position[X_AXIS], &position[Y_AXIS]);
     position[Z_AXIS] = (float)steps[Z_AXIS] / settings.steps_per_mm[Z_AXIS];
   #else
     uint8_t idx;
@@ -402,8 +544,7 @@ uint8_t system_check_travel_limits(float *target)
 #ifdef MASLOWCNC
 
   void  chainToPosition(float aChainLength, float bChainLength, float *x,float *y ) {
-    _recomputeGeometry();
-
+    PROFILE_FUNCTION(PROFILE_FORWARD);
     #if defined (KINEMATICS_DBG) && KINEMATICS_DBG > 0
       Serial.print(F("Message: chainToPosition(), chainLength: "));
       Serial.print(aChainLength);
@@ -422,22 +563,147 @@ uint8_t system_check_travel_limits(float *target)
     }
   }
 
-  void  positionToChain(float xTarget, float yTarget, float* aChainLength, float* bChainLength) {
-    _recomputeGeometry();
+  #ifdef KINEMATICS_CORRECTION_GRID
+    // Straight distances plus the bilinear correction of the grid cell around the target. Returns
+    // false outside the grid, or before it is in use, for triangularInverse() to solve instead.
+    // Across the outermost cell the lookup is blended into the full solve, which it equals at the
+    // grid edge, so the chains do not step where a line leaves the grid.
+    static uint8_t kinematicsGridInverse(float xTarget, float yTarget, float* aChainLength, float* bChainLength)
+    {
+      float fx = (xTarget - kin_grid_x0)*kin_grid_inv_dx;
+      float fy = (yTarget - kin_grid_y0)*kin_grid_inv_dy;
+      if (kin_grid_valid && (fx >= 0.0f) && (fx <= KINEMATICS_GRID_COLS) && (fy >= 0.0f) && (fy <= KINEMATICS_GRID_ROWS)) {
+        uint8_t col = min((uint8_t)fx, KINEMATICS_GRID_COLS-1);
+        uint8_t row = min((uint8_t)fy, KINEMATICS_GRID_ROWS-1);
+        float tx = fx - col, ty = fy - row;
+        float *c00 = kin_grid[row][col], *c01 = kin_grid[row][col+1];
+        float *c10 = kin_grid[row+1][col], *c11 = kin_grid[row+1][col+1];
+        float w00 = (1.0f-tx)*(1.0f-ty), w01 = tx*(1.0f-ty), w10 = (1.0f-tx)*ty, w11 = tx*ty;
+        float dxA = xTarget + (float)_xCordOfMotor;
+        float dxB = xTarget - (float)_xCordOfMotor;
+        float dy = yTarget - (float)_yCordOfMotor;
+        *aChainLength = sqrtf(dxA*dxA + dy*dy) + w00*c00[0] + w01*c01[0] + w10*c10[0] + w11*c11[0];
+        *bChainLength = sqrtf(dxB*dxB + dy*dy) + w00*c00[1] + w01*c01[1] + w10*c10[1] + w11*c11[1];
+
+        float edge = min(min(fx, KINEMATICS_GRID_COLS - fx), min(fy, KINEMATICS_GRID_ROWS - fy));
+        if (edge < 1.0f) {
+          float exactA, exactB;
+          triangularInverse(xTarget, yTarget, &exactA, &exactB);
+          *aChainLength = exactA + edge*(*aChainLength - exactA);
+          *bChainLength = exactB + edge*(*bChainLength - exactB);
+        }
+        return(true);
+      }
+      return(false);
+    }
+  #endif
+
+  #ifdef KINEMATICS_TARGET_CACHE
+    // Looks up a cached solution, newest first, so a Z-only block finds its XY in the first entry.
+    static uint8_t kinematicsCacheLookup(float xTarget, float yTarget, float* aChainLength, float* bChainLength)
+    {
+      uint8_t idx = kin_cache_next;
+      uint8_t n;
+      for (n=0; n<kin_cache_count; n++) {
+        idx = (idx == 0) ? KINEMATICS_TARGET_CACHE-1 : idx-1;
+        if ((kin_cache_xy[idx][X_AXIS] == xTarget) && (kin_cache_xy[idx][Y_AXIS] == yTarget)) {
+          *aChainLength = kin_cache_chain[idx][LEFT_MOTOR];
+          *bChainLength = kin_cache_chain[idx][RIGHT_MOTOR];
+          kinematics_cache_hits++;
+          return(true);
+        }
+      }
+      kinematics_cache_misses++;
+      return(false);
+    }
+
+    static void kinematicsCacheStore(float xTarget, float yTarget, float aChainLength, float bChainLength)
+    {
+      kin_cache_xy[kin_cache_next][X_AXIS] = xTarget;
+      kin_cache_xy[kin_cache_next][Y_AXIS] = yTarget;
+      kin_cache_chain[kin_cache_next][LEFT_MOTOR] = aChainLength;
+      kin_cache_chain[kin_cache_next][RIGHT_MOTOR] = bChainLength;
+      if (++kin_cache_next == KINEMATICS_TARGET_CACHE) { kin_cache_next = 0; }
+      if (kin_cache_count < KINEMATICS_TARGET_CACHE) { kin_cache_count++; }
+    }
+  #endif
 
+  static void kinematicsSolveInverse(float xTarget, float yTarget, float* aChainLength, float* bChainLength) {
+    PROFILE_FUNCTION(PROFILE_INVERSE);
+    #ifdef KINEMATICS_CORRECTION_GRID
+      if (kinematicsGridInverse(xTarget, yTarget, aChainLength, bChainLength)) { return; }
+    #endif
     return triangularInverse(xTarget, yTarget, aChainLength, bChainLength);
   }
 
-  // recalculate machine base dimensions from settings (in mm)
-  void _recomputeGeometry(void)
+  void  positionToChain(float xTarget, float yTarget, float* aChainLength, float* bChainLength) {
+    #ifdef KINEMATICS_TARGET_CACHE
+      if (kinematicsCacheLookup(xTarget, yTarget, aChainLength, bChainLength)) { return; }
+      kinematicsSolveInverse(xTarget, yTarget, aChainLength, bChainLength);
+      kinematicsCacheStore(xTarget, yTarget, *aChainLength, *bChainLength);
+    #else
+      kinematicsSolveInverse(xTarget, yTarget, aChainLength, bChainLength);
+    #endif
+  }
+
+  // Jacobian of triangularInverse(): the unit vectors from each motor toward the sled, which are
+  // the derivatives of the straight motor-to-sled distances. Sag, sprocket wrap and stretch only
+  // add small, slowly varying corrections to it.
+  void  chainJacobian(float x, float y, float *jacobian) {
+    float dxA = x + (float)_xCordOfMotor;
+    float dxB = x - (float)_xCordOfMotor;
+    float dy = y - (float)_yCordOfMotor;
+    float invDistA = 1.0f / sqrtf(dxA*dxA + dy*dy);
+    float invDistB = 1.0f / sqrtf(dxB*dxB + dy*dy);
+    jacobian[0] = dxA * invDistA;
+    jacobian[1] = dy * invDistA;
+    jacobian[2] = dxB * invDistB;
+    jacobian[3] = dy * invDistB;
+  }
+
+  // Inverse of chainJacobian() at x-y, sled mm per chain mm as { dx/dA, dx/dB, dy/dA, dy/dB }.
+  // Returns false where it is singular, with the chains colinear, and leaves inverse unset.
+  uint8_t chainJacobianInverse(float x, float y, float *inverse) {
+    float jacobian[4];
+    chainJacobian(x, y, jacobian);
+    float det = jacobian[0]*jacobian[3] - jacobian[1]*jacobian[2];
+    if (det == 0) { return(false); }
+    float inv_det = 1.0f / det;
+    inverse[0] = jacobian[3] * inv_det;
+    inverse[1] = -jacobian[1] * inv_det;
+    inverse[2] = -jacobian[2] * inv_det;
+    inverse[3] = jacobian[0] * inv_det;
+    return(true);
+  }
+
+  // recalculate machine base dimensions and kinematics invariants from settings (in mm)
+  // NOTE: Called by the settings module on init and whenever the global settings are written,
+  // so the kinematics functions never have to re-derive these per target.
+  void recomputeGeometry(void)
   {
-      /*
-      Some variables are computed on class creation for the geometry of the machine to reduce overhead,
-      calling this function regenerates those values.
-      */
       _xCordOfMotor = (settings.distBetweenMotors/2);
       _yCordOfMotor = ((settings.machineHeight / 2.0) + settings.motorOffsetY);
 
+      _srsqrd = (kin_real_t)_sprocketRadius * (kin_real_t)_sprocketRadius;
+      _chainDensity = (kin_real_t)(0.14 * 9.8 / 1000);
+      _halfChainDensity = 0.5 * _chainDensity;
+      _invChainDensity = 1.0 / _chainDensity;
+      _chainElasticity = settings.chainElongationFactor;
+      _sledWeight = settings.sledWeight;
+      _leftToleranceScale = 1.0 / (1.0 + settings.leftChainTolerance/100.0);
+      _rightToleranceScale = 1.0 / (1.0 + settings.rightChainTolerance/100.0);
+      _rotationDiskRadius = settings.rotationDiskRadius;
+      _chainOverSprocket = (settings.chainOverSprocket == 1);
+    #ifdef REPORT_MPOS_CACHE
+      mpos_cache_valid = false; // Geometry or steps/mm may have changed.
+    #endif
+    #ifdef KINEMATICS_TARGET_CACHE
+      kin_cache_count = 0;
+    #endif
+    #ifdef KINEMATICS_CORRECTION_GRID
+      kinematicsBuildGrid();
+    #endif
+
     #if defined (KINEMATICS_DBG) && KINEMATICS_DBG > 0
       Serial.print(F("Message: recomputeGeometry(), motor position: "));
       Serial.print(_xCordOfMotor);
@@ -446,6 +712,93 @@ uint8_t system_check_travel_limits(float *target)
     #endif
   }
 
+  #ifdef KINEMATICS_CORRECTION_GRID
+    // Solves triangularInverse() at every grid node over the machine width and height and keeps
+    // the difference to the straight distances, which the sag, wrap and stretch terms make smooth.
+    // The interpolation error estimate follows from the grid second differences, h^2*f'' per node,
+    // as bilinear interpolation is off by at most h^2/8 of the second derivative each way.
+    // NOTE: About one inverse solve per node, so on the order of a second for the default grid.
+    // Only rebuilt at power-up and on settings writes. Until it is done, targets are solved in full.
+    static float kinematicsGridSecondDifference(float *node, uint16_t stride)
+    {
+      return(*(node - stride) - 2.0f*(*node) + *(node + stride));
+    }
+
+    void kinematicsBuildGrid(void)
+    {
+      kin_grid_valid = false;
+      kin_grid_built = false;
+      kin_grid_build_node = KIN_GRID_NODES;
+      kin_grid_dx = settings.machineWidth/KINEMATICS_GRID_COLS;
+      kin_grid_dy = settings.machineHeight/KINEMATICS_GRID_ROWS;
+      if (!(kin_grid_dx > 0.0f && kin_grid_dy > 0.0f)) { return; }
+      kin_grid_x0 = -0.5f*settings.machineWidth;
+      kin_grid_y0 = -0.5f*settings.machineHeight;
+      kin_grid_inv_dx = 1.0f/kin_grid_dx;
+      kin_grid_inv_dy = 1.0f/kin_grid_dy;
+      kin_grid_build_node = 0;
+    }
+
+    // Solves grid nodes for about budget_us, then the error bound once all are done. Returns true
+    // while nodes are left, or the grid waits to be taken up. A scheduler task.
+    // NOTE: The kinematics only change over to the grid while the machine is stopped with an empty
+    // planner, never partway through a job, so a line is always planned and reported by one solver.
+    uint8_t kinematicsGridService(uint16_t budget_us)
+    {
+      if (kin_grid_built) {
+        if (((sys.state != STATE_IDLE) && (sys.state != STATE_ALARM)) || (plan_get_block_buffer_count() != 0)) { return(true); }
+        kin_grid_built = false;
+        kin_grid_valid = true;
+        #ifdef KINEMATICS_TARGET_CACHE
+          kin_cache_count = 0; // Solved in full. Later targets take the grid, as the forward solution does.
+        #endif
+        #ifdef REPORT_MPOS_CACHE
+          mpos_cache_valid = false;
+        #endif
+        return(false);
+      }
+      if (kin_grid_build_node >= KIN_GRID_NODES) { return(false); }
+      uint32_t start = micros();
+      do {
+        uint8_t row = kin_grid_build_node / (KINEMATICS_GRID_COLS+1);
+        uint8_t col = kin_grid_build_node % (KINEMATICS_GRID_COLS+1);
+        float x = kin_grid_x0 + col*kin_grid_dx;
+        float y = kin_grid_y0 + row*kin_grid_dy;
+        float chain[2];
+        triangularInverse(x, y, &chain[0], &chain[1]);
+        float dxA = x + (float)_xCordOfMotor;
+        float dxB = x - (float)_xCordOfMotor;
+        float dyM = y - (float)_yCordOfMotor;
+        kin_grid[row][col][0] = chain[0] - sqrtf(dxA*dxA + dyM*dyM);
+        kin_grid[row][col][1] = chain[1] - sqrtf(dxB*dxB + dyM*dyM);
+        kin_grid_build_node++;
+      } while ((kin_grid_build_node < KIN_GRID_NODES) && ((micros() - start) < budget_us));
+      if (kin_grid_build_node < KIN_GRID_NODES) { return(true); }
+
+      // The second derivative grows towards the motors, so the edge nodes take the differences of
+      // the next two inside extended linearly, or the bound falls short in the corners.
+      float max_xx = 0.0f, max_yy = 0.0f;
+      uint8_t row, col, idx;
+      for (row=0; row<=KINEMATICS_GRID_ROWS; row++) {
+        for (col=0; col<=KINEMATICS_GRID_COLS; col++) {
+          for (idx=0; idx<2; idx++) {
+            uint8_t c = min(max(col, 1), KINEMATICS_GRID_COLS-1);
+            uint8_t r = min(max(row, 1), KINEMATICS_GRID_ROWS-1);
+            float d_xx = kinematicsGridSecondDifference(&kin_grid[row][c][idx], 2);
+            float d_yy = kinematicsGridSecondDifference(&kin_grid[r][col][idx], 2*(KINEMATICS_GRID_COLS+1));
+            if (col != c) { d_xx = 2.0f*d_xx - kinematicsGridSecondDifference(&kin_grid[row][2*c-col][idx], 2); }
+            if (row != r) { d_yy = 2.0f*d_yy - kinematicsGridSecondDifference(&kin_grid[2*r-row][col][idx], 2*(KINEMATICS_GRID_COLS+1)); }
+            max_xx = max(max_xx, fabsf(d_xx));
+            max_yy = max(max_yy, fabsf(d_yy));
+          }
+        }
+      }
+      kinematics_grid_error = 0.125f*(max_xx + max_yy);
+      kin_grid_built = true;
+      return(true);
+    }
+  #endif
+
   // Maslow math - coordinate system tranformation
   // calculate machine coordinate (x-y) postion from chain lengths in mm (pos in mm)
   void triangularSimple(float aChainLength, float bChainLength, float *x,float *y )
@@ -481,34 +834,52 @@ uint8_t system_check_travel_limits(float *target)
   }
 
   // triangularForward() are able to compensate for chain sag, an improvement on triangular().
-  // It takes an iterative approach to solving for chain sag, attempting to achieve
-  // the desired KINEMATICS_MAX_ERR. It is less performant, and care should be used to avoid
-  // pegging the limited Arduino CPU.
+  // It solves triangularInverse(x,y) == (chainALength,chainBLength) by Newton-Raphson, seeded from
+  // the guess passed in *xPos/*yPos (normally the last known position). The Jacobian is the analytic
+  // derivative of the straight motor-to-sled distances; sag, sprocket wrap and stretch only add
+  // small, slowly varying corrections to it. Over a sweep of the default work area, the iteration
+  // converges to KINEMATICS_MAX_ERR in 2-4 inverse solves from a seed within a few mm, as between
+  // status reports, and in 3-6 from the work area center. KINEMATICS_MAX_GUESS leaves room over that
+  // for other geometries. The iteration count of the last solve is kept in
+  // kinematics_forward_iterations for instrumentation.
+  uint8_t kinematics_forward_iterations = 0;
+
   void triangularForward(float chainALength, float chainBLength, float* xPos, float* yPos)
   {
     float guessLengthA = 0, guessLengthB = 0;
     float xGuess = *xPos, yGuess = *yPos;
-    int guessCount = 0;
+    uint8_t guessCount = 0;
+
+    // A guess outside the frame (or an unset one) is a poor seed. Start from the work area center.
+    if (!(fabsf(xGuess) <= (float)_xCordOfMotor && yGuess < (float)_yCordOfMotor)) {
+      xGuess = 0;
+      yGuess = 0;
+    }
 
     while(1){
         //check our guess
+        #ifdef KINEMATICS_CORRECTION_GRID
+          // Same inverse as the planner, so positions report back the chains it planned.
+          if (!kinematicsGridInverse(xGuess, yGuess, &guessLengthA, &guessLengthB))
+        #endif
         triangularInverse(xGuess, yGuess, &guessLengthA, &guessLengthB);
 
         float aChainError = chainALength - guessLengthA;
         float bChainError = chainBLength - guessLengthB;
 
-        //adjust the guess based on the result
-        xGuess = xGuess + aChainError - bChainError;
-        yGuess = yGuess - aChainError - bChainError;
-
         guessCount++;
 
         //if we've converged on the point...or it's time to give up, exit the loop
-        if ((abs(aChainError) <= KINEMATICS_MAX_ERR && abs(bChainError) <= KINEMATICS_MAX_ERR) or
+        if ((fabsf(aChainError) <= KINEMATICS_MAX_ERR && fabsf(bChainError) <= KINEMATICS_MAX_ERR) or
           guessCount > KINEMATICS_MAX_GUESS or
           guessLengthA > settings.chainLength or
           guessLengthB > settings.chainLength)
         {
+            kinematics_forward_iterations = guessCount;
+            #ifdef REPORT_MPOS_CACHE
+              mpos_solve_failed = (guessCount > KINEMATICS_MAX_GUESS) or guessLengthA > settings.chainLength or guessLengthB > settings.chainLength;
+            #endif
+
             #if defined (KINEMATICS_DBG) && KINEMATICS_DBG > 0
               Serial.print(F("Message: forwardKinematics() complete; best guess: "));
               Serial.print(guessLengthA);
@@ -538,6 +909,127 @@ uint8_t system_check_travel_limits(float *target)
             }
             break;
         }
+
+        //adjust the guess based on the result, through the inverse Jacobian of the chain lengths
+        float inverse[4];
+        if (!chainJacobianInverse(xGuess, yGuess, inverse)) { guessCount = KINEMATICS_MAX_GUESS; continue; } // Singular. Chains are colinear.
+        xGuess += inverse[0]*aChainError + inverse[1]*bChainError;
+        yGuess += inverse[2]*aChainError + inverse[3]*bChainError;
+    }
+  }
+
+  #ifdef KINEMATICS_BENCHMARK
+    // Call times of one kinematics function over the benchmark sweep, in microseconds.
+    typedef struct {
+      uint32_t calls;
+      uint32_t min;
+      uint32_t max;
+      uint32_t total;
+    } kin_bench_t;
+
+    static void kinematicsBenchRecord(kin_bench_t *b, uint32_t start_us)
+    {
+      uint32_t us = micros() - start_us;
+      b->calls++;
+      b->total += us;
+      if (us < b->min) { b->min = us; }
+      if (us > b->max) { b->max = us; }
+    }
+
+    // [KBM:name,calls,min,mean,max] in microseconds.
+    static void kinematicsBenchReport(const char *name, kin_bench_t *b)
+    {
+      printPgmString(PSTR("[KBM:"));
+      printPgmString(name);
+      serial_write(',');
+      print_uint32_base10(b->calls);
+      if (b->calls) {
+        serial_write(',');
+        print_uint32_base10(b->min);
+        serial_write(',');
+        print_uint32_base10(b->total/b->calls);
+        serial_write(',');
+        print_uint32_base10(b->max);
+      }
+      printPgmString(PSTR("]\r\n"));
+    }
+
+    // Times triangularInverse(), positionToChain() and chainToPosition() at the points of a
+    // KINEMATICS_BENCHMARK_COLS x ROWS sweep of the work area, and checks the round trip of
+    // positionToChain() through chainToPosition(). The forward solve is seeded from the work area
+    // center, the worst case, rather than the nearby last position it normally starts from.
+    // [KRT:max,mean round trip error mm,max positionToChain() chain error mm,max forward solves]
+    // follows the timings. The chain error is against the full solve, so it is the correction grid
+    // error where enabled and zero otherwise. Interrupts keep running, so times include the handlers.
+    void kinematicsBenchmark(void)
+    {
+      kin_bench_t ik, pc, fk;
+      memset(&ik, 0, sizeof(ik)); ik.min = 0xFFFFFFFF;
+      memset(&pc, 0, sizeof(pc)); pc.min = 0xFFFFFFFF;
+      memset(&fk, 0, sizeof(fk)); fk.min = 0xFFFFFFFF;
+      float max_xy_error = 0.0f, total_xy_error = 0.0f, max_chain_error = 0.0f;
+      uint8_t max_iterations = 0;
+      uint8_t col, row;
+      for (row=0; row<=KINEMATICS_BENCHMARK_ROWS; row++) {
+        float y = settings.machineHeight*((float)row/KINEMATICS_BENCHMARK_ROWS - 0.5f);
+        for (col=0; col<=KINEMATICS_BENCHMARK_COLS; col++) {
+          float x = settings.machineWidth*((float)col/KINEMATICS_BENCHMARK_COLS - 0.5f);
+          float a, b, a_full, b_full, x_back = 0.0f, y_back = 0.0f;
+          uint32_t start_us = micros();
+          triangularInverse(x, y, &a_full, &b_full);
+          kinematicsBenchRecord(&ik, start_us);
+          start_us = micros();
+          positionToChain(x, y, &a, &b);
+          kinematicsBenchRecord(&pc, start_us);
+          start_us = micros();
+          chainToPosition(a, b, &x_back, &y_back);
+          kinematicsBenchRecord(&fk, start_us);
+
+          float xy_error = hypot_f(x_back - x, y_back - y);
+          total_xy_error += xy_error;
+          max_xy_error = max(max_xy_error, xy_error);
+          max_chain_error = max(max_chain_error, max(fabsf(a - a_full), fabsf(b - b_full)));
+          max_iterations = max(max_iterations, kinematics_forward_iterations);
+          protocol_execute_realtime(); // Keeps the status reports and resets going.
+          if (sys.abort) { return; }
+        }
+      }
+      kinematicsBenchReport(PSTR("IK"), &ik);
+      kinematicsBenchReport(PSTR("P2C"), &pc);
+      kinematicsBenchReport(PSTR("C2P"), &fk);
+      printPgmString(PSTR("[KRT:"));
+      printFloat(max_xy_error, 4);
+      serial_write(',');
+      printFloat(total_xy_error/fk.calls, 4);
+      serial_write(',');
+      printFloat(max_chain_error, 4);
+      serial_write(',');
+      print_uint8_base10(max_iterations);
+      printPgmString(PSTR("]\r\n"));
+    }
+  #endif
+
+  // Reads where the machine actually is, in sys_position steps. Both the commanded positions and the
+  // encoder counts are read with interrupts off, so the stepper and encoder ISRs cannot move them
+  // part way through. sys_position is where the planner has the machine, and the PID following error
+  // (target - axis_Position) is then taken off it. The error is in the motor direction, so the sign
+  // follows the Y reversal and $3 as in st_stream_axis(). Used to latch probe, limit and fault
+  // positions from their pin interrupts.
+  void system_get_measured_position(int32_t *steps)
+  {
+    int32_t position[N_AXIS];
+    long int error[N_AXIS];
+    CRITICAL_ENTER();
+    memcpy(position, sys_position, sizeof(sys_position));
+    error[X_AXIS] = x_axis.target - x_axis.axis_Position;
+    error[Y_AXIS] = y_axis.target - y_axis.axis_Position;
+    error[Z_AXIS] = z_axis.target - z_axis.axis_Position;
+    CRITICAL_EXIT();
+    for (uint8_t idx = 0; idx < N_AXIS; idx++) {
+      uint8_t reverse = (idx == Y_AXIS);
+      if (bit_istrue(settings.dir_invert_mask, bit(idx))) { reverse = !reverse; }
+      if (reverse) { steps[idx] = position[idx] + error[idx]; }
+      else { steps[idx] = position[idx] - error[idx]; }
     }
   }
 
@@ -545,89 +1037,146 @@ uint8_t system_check_travel_limits(float *target)
   // converts current position two-chain intersection (steps) into x / y cartesian in STEPS..
   void system_convert_maslow_to_xy_steps(int32_t *steps, int32_t *x_steps, int32_t *y_steps)
   {
-    chainToPosition((float)(steps[LEFT_MOTOR]/settings.steps_per_mm[LEFT_MOTOR]),
-                    (float)(steps[RIGHT_MOTOR]/settings.steps_per_mm[RIGHT_MOTOR]),
-                    &_xLastPosition, &_yLastPosition);
+    float x, y;
+    system_convert_maslow_to_xy(steps, &x, &y);
+    *x_steps = lround(x * settings.steps_per_mm[X_AXIS]);
+    *y_steps = lround(y * settings.steps_per_mm[Y_AXIS]);
+  }
+
+  // Converts the two-chain intersection (steps) into x / y cartesian in mm.
+  // NOTE: With REPORT_MPOS_CACHE, unchanged chain steps return the cached solution without solving.
+  // Otherwise the solve is seeded by a linear step from the cached solution, which is within
+  // KINEMATICS_MAX_ERR, or close to it, for the small changes between status reports. triangularForward()
+  // then converges in one or two inverse solves instead of iterating from the last position. The
+  // closed form triangularSimple() ignores the seed and only gains from the unchanged case.
+  void system_convert_maslow_to_xy(int32_t *steps, float *x, float *y)
+  {
+    int32_t left_steps = steps[LEFT_MOTOR]; // Read once. Often sent sys_position directly.
+    int32_t right_steps = steps[RIGHT_MOTOR];
+    float aChainLength = left_steps/settings.steps_per_mm[LEFT_MOTOR];
+    float bChainLength = right_steps/settings.steps_per_mm[RIGHT_MOTOR];
+
+    #ifdef REPORT_MPOS_CACHE
+      if (mpos_cache_valid) {
+        if ((left_steps == mpos_cache_steps[LEFT_MOTOR]) && (right_steps == mpos_cache_steps[RIGHT_MOTOR])) {
+          *x = mpos_cache_xy[X_AXIS];
+          *y = mpos_cache_xy[Y_AXIS];
+          return;
+        }
+        float da = aChainLength - mpos_cache_chain[LEFT_MOTOR];
+        float db = bChainLength - mpos_cache_chain[RIGHT_MOTOR];
+        _xLastPosition = mpos_cache_xy[X_AXIS] + mpos_cache_inv_jacobian[0]*da + mpos_cache_inv_jacobian[1]*db;
+        _yLastPosition = mpos_cache_xy[Y_AXIS] + mpos_cache_inv_jacobian[2]*da + mpos_cache_inv_jacobian[3]*db;
+      }
+      mpos_solve_failed = false;
+    #endif
 
-    *x_steps = (int32_t) _xLastPosition * settings.steps_per_mm[X_AXIS];
-    *y_steps = (int32_t) _yLastPosition * settings.steps_per_mm[Y_AXIS];
+    chainToPosition(aChainLength, bChainLength, &_xLastPosition, &_yLastPosition);
+    *x = _xLastPosition;
+    *y = _yLastPosition;
+
+    #ifdef REPORT_MPOS_CACHE
+      // A failed solve leaves 0,0, which would seed the next one far off. Solve that afresh.
+      if (mpos_solve_failed) { mpos_cache_valid = false; return; }
+      // Inverse of the chain length Jacobian at the new position, as in triangularForward().
+      if (!chainJacobianInverse(_xLastPosition, _yLastPosition, mpos_cache_inv_jacobian)) { mpos_cache_valid = false; return; }
+      mpos_cache_steps[LEFT_MOTOR] = left_steps;
+      mpos_cache_steps[RIGHT_MOTOR] = right_steps;
+      mpos_cache_chain[LEFT_MOTOR] = aChainLength;
+      mpos_cache_chain[RIGHT_MOTOR] = bChainLength;
+      mpos_cache_xy[X_AXIS] = _xLastPosition;
+      mpos_cache_xy[Y_AXIS] = _yLastPosition;
+      mpos_cache_valid = true;
+    #endif
   }
 
   // calculate left and right (LEFT_MOTOR/RIGHT_MOTOR) chain lengths from X-Y cartesian coordinates  (in mm)
   // target is an absolute position in the frame
+  // NOTE: Runs in kin_real_t (float with KINEMATICS_SINGLE_PRECISION, double otherwise). All geometry
+  // invariants come from recomputeGeometry(), so only the target dependent math is left here.
   void triangularInverse(float xTarget, float yTarget, float* aChainLength, float* bChainLength)
   {
       // scale target (absolute position) by any correction factor
-      // Use double math internally for faster computation.
-      double xxx = (double)xTarget; // * (double)settings.XcorrScaling;
-      double yyy = (double)yTarget; // * (double)settings.YcorrScaling;
+      kin_real_t xxx = (kin_real_t)xTarget; // * settings.XcorrScaling;
+      kin_real_t yyy = (kin_real_t)yTarget; // * settings.YcorrScaling;
+      kin_real_t sprocketRadius = (kin_real_t)_sprocketRadius;
 
       //Calculate motor axes length to the bit
-      double Motor1Distance = sqrt(pow((-1*_xCordOfMotor) - xxx,2)+pow(_yCordOfMotor - yyy,2));
-      double Motor2Distance = sqrt(pow((_xCordOfMotor) - xxx,2)+pow(_yCordOfMotor - yyy,2));
+      kin_real_t xDiff1 = -_xCordOfMotor - xxx;
+      kin_real_t xDiff2 = _xCordOfMotor - xxx;
+      kin_real_t yDiff = _yCordOfMotor - yyy;
+      kin_real_t yDiffSqrd = yDiff * yDiff;
+      kin_real_t Motor1DistanceSqrd = xDiff1*xDiff1 + yDiffSqrd;
+      kin_real_t Motor2DistanceSqrd = xDiff2*xDiff2 + yDiffSqrd;
+      kin_real_t Motor1Distance = KIN_SQRT(Motor1DistanceSqrd);
+      kin_real_t Motor2Distance = KIN_SQRT(Motor2DistanceSqrd);
+      kin_real_t invMotor1Distance = 1.0f / Motor1Distance;
+      kin_real_t invMotor2Distance = 1.0f / Motor2Distance;
 
       //Set up variables
-      double Chain1Angle = 0, Chain2Angle = 0;
-      double Chain1AroundSprocket = 0, Chain2AroundSprocket = 0;
-      double xTangent1 = 0, yTangent1 = 0, xTangent2 = 0, yTangent2 = 0;
+      kin_real_t Chain1Angle, Chain2Angle;
+      kin_real_t Chain1AroundSprocket, Chain2AroundSprocket;
+      kin_real_t xTangent1, yTangent1, xTangent2, yTangent2;
 
       //Calculate the chain angles from horizontal, based on if the chain connects to the sled from the top or bottom of the sprocket
-      double yDiff = _yCordOfMotor - yTarget;
-      if(settings.chainOverSprocket == 1){
-        Chain1Angle = asin(yDiff/Motor1Distance) + asin(_sprocketRadius/Motor1Distance);
-        Chain2Angle = asin(yDiff/Motor2Distance) + asin(_sprocketRadius/Motor2Distance);
-
-        Chain1AroundSprocket = _sprocketRadius * Chain1Angle;
-        Chain2AroundSprocket = _sprocketRadius * Chain2Angle;
-
-        xTangent1 = -1.0 * _xCordOfMotor + _sprocketRadius * sin(Chain1Angle);
-        yTangent1 = _yCordOfMotor + _sprocketRadius * cos(Chain1Angle);
-
-        xTangent2 = _xCordOfMotor - _sprocketRadius * sin(Chain2Angle);
-        yTangent2 = _yCordOfMotor + _sprocketRadius * cos(Chain2Angle);
+      kin_real_t angle1 = KIN_ASIN(yDiff*invMotor1Distance);
+      kin_real_t angle2 = KIN_ASIN(yDiff*invMotor2Distance);
+      kin_real_t wrap1 = KIN_ASIN(sprocketRadius*invMotor1Distance);
+      kin_real_t wrap2 = KIN_ASIN(sprocketRadius*invMotor2Distance);
+      if(_chainOverSprocket){
+        Chain1Angle = angle1 + wrap1;
+        Chain2Angle = angle2 + wrap2;
+
+        Chain1AroundSprocket = sprocketRadius * Chain1Angle;
+        Chain2AroundSprocket = sprocketRadius * Chain2Angle;
+
+        xTangent1 = -_xCordOfMotor + sprocketRadius * KIN_SIN(Chain1Angle);
+        yTangent1 = _yCordOfMotor + sprocketRadius * KIN_COS(Chain1Angle);
+
+        xTangent2 = _xCordOfMotor - sprocketRadius * KIN_SIN(Chain2Angle);
+        yTangent2 = _yCordOfMotor + sprocketRadius * KIN_COS(Chain2Angle);
       } else {
-        Chain1Angle = asin(yDiff/Motor1Distance) - asin(_sprocketRadius/Motor1Distance);
-        Chain2Angle = asin(yDiff/Motor2Distance) - asin(_sprocketRadius/Motor2Distance);
+        Chain1Angle = angle1 - wrap1;
+        Chain2Angle = angle2 - wrap2;
 
-        Chain1AroundSprocket = _sprocketRadius * (3.14159 - Chain1Angle);
-        Chain2AroundSprocket = _sprocketRadius * (3.14159 - Chain2Angle);
+        Chain1AroundSprocket = sprocketRadius * ((kin_real_t)3.14159 - Chain1Angle);
+        Chain2AroundSprocket = sprocketRadius * ((kin_real_t)3.14159 - Chain2Angle);
 
-        xTangent1 = -1.0 * _xCordOfMotor - _sprocketRadius * sin(Chain1Angle);
-        yTangent1 = _yCordOfMotor - _sprocketRadius * cos(Chain1Angle);
+        xTangent1 = -_xCordOfMotor - sprocketRadius * KIN_SIN(Chain1Angle);
+        yTangent1 = _yCordOfMotor - sprocketRadius * KIN_COS(Chain1Angle);
 
-        xTangent2 = _xCordOfMotor + _sprocketRadius * sin(Chain2Angle);
-        yTangent2 = _yCordOfMotor - _sprocketRadius * cos(Chain2Angle);
+        xTangent2 = _xCordOfMotor + sprocketRadius * KIN_SIN(Chain2Angle);
+        yTangent2 = _yCordOfMotor - sprocketRadius * KIN_COS(Chain2Angle);
       }
 
-      double sledWeight = settings.sledWeight;
-      double chainDensity = 0.14 * 9.8 / 1000; // Newtons / mm
-      double chainElasticity = settings.chainElongationFactor; // mm/mm/Newton
-
       //Calculate the straight chain length from the sprocket to the bit
-      double srsqrd = pow(_sprocketRadius,2);
-      double Chain1Straight = sqrt(pow(Motor1Distance,2)-srsqrd);
-      double Chain2Straight = sqrt(pow(Motor2Distance,2)-srsqrd);
+      kin_real_t Chain1Straight = KIN_SQRT(Motor1DistanceSqrd - _srsqrd);
+      kin_real_t Chain2Straight = KIN_SQRT(Motor2DistanceSqrd - _srsqrd);
 
       // Calculate chain tension
-      double totalWeight = sledWeight + 0.5 * chainDensity * (Chain1Straight + Chain2Straight);
-      double tensionD = (xTangent1*yTangent2-xTangent2*yTangent1-xTangent1*yTarget+xTarget*yTangent1+xTangent2*yTarget-xTarget*yTangent2);
-      double tension1 = - (totalWeight*sqrt(pow(xTangent1-xTarget,2.0)+pow(yTangent1-yTarget,2.0))*(xTangent2-xTarget))/tensionD;
-      double tension2 = (totalWeight*sqrt(pow(xTangent2-xTarget,2.0)+pow(yTangent2-yTarget,2.0))*(xTangent1-xTarget))/tensionD;
-      double horizontalTension = tension1 * (xTarget - xTangent1) / Chain1Straight;
-      double a1 = horizontalTension / chainDensity;
-      double a2 = horizontalTension / chainDensity;
+      kin_real_t dx1 = xTangent1 - xxx, dy1 = yTangent1 - yyy;
+      kin_real_t dx2 = xTangent2 - xxx, dy2 = yTangent2 - yyy;
+      kin_real_t totalWeight = _sledWeight + _halfChainDensity * (Chain1Straight + Chain2Straight);
+      kin_real_t tensionD = dx1*dy2 - dx2*dy1;  // == the expanded tangent cross product, without the large-term cancellation
+      kin_real_t tension1 = - (totalWeight*KIN_SQRT(dx1*dx1 + dy1*dy1)*dx2)/tensionD;
+      kin_real_t tension2 = (totalWeight*KIN_SQRT(dx2*dx2 + dy2*dy2)*dx1)/tensionD;
+      kin_real_t horizontalTension = -tension1 * dx1 / Chain1Straight;
+      kin_real_t a1 = horizontalTension * _invChainDensity;
+      kin_real_t a2 = a1;
 
       // Catenary equation: total chain length excluding sprocket geometry, chain tolerance, and chain elasticity
-      double chain1 = sqrt(pow(2*a1*sinh((xTarget-xTangent1)/(2*a1)),2)+pow(yTangent1-yTarget,2));
-      double chain2 = sqrt(pow(2*a2*sinh((xTangent2-xTarget)/(2*a2)),2)+pow(yTangent2-yTarget,2));
+      kin_real_t sag1 = 2*a1*KIN_SINH(-dx1/(2*a1));
+      kin_real_t sag2 = 2*a2*KIN_SINH(dx2/(2*a2));
+      kin_real_t chain1 = KIN_SQRT(sag1*sag1 + dy1*dy1);
+      kin_real_t chain2 = KIN_SQRT(sag2*sag2 + dy2*dy2);
 
       //Calculate total chain lengths accounting for sprocket geometry, chain tolerance, and chain elasticity
-      chain1 = Chain1AroundSprocket + chain1/(1.0f+settings.leftChainTolerance/100.0f)/(1.0f+tension1*chainElasticity);
-      chain2 = Chain2AroundSprocket + chain2/(1.0f+settings.rightChainTolerance/100.0f)/(1.0f+tension2*chainElasticity);
+      chain1 = Chain1AroundSprocket + chain1*_leftToleranceScale/(1+tension1*_chainElasticity);
+      chain2 = Chain2AroundSprocket + chain2*_rightToleranceScale/(1+tension2*_chainElasticity);
 
       //Subtract of the virtual length which is added to the chain by the rotation mechanism
-      *aChainLength = (float)(chain1 - settings.rotationDiskRadius);
-      *bChainLength = (float)(chain2 - settings.rotationDiskRadius);
+      *aChainLength = (float)(chain1 - _rotationDiskRadius);
+      *bChainLength = (float)(chain2 - _rotationDiskRadius);
   }
 
 #endif
@@ -655,6 +1204,16 @@ void system_clear_exec_state_flag(uint8_t mask) {
   #endif
 }
 
+#ifdef REPORT_FIELD_STARVATION
+  void system_add_planner_wait(uint32_t us)
+  {
+    us += sys_starvation.planner_wait_us;
+    sys_starvation.planner_wait_ms += us/1000;
+    sys_starvation.planner_wait_us = us%1000;
+  }
+#endif
+
+
 void system_set_exec_alarm(uint8_t code) {
   #ifndef MASLOWCNC
     uint8_t sreg = SREG;
@@ -663,6 +1222,9 @@ void system_set_exec_alarm(uint8_t code) {
     SREG = sreg;
   #else
     sys_rt_exec_alarm = code;
+    #ifdef PID_TELEMETRY_SAMPLES
+      pid_telemetry_alarm(); // freeze an armed capture on the ticks leading up to the alarm
+    #endif
   #endif
 }
 
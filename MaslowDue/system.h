@@ -50,6 +50,7 @@
 #define EXEC_ALARM_HOMING_FAIL_DOOR     7
 #define EXEC_ALARM_HOMING_FAIL_PULLOFF  8
 #define EXEC_ALARM_HOMING_FAIL_APPROACH 9
+#define EXEC_ALARM_DRIVER_FAULT         10 // Maslow motor driver fault line. See DRIVER_FAULT_ALARM.
 
 // Override bit maps. Realtime bitflags to control feed, rapid, spindle, and coolant overrides.
 // Spindle/coolant and feed/rapids are separated into two controlling flag variables.
@@ -147,6 +148,10 @@ extern system_t sys;
 // NOTE: These position variables may need to be declared as volatiles, if problems arise.
 extern int32_t sys_position[N_AXIS];      // Real-time machine (aka home) position vector in steps.
 extern int32_t sys_probe_position[N_AXIS]; // Last probe position in machine coordinates and steps.
+#ifdef MASLOWCNC
+  extern int32_t sys_fault_position[N_AXIS]; // Measured position when a limit or driver fault tripped, in steps.
+  extern volatile uint8_t sys_fault_axes;    // Axes whose limit or fault line tripped. Reported with [FLT:].
+#endif
 
 extern volatile uint8_t sys_probe_state;   // Probing state value.  Used to coordinate the probing cycle with stepper ISR.
 extern volatile uint8_t sys_rt_exec_state;   // Global realtime executor bitflag variable for state management. See EXEC bitmasks.
@@ -154,6 +159,18 @@ extern volatile uint8_t sys_rt_exec_alarm;   // Global realtime executor bitflag
 extern volatile uint8_t sys_rt_exec_motion_override; // Global realtime executor bitflag variable for motion-based overrides.
 extern volatile uint8_t sys_rt_exec_accessory_override; // Global realtime executor bitflag variable for spindle/coolant overrides.
 
+#ifdef REPORT_FIELD_STARVATION
+  // Throughput loss counters for the status report. See REPORT_FIELD_STARVATION in config.h.
+  typedef struct {
+    volatile uint32_t segment_underruns; // Step ISR ran out of segments with planner blocks left.
+    uint32_t planner_empty;              // st_prep_buffer() found the planner empty during a cycle.
+    uint32_t rx_empty;                   // Serial RX ran dry during a cycle with room in the planner.
+    uint32_t planner_wait_ms;            // Time mc_line() waited on a full planner buffer.
+    uint32_t planner_wait_us;            // Sub-millisecond remainder of planner_wait_ms.
+  } sys_starvation_t;
+  extern sys_starvation_t sys_starvation;
+#endif
+
 #ifdef DEBUG
   #define EXEC_DEBUG_REPORT  bit(0)
   extern volatile uint8_t sys_rt_exec_debug;
@@ -192,11 +209,20 @@ void system_convert_array_steps_to_mpos(float *position, int32_t *steps);
 // Maslow CNC calculation only. Returns x or y-axis "steps" based on Maslow motor steps.
 #ifdef MASLOWCNC
   void system_convert_maslow_to_xy_steps(int32_t *steps, int32_t *x_steps, int32_t *y_steps);
+  // As above, in mm. Cached with REPORT_MPOS_CACHE.
+  void system_convert_maslow_to_xy(int32_t *steps, float *x, float *y);
+  // Measured machine position in steps: sys_position less the PID following error of each axis.
+  void system_get_measured_position(int32_t *steps);
 #endif
 
 // Checks and reports if target array exceeds machine travel limits.
 uint8_t system_check_travel_limits(float *target);
 
+#ifdef REPORT_FIELD_STARVATION
+  // Adds time spent waiting for room in the planner buffer to the starvation counters.
+  void system_add_planner_wait(uint32_t us);
+#endif
+
 // Special handlers for setting and clearing Grbl's real-time execution flags.
 void system_set_exec_state_flag(uint8_t mask);
 void system_clear_exec_state_flag(uint8_t mask);
@@ -0,0 +1,304 @@
+/* This file is part of the Maslow Due Control Software.
+    The Maslow Due Control Software is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Maslow Due Control Software is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with the Maslow Control Software.  If not, see <http://www.gnu.org/licenses/>.
+
+    bench.cpp - host micro-benchmarks of the kinematics, planner, segment generator and g-code
+    parser, and the kinematics round trip checks.
+
+      maslow_bench           prints the round trip errors and the time per call of each benchmark
+      maslow_bench --check   only runs the round trip checks, and exits non-zero if one fails
+
+    Times are host ns per call, for comparing changes, not Due times. $K times the kinematics on
+    the machine itself.
+    */
+
+#include <stdio.h>
+#include "harness.h"
+
+void triangularInverse(float xTarget, float yTarget, float* aChainLength, float* bChainLength);
+void triangularForward(float chainALength, float chainBLength, float* xPos, float* yPos);
+
+// Sweep of the work area for the kinematics, with its points between the correction grid nodes.
+#define SWEEP_COLS 200
+#define SWEEP_ROWS 100
+#define SWEEP_POINTS ((SWEEP_COLS+1)*(SWEEP_ROWS+1))
+
+// Round trip checks. The forward solve stops within KINEMATICS_MAX_ERR (0.01mm) of chain length,
+// which is up to about six times that in XY at the bottom corners, and two at the top middle.
+#define ROUND_TRIP_TOLERANCE 0.1      // mm, max XY error of chain lengths back to a position.
+#define GRID_ERROR_MARGIN 0.0005      // mm, float rounding over the grid's own error bound.
+#define FORWARD_MAX_SOLVES 20         // KINEMATICS_MAX_GUESS in system.cpp, where it gives up.
+
+#define BENCH_MIN_NS 200000000ULL     // Each benchmark repeats for at least this long.
+
+static float sweep_x[SWEEP_POINTS], sweep_y[SWEEP_POINTS];
+static float sweep_a[SWEEP_POINTS], sweep_b[SWEEP_POINTS];
+
+static void sweep_init(void)
+{
+  uint32_t n = 0;
+  for (uint32_t row = 0; row <= SWEEP_ROWS; row++) {
+    for (uint32_t col = 0; col <= SWEEP_COLS; col++) {
+      sweep_x[n] = settings.machineWidth*((float)col/SWEEP_COLS - 0.5f);
+      sweep_y[n] = settings.machineHeight*((float)row/SWEEP_ROWS - 0.5f);
+      triangularInverse(sweep_x[n], sweep_y[n], &sweep_a[n], &sweep_b[n]);
+      n++;
+    }
+  }
+}
+
+// -- Round trip checks
+
+static uint8_t check_round_trip(void)
+{
+  uint8_t failed = false;
+  float max_exact = 0.0f, total_exact = 0.0f;
+  float max_trip = 0.0f, total_trip = 0.0f;
+  float max_grid = 0.0f;
+  uint8_t max_iterations = 0;
+  for (uint32_t n = 0; n < SWEEP_POINTS; n++) {
+    float x = sweep_x[n], y = sweep_y[n];
+
+    // The full inverse solve, back through the forward one, seeded from the work area center as
+    // $K does. The forward solve checks its guesses with the grid, as the planner's chains are.
+    float x_back = 0.0f, y_back = 0.0f;
+    triangularForward(sweep_a[n], sweep_b[n], &x_back, &y_back);
+    float error = hypotf(x_back - x, y_back - y);
+    max_exact = max(max_exact, error);
+    total_exact += error;
+    max_iterations = max(max_iterations, kinematics_forward_iterations);
+
+    // What the firmware uses: positionToChain(), with its grid and cache, then chainToPosition().
+    float a, b;
+    positionToChain(x, y, &a, &b);
+    max_grid = max(max_grid, max(fabsf(a - sweep_a[n]), fabsf(b - sweep_b[n])));
+    x_back = 0.0f; y_back = 0.0f;
+    chainToPosition(a, b, &x_back, &y_back);
+    error = hypotf(x_back - x, y_back - y);
+    max_trip = max(max_trip, error);
+    total_trip += error;
+    max_iterations = max(max_iterations, kinematics_forward_iterations);
+  }
+
+  printf("%-38s max %.4f mean %.4f mm\n", "round trip, triangularInverse", max_exact, total_exact/SWEEP_POINTS);
+  printf("%-38s max %.4f mean %.4f mm\n", "round trip, positionToChain", max_trip, total_trip/SWEEP_POINTS);
+  if ((max_exact > ROUND_TRIP_TOLERANCE) || (max_trip > ROUND_TRIP_TOLERANCE)) {
+    printf("FAIL: round trip error over %.4f mm\n", ROUND_TRIP_TOLERANCE);
+    failed = true;
+  }
+  #ifdef KINEMATICS_CORRECTION_GRID
+    printf("%-38s max %.4f mm, grid bound %.4f mm\n", "positionToChain chain error", max_grid, kinematics_grid_error);
+    if (max_grid > kinematics_grid_error + GRID_ERROR_MARGIN) {
+      printf("FAIL: correction grid error over its bound\n");
+      failed = true;
+    }
+  #else
+    printf("%-38s max %.4f mm\n", "positionToChain chain error", max_grid);
+  #endif
+  printf("%-38s max %d\n", "forward solves", max_iterations);
+  if (max_iterations >= FORWARD_MAX_SOLVES) {
+    printf("FAIL: forward kinematics did not converge\n");
+    failed = true;
+  }
+  return(failed);
+}
+
+// -- Benchmarks
+
+static void bench_report(const char *name, uint64_t ns, uint64_t calls)
+{
+  printf("%-38s %9.0f ns/call  (%llu calls)\n", name, (double)ns/calls, (unsigned long long)calls);
+}
+
+static void bench_inverse(void)
+{
+  uint64_t calls = 0, start = harness_ns(), ns;
+  float a, b;
+  do {
+    for (uint32_t n = 0; n < SWEEP_POINTS; n++) { triangularInverse(sweep_x[n], sweep_y[n], &a, &b); }
+    calls += SWEEP_POINTS;
+  } while ((ns = harness_ns() - start) < BENCH_MIN_NS);
+  bench_report("triangularInverse", ns, calls);
+
+  // Every target new, so the cache misses and the lookup is the grid's.
+  calls = 0; start = harness_ns();
+  do {
+    for (uint32_t n = 0; n < SWEEP_POINTS; n++) { positionToChain(sweep_x[n], sweep_y[n], &a, &b); }
+    calls += SWEEP_POINTS;
+  } while ((ns = harness_ns() - start) < BENCH_MIN_NS);
+  bench_report("positionToChain", ns, calls);
+}
+
+static void bench_forward(void)
+{
+  // Seeded from the work area center, the worst case, as $K does.
+  uint64_t calls = 0, start = harness_ns(), ns;
+  do {
+    for (uint32_t n = 0; n < SWEEP_POINTS; n++) {
+      float x = 0.0f, y = 0.0f;
+      triangularForward(sweep_a[n], sweep_b[n], &x, &y);
+    }
+    calls += SWEEP_POINTS;
+  } while ((ns = harness_ns() - start) < BENCH_MIN_NS);
+  bench_report("triangularForward, from center", ns, calls);
+
+  // Seeded from the last solution, a row of points apart, as where the motion is followed.
+  calls = 0; start = harness_ns();
+  do {
+    float x = sweep_x[0], y = sweep_y[0];
+    for (uint32_t n = 0; n < SWEEP_POINTS; n++) { triangularForward(sweep_a[n], sweep_b[n], &x, &y); }
+    calls += SWEEP_POINTS;
+  } while ((ns = harness_ns() - start) < BENCH_MIN_NS);
+  bench_report("triangularForward, from last", ns, calls);
+}
+
+// Chain lengths of a zigzag of short CAM-like moves across the middle of the work area and back,
+// as the planner sees them from mc_line(). It ends where it starts, so it repeats seamlessly.
+#define PATH_BLOCKS 1000
+#define PATH_SEGMENT 0.5f   // mm
+#define PATH_FEED 1000.0f   // mm/min
+
+static float path[PATH_BLOCKS][N_AXIS];
+
+static void path_init(void)
+{
+  float x = -0.2f*PATH_BLOCKS*PATH_SEGMENT, y = 0.0f;
+  for (uint32_t n = 0; n < PATH_BLOCKS; n++) {
+    x += (n < PATH_BLOCKS/2) ? PATH_SEGMENT*0.8f : -PATH_SEGMENT*0.8f;
+    y += (n & 1) ? PATH_SEGMENT*0.6f : -PATH_SEGMENT*0.6f;
+    positionToChain(x, y, &path[n][X_AXIS], &path[n][Y_AXIS]);
+    path[n][Z_AXIS] = 0.0f;
+  }
+}
+
+static void path_start(void)
+{
+  plan_reset();
+  st_reset();
+  memset(sys_position, 0, sizeof(sys_position));
+  float start[N_AXIS];
+  memcpy(start, path[PATH_BLOCKS-1], sizeof(start));
+  for (uint8_t idx = 0; idx < N_AXIS; idx++) { sys_position[idx] = lround(start[idx]*settings.steps_per_mm[idx]); }
+  plan_sync_position();
+}
+
+static uint8_t path_plan(uint32_t n)
+{
+  plan_line_data_t pl_data;
+  memset(&pl_data, 0, sizeof(pl_data));
+  pl_data.feed_rate = PATH_FEED;
+  return(plan_buffer_line(path[n % PATH_BLOCKS], &pl_data));
+}
+
+static void bench_planner(void)
+{
+  // Steady state: the buffer is kept full, and the oldest block is dropped for each new one, so
+  // every call replans the whole buffer as far as the planned pointer allows.
+  path_start();
+  uint32_t n = 0;
+  while (!plan_check_full_buffer()) { path_plan(n++); }
+  uint64_t calls = 0, ns = 0, start_all = harness_ns();
+  do {
+    for (uint32_t i = 0; i < PATH_BLOCKS; i++) {
+      plan_discard_current_block();
+      uint64_t start = harness_ns();
+      path_plan(n++);
+      ns += harness_ns() - start;
+    }
+    calls += PATH_BLOCKS;
+  } while (harness_ns() - start_all < BENCH_MIN_NS);
+  bench_report("plan_buffer_line, full buffer", ns, calls);
+  plan_reset();
+}
+
+static void bench_segments(void)
+{
+  // The segment generator with the stepper running on 1ms ticks from the interpolator, and the
+  // planner topped up as blocks are done. Timed over whole blocks, and the slowest call.
+  path_start();
+  uint32_t n = 0;
+  while (!plan_check_full_buffer()) { path_plan(n++); }
+  sys.state = STATE_CYCLE;
+  st_wake_up();
+  uint64_t ns = 0, max_ns = 0, calls = 0, start_all = harness_ns();
+  uint32_t first = n;
+  do {
+    uint64_t start = harness_ns();
+    st_prep_buffer();
+    uint64_t call = harness_ns() - start;
+    ns += call;
+    max_ns = max(max_ns, call);
+    calls++;
+    harness_step();
+    while (!plan_check_full_buffer()) { path_plan(n++); }
+  } while (harness_ns() - start_all < BENCH_MIN_NS);
+  uint32_t blocks = n - first;
+  st_go_idle();
+  sys.state = STATE_IDLE;
+  bench_report("st_prep_buffer, per call", ns, calls);
+  bench_report("st_prep_buffer, per block", ns, blocks);
+  printf("%-38s %9.0f ns\n", "st_prep_buffer, slowest call", (double)max_ns);
+  plan_reset();
+  st_reset();
+}
+
+static void bench_lines(void)
+{
+  // Parsed and checked, in check mode, so mc_line() returns without planning.
+  static const char *lines[] = {
+    "G1X100.125Y-200.5F1000", "X100.25Y-200.375", "X100.375Y-200.25Z-1.5", "G0X10Y10",
+    "G2X20Y10I5J0F500", "N120G1X1.234Y5.678", "G90G21G17G1X0Y0"
+  };
+  static const char *names[] = {
+    "G1 with feed", "X Y", "X Y Z", "G0", "G2", "N G1", "modal words"
+  };
+  sys.state = STATE_CHECK_MODE;
+  gc_init();
+  gc_sync_position();
+  char line[LINE_BUFFER_SIZE];
+  for (uint8_t i = 0; i < sizeof(lines)/sizeof(lines[0]); i++) {
+    uint64_t calls = 0, start = harness_ns(), ns;
+    uint8_t status = STATUS_OK;
+    do {
+      for (uint32_t n = 0; n < 1000; n++) {
+        strcpy(line, lines[i]);
+        status |= gc_execute_line(line);
+      }
+      calls += 1000;
+    } while ((ns = harness_ns() - start) < BENCH_MIN_NS);
+    char name[64];
+    snprintf(name, sizeof(name), "gc_execute_line, %s", names[i]);
+    bench_report(name, ns, calls);
+    if (status != STATUS_OK) { printf("  (error %d)\n", status); }
+  }
+  sys.state = STATE_IDLE;
+  gc_init();
+}
+
+int main(int argc, char **argv)
+{
+  uint8_t check = (argc > 1) && (strcmp(argv[1], "--check") == 0);
+  harness_boot();
+  sys.state = STATE_IDLE; // As after $X. Homing is enabled, which locks the machine at power-up.
+  sweep_init();
+
+  uint8_t failed = check_round_trip();
+  if (check) { return(failed); }
+
+  bench_inverse();
+  bench_forward();
+  path_init();
+  bench_planner();
+  bench_segments();
+  bench_lines();
+  return(failed);
+}
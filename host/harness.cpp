@@ -0,0 +1,111 @@
+/* This file is part of the Maslow Due Control Software.
+    The Maslow Due Control Software is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Maslow Due Control Software is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with the Maslow Control Software.  If not, see <http://www.gnu.org/licenses/>.
+
+    harness.cpp - boots the firmware on the host, for the benchmark and test programs.
+    */
+
+#include <signal.h>
+#include <sys/time.h>
+#include <time.h>
+#include "harness.h"
+
+void setup(void);
+void serialScanner_handler(void);
+
+#define OUTPUT_SIZE 65536
+static char output[OUTPUT_SIZE];
+static volatile uint32_t output_length;
+
+static void output_sink(uint8_t c)
+{
+  if (output_length < OUTPUT_SIZE-1) { output[output_length++] = c; }
+}
+
+const char *harness_output(void)
+{
+  output[output_length] = 0;
+  return(output);
+}
+
+void harness_output_clear(void) { output_length = 0; }
+
+// The serial scanner, as the SERIAL_TIMER interrupt. Held while interrupts are masked, and taken
+// when they are unmasked.
+static volatile uint8_t serial_pending;
+
+static void serial_service(void)
+{
+  for (int i = 0; i < HOST_TIMERS; i++) {
+    if ((host_timers[i].handler == serialScanner_handler) && host_timers[i].running) {
+      host_irq_masked = true;
+      serialScanner_handler();
+      host_irq_masked = false;
+    }
+  }
+}
+
+static void serial_signal(int)
+{
+  if (host_irq_masked) { serial_pending = true; return; }
+  serial_pending = false;
+  serial_service();
+}
+
+static void serial_unmask(void)
+{
+  if (serial_pending) {
+    serial_pending = false;
+    serial_service();
+  }
+}
+
+void harness_boot(void)
+{
+  host_serial_sink = output_sink;
+  host_eeprom_attach(SDApin, SCLpin);
+  host_skip_delays = true;
+  host_irq_unmask_hook = serial_unmask;
+
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = serial_signal;
+  action.sa_flags = SA_RESTART;
+  sigaction(SIGALRM, &action, NULL);
+  struct itimerval period;
+  period.it_interval.tv_sec = 0;
+  period.it_interval.tv_usec = Serial_PERIOD;
+  period.it_value = period.it_interval;
+  setitimer(ITIMER_REAL, &period, NULL);
+
+  setup();
+
+  #ifdef KINEMATICS_CORRECTION_GRID
+    while (kinematicsGridService(UINT16_MAX)) { }
+  #endif
+}
+
+void harness_step(void)
+{
+  if (host_timers[4].handler == NULL) { return; }
+  host_irq_masked = true;
+  host_timers[4].handler();
+  host_irq_masked = false;
+  serial_unmask();
+}
+
+uint64_t harness_ns(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return((uint64_t)now.tv_sec*1000000000ULL + now.tv_nsec);
+}
@@ -0,0 +1,39 @@
+/* This file is part of the Maslow Due Control Software.
+    The Maslow Due Control Software is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Maslow Due Control Software is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with the Maslow Control Software.  If not, see <http://www.gnu.org/licenses/>.
+
+    harness.h - boots the firmware on the host, for the benchmark and test programs.
+    */
+
+#ifndef harness_h
+#define harness_h
+
+#include "grbl.h"
+#include "host_shim.h"
+
+// Runs setup() as at power-up, with an erased EEPROM, so the settings are the defaults, and builds
+// the kinematics correction grid. Output is captured (harness_output()). The serial scanner is run
+// every SERIAL_PERIOD of host time from a signal, as Timer6 would, so the firmware's prints drain.
+// No other timer runs: the programs call the firmware directly, and step it with harness_step().
+void harness_boot(void);
+
+// Firmware output since boot or the last harness_output_clear(), as text.
+const char *harness_output(void);
+void harness_output_clear(void);
+
+// Runs one step interpolator tick (timer4_handler) with interrupts masked, as the NVIC would.
+void harness_step(void);
+
+// Host time in ns, from the monotonic clock.
+uint64_t harness_ns(void);
+
+#endif
@@ -0,0 +1,3079 @@
+(Example job for maslow_sim, in the shape of CAM output: a pocket,)
+(a profile in arcs, and curves tessellated into short lines.)
+G21 G90 G17 G94
+M3 S12000
+G0 Z5.000
+(Pocket, 120 x 80 mm, 3 mm deep)
+G0 X-310.000 Y-140.000
+G1 Z-3.000 F200
+G1 F800
+X-190.000
+Y-134.000
+X-310.000
+Y-128.000
+X-190.000
+Y-122.000
+X-310.000
+Y-116.000
+X-190.000
+Y-110.000
+X-310.000
+Y-104.000
+X-190.000
+Y-98.000
+X-310.000
+Y-92.000
+X-190.000
+Y-86.000
+X-310.000
+Y-80.000
+X-190.000
+Y-74.000
+X-310.000
+Y-68.000
+X-190.000
+Y-62.000
+X-310.000
+X-190.000 Y-60.000
+X-310.000
+Y-140.000
+X-190.000
+Y-60.000
+G0 Z5.000
+(Profile, 80 mm circle, two passes)
+G0 X160.000 Y100.000
+G1 Z-2.000 F200
+G2 X200.000 Y140.000 I40.000 J0.000 F800
+G2 X240.000 Y100.000 I0.000 J-40.000 F800
+G2 X200.000 Y60.000 I-40.000 J0.000 F800
+G2 X160.000 Y100.000 I0.000 J40.000 F800
+G1 Z-4.000 F200
+G2 X200.000 Y140.000 I40.000 J0.000 F800
+G2 X240.000 Y100.000 I0.000 J-40.000 F800
+G2 X200.000 Y60.000 I-40.000 J0.000 F800
+G2 X160.000 Y100.000 I0.000 J40.000 F800
+G0 Z5.000
+(Engrave, 300 x 160 mm ellipse in 0.5 mm lines)
+G0 X150.000 Y250.000
+G1 Z-1.000 F200
+G1 F800
+X149.999 Y250.333
+X149.995 Y250.666
+X149.988 Y250.999
+X149.979 Y251.331
+X149.968 Y251.664
+X149.953 Y251.997
+X149.936 Y252.330
+X149.917 Y252.663
+X149.895 Y252.995
+X149.870 Y253.328
+X149.843 Y253.660
+X149.813 Y253.993
+X149.781 Y254.325
+X149.746 Y254.658
+X149.708 Y254.990
+X149.668 Y255.322
+X149.625 Y255.654
+X149.579 Y255.986
+X149.531 Y256.318
+X149.481 Y256.650
+X149.428 Y256.982
+X149.372 Y257.313
+X149.314 Y257.645
+X149.253 Y257.976
+X149.189 Y258.307
+X149.123 Y258.638
+X149.054 Y258.969
+X148.983 Y259.300
+X148.909 Y259.630
+X148.833 Y259.961
+X148.754 Y260.291
+X148.672 Y260.621
+X148.588 Y260.951
+X148.501 Y261.280
+X148.412 Y261.610
+X148.320 Y261.939
+X148.226 Y262.268
+X148.129 Y262.597
+X148.029 Y262.926
+X147.927 Y263.254
+X147.822 Y263.582
+X147.715 Y263.910
+X147.605 Y264.238
+X147.493 Y264.565
+X147.378 Y264.892
+X147.261 Y265.219
+X147.141 Y265.546
+X147.018 Y265.872
+X146.893 Y266.199
+X146.765 Y266.524
+X146.635 Y266.850
+X146.502 Y267.175
+X146.367 Y267.500
+X146.229 Y267.825
+X146.089 Y268.149
+X145.946 Y268.473
+X145.801 Y268.797
+X145.653 Y269.120
+X145.502 Y269.443
+X145.349 Y269.766
+X145.194 Y270.089
+X145.036 Y270.411
+X144.875 Y270.732
+X144.712 Y271.054
+X144.547 Y271.375
+X144.379 Y271.695
+X144.208 Y272.015
+X144.035 Y272.335
+X143.860 Y272.655
+X143.682 Y272.974
+X143.501 Y273.292
+X143.318 Y273.611
+X143.133 Y273.929
+X142.945 Y274.246
+X142.755 Y274.563
+X142.562 Y274.880
+X142.366 Y275.196
+X142.169 Y275.511
+X141.968 Y275.827
+X141.766 Y276.142
+X141.560 Y276.456
+X141.353 Y276.770
+X141.143 Y277.083
+X140.930 Y277.396
+X140.715 Y277.709
+X140.498 Y278.021
+X140.278 Y278.332
+X140.056 Y278.644
+X139.831 Y278.954
+X139.604 Y279.264
+X139.374 Y279.574
+X139.142 Y279.883
+X138.908 Y280.191
+X138.671 Y280.499
+X138.432 Y280.807
+X138.191 Y281.114
+X137.947 Y281.420
+X137.700 Y281.726
+X137.452 Y282.031
+X137.201 Y282.336
+X136.947 Y282.640
+X136.691 Y282.944
+X136.433 Y283.247
+X136.172 Y283.549
+X135.910 Y283.851
+X135.644 Y284.153
+X135.377 Y284.453
+X135.107 Y284.754
+X134.834 Y285.053
+X134.560 Y285.352
+X134.283 Y285.650
+X134.003 Y285.948
+X133.722 Y286.245
+X133.438 Y286.542
+X133.152 Y286.837
+X132.863 Y287.132
+X132.572 Y287.427
+X132.279 Y287.721
+X131.984 Y288.014
+X131.686 Y288.307
+X131.386 Y288.599
+X131.084 Y288.890
+X130.779 Y289.180
+X130.472 Y289.470
+X130.163 Y289.760
+X129.852 Y290.048
+X129.538 Y290.336
+X129.222 Y290.623
+X128.904 Y290.909
+X128.584 Y291.195
+X128.262 Y291.480
+X127.937 Y291.764
+X127.610 Y292.048
+X127.281 Y292.331
+X126.949 Y292.613
+X126.616 Y292.894
+X126.280 Y293.175
+X125.942 Y293.455
+X125.602 Y293.734
+X125.260 Y294.012
+X124.915 Y294.290
+X124.569 Y294.567
+X124.220 Y294.843
+X123.869 Y295.118
+X123.516 Y295.392
+X123.161 Y295.666
+X122.803 Y295.939
+X122.444 Y296.211
+X122.082 Y296.483
+X121.718 Y296.753
+X121.353 Y297.023
+X120.985 Y297.292
+X120.615 Y297.560
+X120.243 Y297.827
+X119.868 Y298.093
+X119.492 Y298.359
+X119.114 Y298.624
+X118.733 Y298.888
+X118.351 Y299.151
+X117.966 Y299.413
+X117.580 Y299.674
+X117.191 Y299.935
+X116.801 Y300.195
+X116.408 Y300.453
+X116.013 Y300.711
+X115.617 Y300.968
+X115.218 Y301.224
+X114.817 Y301.480
+X114.415 Y301.734
+X114.010 Y301.987
+X113.604 Y302.240
+X113.195 Y302.492
+X112.785 Y302.742
+X112.372 Y302.992
+X111.958 Y303.241
+X111.541 Y303.489
+X111.123 Y303.736
+X110.703 Y303.982
+X110.281 Y304.228
+X109.857 Y304.472
+X109.431 Y304.715
+X109.003 Y304.958
+X108.573 Y305.199
+X108.142 Y305.439
+X107.708 Y305.679
+X107.273 Y305.918
+X106.836 Y306.155
+X106.397 Y306.392
+X105.956 Y306.627
+X105.513 Y306.862
+X105.068 Y307.096
+X104.622 Y307.328
+X104.174 Y307.560
+X103.724 Y307.791
+X103.272 Y308.020
+X102.818 Y308.249
+X102.363 Y308.477
+X101.906 Y308.703
+X101.447 Y308.929
+X100.986 Y309.154
+X100.524 Y309.377
+X100.060 Y309.600
+X99.594 Y309.821
+X99.127 Y310.042
+X98.657 Y310.261
+X98.186 Y310.480
+X97.714 Y310.697
+X97.239 Y310.913
+X96.763 Y311.129
+X96.285 Y311.343
+X95.806 Y311.556
+X95.325 Y311.768
+X94.842 Y311.979
+X94.358 Y312.189
+X93.872 Y312.398
+X93.384 Y312.606
+X92.895 Y312.812
+X92.404 Y313.018
+X91.911 Y313.223
+X91.417 Y313.426
+X90.922 Y313.628
+X90.424 Y313.830
+X89.926 Y314.030
+X89.425 Y314.229
+X88.923 Y314.427
+X88.420 Y314.623
+X87.915 Y314.819
+X87.409 Y315.014
+X86.901 Y315.207
+X86.391 Y315.399
+X85.880 Y315.590
+X85.368 Y315.780
+X84.854 Y315.969
+X84.338 Y316.157
+X83.821 Y316.344
+X83.303 Y316.529
+X82.783 Y316.713
+X82.262 Y316.897
+X81.739 Y317.079
+X81.215 Y317.259
+X80.690 Y317.439
+X80.163 Y317.617
+X79.635 Y317.795
+X79.105 Y317.971
+X78.574 Y318.146
+X78.042 Y318.320
+X77.508 Y318.492
+X76.973 Y318.664
+X76.437 Y318.834
+X75.899 Y319.003
+X75.360 Y319.171
+X74.820 Y319.337
+X74.278 Y319.503
+X73.735 Y319.667
+X73.191 Y319.830
+X72.646 Y319.992
+X72.099 Y320.153
+X71.551 Y320.312
+X71.002 Y320.470
+X70.451 Y320.627
+X69.900 Y320.783
+X69.347 Y320.937
+X68.793 Y321.091
+X68.238 Y321.243
+X67.681 Y321.394
+X67.124 Y321.543
+X66.565 Y321.691
+X66.005 Y321.839
+X65.444 Y321.984
+X64.882 Y322.129
+X64.318 Y322.272
+X63.754 Y322.414
+X63.188 Y322.555
+X62.622 Y322.695
+X62.054 Y322.833
+X61.485 Y322.970
+X60.915 Y323.106
+X60.345 Y323.241
+X59.773 Y323.374
+X59.200 Y323.506
+X58.626 Y323.637
+X58.051 Y323.766
+X57.475 Y323.894
+X56.898 Y324.021
+X56.320 Y324.147
+X55.741 Y324.271
+X55.161 Y324.394
+X54.580 Y324.516
+X53.998 Y324.637
+X53.415 Y324.756
+X52.831 Y324.874
+X52.247 Y324.990
+X51.661 Y325.106
+X51.075 Y325.220
+X50.488 Y325.332
+X49.899 Y325.444
+X49.310 Y325.554
+X48.720 Y325.663
+X48.130 Y325.770
+X47.538 Y325.876
+X46.946 Y325.981
+X46.353 Y326.085
+X45.759 Y326.187
+X45.164 Y326.288
+X44.568 Y326.387
+X43.972 Y326.485
+X43.375 Y326.582
+X42.777 Y326.678
+X42.178 Y326.772
+X41.579 Y326.865
+X40.979 Y326.957
+X40.378 Y327.047
+X39.777 Y327.136
+X39.174 Y327.224
+X38.572 Y327.310
+X37.968 Y327.395
+X37.364 Y327.478
+X36.759 Y327.561
+X36.154 Y327.642
+X35.548 Y327.721
+X34.941 Y327.799
+X34.334 Y327.876
+X33.726 Y327.952
+X33.117 Y328.026
+X32.508 Y328.099
+X31.899 Y328.170
+X31.288 Y328.240
+X30.678 Y328.309
+X30.067 Y328.376
+X29.455 Y328.442
+X28.843 Y328.507
+X28.230 Y328.570
+X27.617 Y328.632
+X27.003 Y328.693
+X26.389 Y328.752
+X25.774 Y328.810
+X25.159 Y328.867
+X24.543 Y328.922
+X23.927 Y328.976
+X23.311 Y329.028
+X22.694 Y329.079
+X22.077 Y329.129
+X21.460 Y329.177
+X20.842 Y329.224
+X20.223 Y329.270
+X19.605 Y329.314
+X18.986 Y329.357
+X18.366 Y329.398
+X17.747 Y329.438
+X17.127 Y329.477
+X16.507 Y329.514
+X15.886 Y329.550
+X15.265 Y329.585
+X14.644 Y329.618
+X14.023 Y329.650
+X13.401 Y329.680
+X12.780 Y329.709
+X12.158 Y329.737
+X11.536 Y329.763
+X10.913 Y329.788
+X10.291 Y329.812
+X9.668 Y329.834
+X9.045 Y329.854
+X8.422 Y329.874
+X7.798 Y329.892
+X7.175 Y329.908
+X6.552 Y329.924
+X5.928 Y329.938
+X5.304 Y329.950
+X4.680 Y329.961
+X4.057 Y329.971
+X3.433 Y329.979
+X2.809 Y329.986
+X2.184 Y329.992
+X1.560 Y329.996
+X0.936 Y329.998
+X0.312 Y330.000
+X-0.312 Y330.000
+X-0.936 Y329.998
+X-1.560 Y329.996
+X-2.184 Y329.992
+X-2.809 Y329.986
+X-3.433 Y329.979
+X-4.057 Y329.971
+X-4.680 Y329.961
+X-5.304 Y329.950
+X-5.928 Y329.938
+X-6.552 Y329.924
+X-7.175 Y329.908
+X-7.798 Y329.892
+X-8.422 Y329.874
+X-9.045 Y329.854
+X-9.668 Y329.834
+X-10.291 Y329.812
+X-10.913 Y329.788
+X-11.536 Y329.763
+X-12.158 Y329.737
+X-12.780 Y329.709
+X-13.401 Y329.680
+X-14.023 Y329.650
+X-14.644 Y329.618
+X-15.265 Y329.585
+X-15.886 Y329.550
+X-16.507 Y329.514
+X-17.127 Y329.477
+X-17.747 Y329.438
+X-18.366 Y329.398
+X-18.986 Y329.357
+X-19.605 Y329.314
+X-20.223 Y329.270
+X-20.842 Y329.224
+X-21.460 Y329.177
+X-22.077 Y329.129
+X-22.694 Y329.079
+X-23.311 Y329.028
+X-23.927 Y328.976
+X-24.543 Y328.922
+X-25.159 Y328.867
+X-25.774 Y328.810
+X-26.389 Y328.752
+X-27.003 Y328.693
+X-27.617 Y328.632
+X-28.230 Y328.570
+X-28.843 Y328.507
+X-29.455 Y328.442
+X-30.067 Y328.376
+X-30.678 Y328.309
+X-31.288 Y328.240
+X-31.899 Y328.170
+X-32.508 Y328.099
+X-33.117 Y328.026
+X-33.726 Y327.952
+X-34.334 Y327.876
+X-34.941 Y327.799
+X-35.548 Y327.721
+X-36.154 Y327.642
+X-36.759 Y327.561
+X-37.364 Y327.478
+X-37.968 Y327.395
+X-38.572 Y327.310
+X-39.174 Y327.224
+X-39.777 Y327.136
+X-40.378 Y327.047
+X-40.979 Y326.957
+X-41.579 Y326.865
+X-42.178 Y326.772
+X-42.777 Y326.678
+X-43.375 Y326.582
+X-43.972 Y326.485
+X-44.568 Y326.387
+X-45.164 Y326.288
+X-45.759 Y326.187
+X-46.353 Y326.085
+X-46.946 Y325.981
+X-47.538 Y325.876
+X-48.130 Y325.770
+X-48.720 Y325.663
+X-49.310 Y325.554
+X-49.899 Y325.444
+X-50.488 Y325.332
+X-51.075 Y325.220
+X-51.661 Y325.106
+X-52.247 Y324.990
+X-52.831 Y324.874
+X-53.415 Y324.756
+X-53.998 Y324.637
+X-54.580 Y324.516
+X-55.161 Y324.394
+X-55.741 Y324.271
+X-56.320 Y324.147
+X-56.898 Y324.021
+X-57.475 Y323.894
+X-58.051 Y323.766
+X-58.626 Y323.637
+X-59.200 Y323.506
+X-59.773 Y323.374
+X-60.345 Y323.241
+X-60.915 Y323.106
+X-61.485 Y322.970
+X-62.054 Y322.833
+X-62.622 Y322.695
+X-63.188 Y322.555
+X-63.754 Y322.414
+X-64.318 Y322.272
+X-64.882 Y322.129
+X-65.444 Y321.984
+X-66.005 Y321.839
+X-66.565 Y321.691
+X-67.124 Y321.543
+X-67.681 Y321.394
+X-68.238 Y321.243
+X-68.793 Y321.091
+X-69.347 Y320.937
+X-69.900 Y320.783
+X-70.451 Y320.627
+X-71.002 Y320.470
+X-71.551 Y320.312
+X-72.099 Y320.153
+X-72.646 Y319.992
+X-73.191 Y319.830
+X-73.735 Y319.667
+X-74.278 Y319.503
+X-74.820 Y319.337
+X-75.360 Y319.171
+X-75.899 Y319.003
+X-76.437 Y318.834
+X-76.973 Y318.664
+X-77.508 Y318.492
+X-78.042 Y318.320
+X-78.574 Y318.146
+X-79.105 Y317.971
+X-79.635 Y317.795
+X-80.163 Y317.617
+X-80.690 Y317.439
+X-81.215 Y317.259
+X-81.739 Y317.079
+X-82.262 Y316.897
+X-82.783 Y316.713
+X-83.303 Y316.529
+X-83.821 Y316.344
+X-84.338 Y316.157
+X-84.854 Y315.969
+X-85.368 Y315.780
+X-85.880 Y315.590
+X-86.391 Y315.399
+X-86.901 Y315.207
+X-87.409 Y315.014
+X-87.915 Y314.819
+X-88.420 Y314.623
+X-88.923 Y314.427
+X-89.425 Y314.229
+X-89.926 Y314.030
+X-90.424 Y313.830
+X-90.922 Y313.628
+X-91.417 Y313.426
+X-91.911 Y313.223
+X-92.404 Y313.018
+X-92.895 Y312.812
+X-93.384 Y312.606
+X-93.872 Y312.398
+X-94.358 Y312.189
+X-94.842 Y311.979
+X-95.325 Y311.768
+X-95.806 Y311.556
+X-96.285 Y311.343
+X-96.763 Y311.129
+X-97.239 Y310.913
+X-97.714 Y310.697
+X-98.186 Y310.480
+X-98.657 Y310.261
+X-99.127 Y310.042
+X-99.594 Y309.821
+X-100.060 Y309.600
+X-100.524 Y309.377
+X-100.986 Y309.154
+X-101.447 Y308.929
+X-101.906 Y308.703
+X-102.363 Y308.477
+X-102.818 Y308.249
+X-103.272 Y308.020
+X-103.724 Y307.791
+X-104.174 Y307.560
+X-104.622 Y307.328
+X-105.068 Y307.096
+X-105.513 Y306.862
+X-105.956 Y306.627
+X-106.397 Y306.392
+X-106.836 Y306.155
+X-107.273 Y305.918
+X-107.708 Y305.679
+X-108.142 Y305.439
+X-108.573 Y305.199
+X-109.003 Y304.958
+X-109.431 Y304.715
+X-109.857 Y304.472
+X-110.281 Y304.228
+X-110.703 Y303.982
+X-111.123 Y303.736
+X-111.541 Y303.489
+X-111.958 Y303.241
+X-112.372 Y302.992
+X-112.785 Y302.742
+X-113.195 Y302.492
+X-113.604 Y302.240
+X-114.010 Y301.987
+X-114.415 Y301.734
+X-114.817 Y301.480
+X-115.218 Y301.224
+X-115.617 Y300.968
+X-116.013 Y300.711
+X-116.408 Y300.453
+X-116.801 Y300.195
+X-117.191 Y299.935
+X-117.580 Y299.674
+X-117.966 Y299.413
+X-118.351 Y299.151
+X-118.733 Y298.888
+X-119.114 Y298.624
+X-119.492 Y298.359
+X-119.868 Y298.093
+X-120.243 Y297.827
+X-120.615 Y297.560
+X-120.985 Y297.292
+X-121.353 Y297.023
+X-121.718 Y296.753
+X-122.082 Y296.483
+X-122.444 Y296.211
+X-122.803 Y295.939
+X-123.161 Y295.666
+X-123.516 Y295.392
+X-123.869 Y295.118
+X-124.220 Y294.843
+X-124.569 Y294.567
+X-124.915 Y294.290
+X-125.260 Y294.012
+X-125.602 Y293.734
+X-125.942 Y293.455
+X-126.280 Y293.175
+X-126.616 Y292.894
+X-126.949 Y292.613
+X-127.281 Y292.331
+X-127.610 Y292.048
+X-127.937 Y291.764
+X-128.262 Y291.480
+X-128.584 Y291.195
+X-128.904 Y290.909
+X-129.222 Y290.623
+X-129.538 Y290.336
+X-129.852 Y290.048
+X-130.163 Y289.760
+X-130.472 Y289.470
+X-130.779 Y289.180
+X-131.084 Y288.890
+X-131.386 Y288.599
+X-131.686 Y288.307
+X-131.984 Y288.014
+X-132.279 Y287.721
+X-132.572 Y287.427
+X-132.863 Y287.132
+X-133.152 Y286.837
+X-133.438 Y286.542
+X-133.722 Y286.245
+X-134.003 Y285.948
+X-134.283 Y285.650
+X-134.560 Y285.352
+X-134.834 Y285.053
+X-135.107 Y284.754
+X-135.377 Y284.453
+X-135.644 Y284.153
+X-135.910 Y283.851
+X-136.172 Y283.549
+X-136.433 Y283.247
+X-136.691 Y282.944
+X-136.947 Y282.640
+X-137.201 Y282.336
+X-137.452 Y282.031
+X-137.700 Y281.726
+X-137.947 Y281.420
+X-138.191 Y281.114
+X-138.432 Y280.807
+X-138.671 Y280.499
+X-138.908 Y280.191
+X-139.142 Y279.883
+X-139.374 Y279.574
+X-139.604 Y279.264
+X-139.831 Y278.954
+X-140.056 Y278.644
+X-140.278 Y278.332
+X-140.498 Y278.021
+X-140.715 Y277.709
+X-140.930 Y277.396
+X-141.143 Y277.083
+X-141.353 Y276.770
+X-141.560 Y276.456
+X-141.766 Y276.142
+X-141.968 Y275.827
+X-142.169 Y275.511
+X-142.366 Y275.196
+X-142.562 Y274.880
+X-142.755 Y274.563
+X-142.945 Y274.246
+X-143.133 Y273.929
+X-143.318 Y273.611
+X-143.501 Y273.292
+X-143.682 Y272.974
+X-143.860 Y272.655
+X-144.035 Y272.335
+X-144.208 Y272.015
+X-144.379 Y271.695
+X-144.547 Y271.375
+X-144.712 Y271.054
+X-144.875 Y270.732
+X-145.036 Y270.411
+X-145.194 Y270.089
+X-145.349 Y269.766
+X-145.502 Y269.443
+X-145.653 Y269.120
+X-145.801 Y268.797
+X-145.946 Y268.473
+X-146.089 Y268.149
+X-146.229 Y267.825
+X-146.367 Y267.500
+X-146.502 Y267.175
+X-146.635 Y266.850
+X-146.765 Y266.524
+X-146.893 Y266.199
+X-147.018 Y265.872
+X-147.141 Y265.546
+X-147.261 Y265.219
+X-147.378 Y264.892
+X-147.493 Y264.565
+X-147.605 Y264.238
+X-147.715 Y263.910
+X-147.822 Y263.582
+X-147.927 Y263.254
+X-148.029 Y262.926
+X-148.129 Y262.597
+X-148.226 Y262.268
+X-148.320 Y261.939
+X-148.412 Y261.610
+X-148.501 Y261.280
+X-148.588 Y260.951
+X-148.672 Y260.621
+X-148.754 Y260.291
+X-148.833 Y259.961
+X-148.909 Y259.630
+X-148.983 Y259.300
+X-149.054 Y258.969
+X-149.123 Y258.638
+X-149.189 Y258.307
+X-149.253 Y257.976
+X-149.314 Y257.645
+X-149.372 Y257.313
+X-149.428 Y256.982
+X-149.481 Y256.650
+X-149.531 Y256.318
+X-149.579 Y255.986
+X-149.625 Y255.654
+X-149.668 Y255.322
+X-149.708 Y254.990
+X-149.746 Y254.658
+X-149.781 Y254.325
+X-149.813 Y253.993
+X-149.843 Y253.660
+X-149.870 Y253.328
+X-149.895 Y252.995
+X-149.917 Y252.663
+X-149.936 Y252.330
+X-149.953 Y251.997
+X-149.968 Y251.664
+X-149.979 Y251.331
+X-149.988 Y250.999
+X-149.995 Y250.666
+X-149.999 Y250.333
+X-150.000 Y250.000
+X-149.999 Y249.667
+X-149.995 Y249.334
+X-149.988 Y249.001
+X-149.979 Y248.669
+X-149.968 Y248.336
+X-149.953 Y248.003
+X-149.936 Y247.670
+X-149.917 Y247.337
+X-149.895 Y247.005
+X-149.870 Y246.672
+X-149.843 Y246.340
+X-149.813 Y246.007
+X-149.781 Y245.675
+X-149.746 Y245.342
+X-149.708 Y245.010
+X-149.668 Y244.678
+X-149.625 Y244.346
+X-149.579 Y244.014
+X-149.531 Y243.682
+X-149.481 Y243.350
+X-149.428 Y243.018
+X-149.372 Y242.687
+X-149.314 Y242.355
+X-149.253 Y242.024
+X-149.189 Y241.693
+X-149.123 Y241.362
+X-149.054 Y241.031
+X-148.983 Y240.700
+X-148.909 Y240.370
+X-148.833 Y240.039
+X-148.754 Y239.709
+X-148.672 Y239.379
+X-148.588 Y239.049
+X-148.501 Y238.720
+X-148.412 Y238.390
+X-148.320 Y238.061
+X-148.226 Y237.732
+X-148.129 Y237.403
+X-148.029 Y237.074
+X-147.927 Y236.746
+X-147.822 Y236.418
+X-147.715 Y236.090
+X-147.605 Y235.762
+X-147.493 Y235.435
+X-147.378 Y235.108
+X-147.261 Y234.781
+X-147.141 Y234.454
+X-147.018 Y234.128
+X-146.893 Y233.801
+X-146.765 Y233.476
+X-146.635 Y233.150
+X-146.502 Y232.825
+X-146.367 Y232.500
+X-146.229 Y232.175
+X-146.089 Y231.851
+X-145.946 Y231.527
+X-145.801 Y231.203
+X-145.653 Y230.880
+X-145.502 Y230.557
+X-145.349 Y230.234
+X-145.194 Y229.911
+X-145.036 Y229.589
+X-144.875 Y229.268
+X-144.712 Y228.946
+X-144.547 Y228.625
+X-144.379 Y228.305
+X-144.208 Y227.985
+X-144.035 Y227.665
+X-143.860 Y227.345
+X-143.682 Y227.026
+X-143.501 Y226.708
+X-143.318 Y226.389
+X-143.133 Y226.071
+X-142.945 Y225.754
+X-142.755 Y225.437
+X-142.562 Y225.120
+X-142.366 Y224.804
+X-142.169 Y224.489
+X-141.968 Y224.173
+X-141.766 Y223.858
+X-141.560 Y223.544
+X-141.353 Y223.230
+X-141.143 Y222.917
+X-140.930 Y222.604
+X-140.715 Y222.291
+X-140.498 Y221.979
+X-140.278 Y221.668
+X-140.056 Y221.356
+X-139.831 Y221.046
+X-139.604 Y220.736
+X-139.374 Y220.426
+X-139.142 Y220.117
+X-138.908 Y219.809
+X-138.671 Y219.501
+X-138.432 Y219.193
+X-138.191 Y218.886
+X-137.947 Y218.580
+X-137.700 Y218.274
+X-137.452 Y217.969
+X-137.201 Y217.664
+X-136.947 Y217.360
+X-136.691 Y217.056
+X-136.433 Y216.753
+X-136.172 Y216.451
+X-135.910 Y216.149
+X-135.644 Y215.847
+X-135.377 Y215.547
+X-135.107 Y215.246
+X-134.834 Y214.947
+X-134.560 Y214.648
+X-134.283 Y214.350
+X-134.003 Y214.052
+X-133.722 Y213.755
+X-133.438 Y213.458
+X-133.152 Y213.163
+X-132.863 Y212.868
+X-132.572 Y212.573
+X-132.279 Y212.279
+X-131.984 Y211.986
+X-131.686 Y211.693
+X-131.386 Y211.401
+X-131.084 Y211.110
+X-130.779 Y210.820
+X-130.472 Y210.530
+X-130.163 Y210.240
+X-129.852 Y209.952
+X-129.538 Y209.664
+X-129.222 Y209.377
+X-128.904 Y209.091
+X-128.584 Y208.805
+X-128.262 Y208.520
+X-127.937 Y208.236
+X-127.610 Y207.952
+X-127.281 Y207.669
+X-126.949 Y207.387
+X-126.616 Y207.106
+X-126.280 Y206.825
+X-125.942 Y206.545
+X-125.602 Y206.266
+X-125.260 Y205.988
+X-124.915 Y205.710
+X-124.569 Y205.433
+X-124.220 Y205.157
+X-123.869 Y204.882
+X-123.516 Y204.608
+X-123.161 Y204.334
+X-122.803 Y204.061
+X-122.444 Y203.789
+X-122.082 Y203.517
+X-121.718 Y203.247
+X-121.353 Y202.977
+X-120.985 Y202.708
+X-120.615 Y202.440
+X-120.243 Y202.173
+X-119.868 Y201.907
+X-119.492 Y201.641
+X-119.114 Y201.376
+X-118.733 Y201.112
+X-118.351 Y200.849
+X-117.966 Y200.587
+X-117.580 Y200.326
+X-117.191 Y200.065
+X-116.801 Y199.805
+X-116.408 Y199.547
+X-116.013 Y199.289
+X-115.617 Y199.032
+X-115.218 Y198.776
+X-114.817 Y198.520
+X-114.415 Y198.266
+X-114.010 Y198.013
+X-113.604 Y197.760
+X-113.195 Y197.508
+X-112.785 Y197.258
+X-112.372 Y197.008
+X-111.958 Y196.759
+X-111.541 Y196.511
+X-111.123 Y196.264
+X-110.703 Y196.018
+X-110.281 Y195.772
+X-109.857 Y195.528
+X-109.431 Y195.285
+X-109.003 Y195.042
+X-108.573 Y194.801
+X-108.142 Y194.561
+X-107.708 Y194.321
+X-107.273 Y194.082
+X-106.836 Y193.845
+X-106.397 Y193.608
+X-105.956 Y193.373
+X-105.513 Y193.138
+X-105.068 Y192.904
+X-104.622 Y192.672
+X-104.174 Y192.440
+X-103.724 Y192.209
+X-103.272 Y191.980
+X-102.818 Y191.751
+X-102.363 Y191.523
+X-101.906 Y191.297
+X-101.447 Y191.071
+X-100.986 Y190.846
+X-100.524 Y190.623
+X-100.060 Y190.400
+X-99.594 Y190.179
+X-99.127 Y189.958
+X-98.657 Y189.739
+X-98.186 Y189.520
+X-97.714 Y189.303
+X-97.239 Y189.087
+X-96.763 Y188.871
+X-96.285 Y188.657
+X-95.806 Y188.444
+X-95.325 Y188.232
+X-94.842 Y188.021
+X-94.358 Y187.811
+X-93.872 Y187.602
+X-93.384 Y187.394
+X-92.895 Y187.188
+X-92.404 Y186.982
+X-91.911 Y186.777
+X-91.417 Y186.574
+X-90.922 Y186.372
+X-90.424 Y186.170
+X-89.926 Y185.970
+X-89.425 Y185.771
+X-88.923 Y185.573
+X-88.420 Y185.377
+X-87.915 Y185.181
+X-87.409 Y184.986
+X-86.901 Y184.793
+X-86.391 Y184.601
+X-85.880 Y184.410
+X-85.368 Y184.220
+X-84.854 Y184.031
+X-84.338 Y183.843
+X-83.821 Y183.656
+X-83.303 Y183.471
+X-82.783 Y183.287
+X-82.262 Y183.103
+X-81.739 Y182.921
+X-81.215 Y182.741
+X-80.690 Y182.561
+X-80.163 Y182.383
+X-79.635 Y182.205
+X-79.105 Y182.029
+X-78.574 Y181.854
+X-78.042 Y181.680
+X-77.508 Y181.508
+X-76.973 Y181.336
+X-76.437 Y181.166
+X-75.899 Y180.997
+X-75.360 Y180.829
+X-74.820 Y180.663
+X-74.278 Y180.497
+X-73.735 Y180.333
+X-73.191 Y180.170
+X-72.646 Y180.008
+X-72.099 Y179.847
+X-71.551 Y179.688
+X-71.002 Y179.530
+X-70.451 Y179.373
+X-69.900 Y179.217
+X-69.347 Y179.063
+X-68.793 Y178.909
+X-68.238 Y178.757
+X-67.681 Y178.606
+X-67.124 Y178.457
+X-66.565 Y178.309
+X-66.005 Y178.161
+X-65.444 Y178.016
+X-64.882 Y177.871
+X-64.318 Y177.728
+X-63.754 Y177.586
+X-63.188 Y177.445
+X-62.622 Y177.305
+X-62.054 Y177.167
+X-61.485 Y177.030
+X-60.915 Y176.894
+X-60.345 Y176.759
+X-59.773 Y176.626
+X-59.200 Y176.494
+X-58.626 Y176.363
+X-58.051 Y176.234
+X-57.475 Y176.106
+X-56.898 Y175.979
+X-56.320 Y175.853
+X-55.741 Y175.729
+X-55.161 Y175.606
+X-54.580 Y175.484
+X-53.998 Y175.363
+X-53.415 Y175.244
+X-52.831 Y175.126
+X-52.247 Y175.010
+X-51.661 Y174.894
+X-51.075 Y174.780
+X-50.488 Y174.668
+X-49.899 Y174.556
+X-49.310 Y174.446
+X-48.720 Y174.337
+X-48.130 Y174.230
+X-47.538 Y174.124
+X-46.946 Y174.019
+X-46.353 Y173.915
+X-45.759 Y173.813
+X-45.164 Y173.712
+X-44.568 Y173.613
+X-43.972 Y173.515
+X-43.375 Y173.418
+X-42.777 Y173.322
+X-42.178 Y173.228
+X-41.579 Y173.135
+X-40.979 Y173.043
+X-40.378 Y172.953
+X-39.777 Y172.864
+X-39.174 Y172.776
+X-38.572 Y172.690
+X-37.968 Y172.605
+X-37.364 Y172.522
+X-36.759 Y172.439
+X-36.154 Y172.358
+X-35.548 Y172.279
+X-34.941 Y172.201
+X-34.334 Y172.124
+X-33.726 Y172.048
+X-33.117 Y171.974
+X-32.508 Y171.901
+X-31.899 Y171.830
+X-31.288 Y171.760
+X-30.678 Y171.691
+X-30.067 Y171.624
+X-29.455 Y171.558
+X-28.843 Y171.493
+X-28.230 Y171.430
+X-27.617 Y171.368
+X-27.003 Y171.307
+X-26.389 Y171.248
+X-25.774 Y171.190
+X-25.159 Y171.133
+X-24.543 Y171.078
+X-23.927 Y171.024
+X-23.311 Y170.972
+X-22.694 Y170.921
+X-22.077 Y170.871
+X-21.460 Y170.823
+X-20.842 Y170.776
+X-20.223 Y170.730
+X-19.605 Y170.686
+X-18.986 Y170.643
+X-18.366 Y170.602
+X-17.747 Y170.562
+X-17.127 Y170.523
+X-16.507 Y170.486
+X-15.886 Y170.450
+X-15.265 Y170.415
+X-14.644 Y170.382
+X-14.023 Y170.350
+X-13.401 Y170.320
+X-12.780 Y170.291
+X-12.158 Y170.263
+X-11.536 Y170.237
+X-10.913 Y170.212
+X-10.291 Y170.188
+X-9.668 Y170.166
+X-9.045 Y170.146
+X-8.422 Y170.126
+X-7.798 Y170.108
+X-7.175 Y170.092
+X-6.552 Y170.076
+X-5.928 Y170.062
+X-5.304 Y170.050
+X-4.680 Y170.039
+X-4.057 Y170.029
+X-3.433 Y170.021
+X-2.809 Y170.014
+X-2.184 Y170.008
+X-1.560 Y170.004
+X-0.936 Y170.002
+X-0.312 Y170.000
+X0.312 Y170.000
+X0.936 Y170.002
+X1.560 Y170.004
+X2.184 Y170.008
+X2.809 Y170.014
+X3.433 Y170.021
+X4.057 Y170.029
+X4.680 Y170.039
+X5.304 Y170.050
+X5.928 Y170.062
+X6.552 Y170.076
+X7.175 Y170.092
+X7.798 Y170.108
+X8.422 Y170.126
+X9.045 Y170.146
+X9.668 Y170.166
+X10.291 Y170.188
+X10.913 Y170.212
+X11.536 Y170.237
+X12.158 Y170.263
+X12.780 Y170.291
+X13.401 Y170.320
+X14.023 Y170.350
+X14.644 Y170.382
+X15.265 Y170.415
+X15.886 Y170.450
+X16.507 Y170.486
+X17.127 Y170.523
+X17.747 Y170.562
+X18.366 Y170.602
+X18.986 Y170.643
+X19.605 Y170.686
+X20.223 Y170.730
+X20.842 Y170.776
+X21.460 Y170.823
+X22.077 Y170.871
+X22.694 Y170.921
+X23.311 Y170.972
+X23.927 Y171.024
+X24.543 Y171.078
+X25.159 Y171.133
+X25.774 Y171.190
+X26.389 Y171.248
+X27.003 Y171.307
+X27.617 Y171.368
+X28.230 Y171.430
+X28.843 Y171.493
+X29.455 Y171.558
+X30.067 Y171.624
+X30.678 Y171.691
+X31.288 Y171.760
+X31.899 Y171.830
+X32.508 Y171.901
+X33.117 Y171.974
+X33.726 Y172.048
+X34.334 Y172.124
+X34.941 Y172.201
+X35.548 Y172.279
+X36.154 Y172.358
+X36.759 Y172.439
+X37.364 Y172.522
+X37.968 Y172.605
+X38.572 Y172.690
+X39.174 Y172.776
+X39.777 Y172.864
+X40.378 Y172.953
+X40.979 Y173.043
+X41.579 Y173.135
+X42.178 Y173.228
+X42.777 Y173.322
+X43.375 Y173.418
+X43.972 Y173.515
+X44.568 Y173.613
+X45.164 Y173.712
+X45.759 Y173.813
+X46.353 Y173.915
+X46.946 Y174.019
+X47.538 Y174.124
+X48.130 Y174.230
+X48.720 Y174.337
+X49.310 Y174.446
+X49.899 Y174.556
+X50.488 Y174.668
+X51.075 Y174.780
+X51.661 Y174.894
+X52.247 Y175.010
+X52.831 Y175.126
+X53.415 Y175.244
+X53.998 Y175.363
+X54.580 Y175.484
+X55.161 Y175.606
+X55.741 Y175.729
+X56.320 Y175.853
+X56.898 Y175.979
+X57.475 Y176.106
+X58.051 Y176.234
+X58.626 Y176.363
+X59.200 Y176.494
+X59.773 Y176.626
+X60.345 Y176.759
+X60.915 Y176.894
+X61.485 Y177.030
+X62.054 Y177.167
+X62.622 Y177.305
+X63.188 Y177.445
+X63.754 Y177.586
+X64.318 Y177.728
+X64.882 Y177.871
+X65.444 Y178.016
+X66.005 Y178.161
+X66.565 Y178.309
+X67.124 Y178.457
+X67.681 Y178.606
+X68.238 Y178.757
+X68.793 Y178.909
+X69.347 Y179.063
+X69.900 Y179.217
+X70.451 Y179.373
+X71.002 Y179.530
+X71.551 Y179.688
+X72.099 Y179.847
+X72.646 Y180.008
+X73.191 Y180.170
+X73.735 Y180.333
+X74.278 Y180.497
+X74.820 Y180.663
+X75.360 Y180.829
+X75.899 Y180.997
+X76.437 Y181.166
+X76.973 Y181.336
+X77.508 Y181.508
+X78.042 Y181.680
+X78.574 Y181.854
+X79.105 Y182.029
+X79.635 Y182.205
+X80.163 Y182.383
+X80.690 Y182.561
+X81.215 Y182.741
+X81.739 Y182.921
+X82.262 Y183.103
+X82.783 Y183.287
+X83.303 Y183.471
+X83.821 Y183.656
+X84.338 Y183.843
+X84.854 Y184.031
+X85.368 Y184.220
+X85.880 Y184.410
+X86.391 Y184.601
+X86.901 Y184.793
+X87.409 Y184.986
+X87.915 Y185.181
+X88.420 Y185.377
+X88.923 Y185.573
+X89.425 Y185.771
+X89.926 Y185.970
+X90.424 Y186.170
+X90.922 Y186.372
+X91.417 Y186.574
+X91.911 Y186.777
+X92.404 Y186.982
+X92.895 Y187.188
+X93.384 Y187.394
+X93.872 Y187.602
+X94.358 Y187.811
+X94.842 Y188.021
+X95.325 Y188.232
+X95.806 Y188.444
+X96.285 Y188.657
+X96.763 Y188.871
+X97.239 Y189.087
+X97.714 Y189.303
+X98.186 Y189.520
+X98.657 Y189.739
+X99.127 Y189.958
+X99.594 Y190.179
+X100.060 Y190.400
+X100.524 Y190.623
+X100.986 Y190.846
+X101.447 Y191.071
+X101.906 Y191.297
+X102.363 Y191.523
+X102.818 Y191.751
+X103.272 Y191.980
+X103.724 Y192.209
+X104.174 Y192.440
+X104.622 Y192.672
+X105.068 Y192.904
+X105.513 Y193.138
+X105.956 Y193.373
+X106.397 Y193.608
+X106.836 Y193.845
+X107.273 Y194.082
+X107.708 Y194.321
+X108.142 Y194.561
+X108.573 Y194.801
+X109.003 Y195.042
+X109.431 Y195.285
+X109.857 Y195.528
+X110.281 Y195.772
+X110.703 Y196.018
+X111.123 Y196.264
+X111.541 Y196.511
+X111.958 Y196.759
+X112.372 Y197.008
+X112.785 Y197.258
+X113.195 Y197.508
+X113.604 Y197.760
+X114.010 Y198.013
+X114.415 Y198.266
+X114.817 Y198.520
+X115.218 Y198.776
+X115.617 Y199.032
+X116.013 Y199.289
+X116.408 Y199.547
+X116.801 Y199.805
+X117.191 Y200.065
+X117.580 Y200.326
+X117.966 Y200.587
+X118.351 Y200.849
+X118.733 Y201.112
+X119.114 Y201.376
+X119.492 Y201.641
+X119.868 Y201.907
+X120.243 Y202.173
+X120.615 Y202.440
+X120.985 Y202.708
+X121.353 Y202.977
+X121.718 Y203.247
+X122.082 Y203.517
+X122.444 Y203.789
+X122.803 Y204.061
+X123.161 Y204.334
+X123.516 Y204.608
+X123.869 Y204.882
+X124.220 Y205.157
+X124.569 Y205.433
+X124.915 Y205.710
+X125.260 Y205.988
+X125.602 Y206.266
+X125.942 Y206.545
+X126.280 Y206.825
+X126.616 Y207.106
+X126.949 Y207.387
+X127.281 Y207.669
+X127.610 Y207.952
+X127.937 Y208.236
+X128.262 Y208.520
+X128.584 Y208.805
+X128.904 Y209.091
+X129.222 Y209.377
+X129.538 Y209.664
+X129.852 Y209.952
+X130.163 Y210.240
+X130.472 Y210.530
+X130.779 Y210.820
+X131.084 Y211.110
+X131.386 Y211.401
+X131.686 Y211.693
+X131.984 Y211.986
+X132.279 Y212.279
+X132.572 Y212.573
+X132.863 Y212.868
+X133.152 Y213.163
+X133.438 Y213.458
+X133.722 Y213.755
+X134.003 Y214.052
+X134.283 Y214.350
+X134.560 Y214.648
+X134.834 Y214.947
+X135.107 Y215.246
+X135.377 Y215.547
+X135.644 Y215.847
+X135.910 Y216.149
+X136.172 Y216.451
+X136.433 Y216.753
+X136.691 Y217.056
+X136.947 Y217.360
+X137.201 Y217.664
+X137.452 Y217.969
+X137.700 Y218.274
+X137.947 Y218.580
+X138.191 Y218.886
+X138.432 Y219.193
+X138.671 Y219.501
+X138.908 Y219.809
+X139.142 Y220.117
+X139.374 Y220.426
+X139.604 Y220.736
+X139.831 Y221.046
+X140.056 Y221.356
+X140.278 Y221.668
+X140.498 Y221.979
+X140.715 Y222.291
+X140.930 Y222.604
+X141.143 Y222.917
+X141.353 Y223.230
+X141.560 Y223.544
+X141.766 Y223.858
+X141.968 Y224.173
+X142.169 Y224.489
+X142.366 Y224.804
+X142.562 Y225.120
+X142.755 Y225.437
+X142.945 Y225.754
+X143.133 Y226.071
+X143.318 Y226.389
+X143.501 Y226.708
+X143.682 Y227.026
+X143.860 Y227.345
+X144.035 Y227.665
+X144.208 Y227.985
+X144.379 Y228.305
+X144.547 Y228.625
+X144.712 Y228.946
+X144.875 Y229.268
+X145.036 Y229.589
+X145.194 Y229.911
+X145.349 Y230.234
+X145.502 Y230.557
+X145.653 Y230.880
+X145.801 Y231.203
+X145.946 Y231.527
+X146.089 Y231.851
+X146.229 Y232.175
+X146.367 Y232.500
+X146.502 Y232.825
+X146.635 Y233.150
+X146.765 Y233.476
+X146.893 Y233.801
+X147.018 Y234.128
+X147.141 Y234.454
+X147.261 Y234.781
+X147.378 Y235.108
+X147.493 Y235.435
+X147.605 Y235.762
+X147.715 Y236.090
+X147.822 Y236.418
+X147.927 Y236.746
+X148.029 Y237.074
+X148.129 Y237.403
+X148.226 Y237.732
+X148.320 Y238.061
+X148.412 Y238.390
+X148.501 Y238.720
+X148.588 Y239.049
+X148.672 Y239.379
+X148.754 Y239.709
+X148.833 Y240.039
+X148.909 Y240.370
+X148.983 Y240.700
+X149.054 Y241.031
+X149.123 Y241.362
+X149.189 Y241.693
+X149.253 Y242.024
+X149.314 Y242.355
+X149.372 Y242.687
+X149.428 Y243.018
+X149.481 Y243.350
+X149.531 Y243.682
+X149.579 Y244.014
+X149.625 Y244.346
+X149.668 Y244.678
+X149.708 Y245.010
+X149.746 Y245.342
+X149.781 Y245.675
+X149.813 Y246.007
+X149.843 Y246.340
+X149.870 Y246.672
+X149.895 Y247.005
+X149.917 Y247.337
+X149.936 Y247.670
+X149.953 Y248.003
+X149.968 Y248.336
+X149.979 Y248.669
+X149.988 Y249.001
+X149.995 Y249.334
+X149.999 Y249.667
+X150.000 Y250.000
+G0 Z5.000
+(Engrave, spiral detail in 0.1 mm lines)
+G0 X-145.000 Y250.000
+G1 Z-1.000 F200
+G1 F800
+X-144.995 Y250.100
+X-144.991 Y250.200
+X-144.990 Y250.301
+X-144.991 Y250.401
+X-144.993 Y250.501
+X-144.998 Y250.601
+X-145.005 Y250.701
+X-145.013 Y250.801
+X-145.024 Y250.901
+X-145.036 Y251.000
+X-145.051 Y251.099
+X-145.068 Y251.198
+X-145.086 Y251.297
+X-145.107 Y251.395
+X-145.129 Y251.493
+X-145.153 Y251.590
+X-145.179 Y251.687
+X-145.208 Y251.783
+X-145.238 Y251.879
+X-145.269 Y251.974
+X-145.303 Y252.068
+X-145.339 Y252.162
+X-145.376 Y252.255
+X-145.415 Y252.347
+X-145.456 Y252.439
+X-145.499 Y252.529
+X-145.544 Y252.619
+X-145.590 Y252.708
+X-145.638 Y252.796
+X-145.687 Y252.883
+X-145.739 Y252.969
+X-145.792 Y253.054
+X-145.846 Y253.138
+X-145.903 Y253.221
+X-145.960 Y253.303
+X-146.020 Y253.384
+X-146.081 Y253.464
+X-146.143 Y253.542
+X-146.207 Y253.619
+X-146.273 Y253.695
+X-146.339 Y253.770
+X-146.408 Y253.843
+X-146.477 Y253.915
+X-146.548 Y253.986
+X-146.621 Y254.056
+X-146.694 Y254.124
+X-146.769 Y254.190
+X-146.846 Y254.255
+X-146.923 Y254.319
+X-147.002 Y254.381
+X-147.081 Y254.442
+X-147.162 Y254.501
+X-147.244 Y254.559
+X-147.327 Y254.615
+X-147.411 Y254.669
+X-147.496 Y254.722
+X-147.583 Y254.774
+X-147.670 Y254.823
+X-147.758 Y254.871
+X-147.846 Y254.918
+X-147.936 Y254.962
+X-148.027 Y255.006
+X-148.118 Y255.047
+X-148.210 Y255.086
+X-148.303 Y255.124
+X-148.396 Y255.161
+X-148.490 Y255.195
+X-148.585 Y255.228
+X-148.680 Y255.259
+X-148.776 Y255.288
+X-148.873 Y255.315
+X-148.970 Y255.341
+X-149.067 Y255.365
+X-149.165 Y255.387
+X-149.263 Y255.407
+X-149.361 Y255.425
+X-149.460 Y255.442
+X-149.559 Y255.457
+X-149.659 Y255.470
+X-149.758 Y255.481
+X-149.858 Y255.490
+X-149.958 Y255.497
+X-150.058 Y255.503
+X-150.158 Y255.507
+X-150.258 Y255.509
+X-150.359 Y255.509
+X-150.459 Y255.507
+X-150.559 Y255.504
+X-150.659 Y255.499
+X-150.759 Y255.492
+X-150.859 Y255.483
+X-150.959 Y255.472
+X-151.058 Y255.459
+X-151.157 Y255.445
+X-151.256 Y255.429
+X-151.355 Y255.411
+X-151.453 Y255.391
+X-151.551 Y255.370
+X-151.648 Y255.347
+X-151.745 Y255.322
+X-151.842 Y255.295
+X-151.938 Y255.267
+X-152.034 Y255.237
+X-152.129 Y255.205
+X-152.223 Y255.172
+X-152.317 Y255.136
+X-152.410 Y255.100
+X-152.503 Y255.061
+X-152.595 Y255.021
+X-152.686 Y254.979
+X-152.776 Y254.936
+X-152.866 Y254.891
+X-152.954 Y254.845
+X-153.042 Y254.796
+X-153.129 Y254.747
+X-153.216 Y254.696
+X-153.301 Y254.643
+X-153.385 Y254.589
+X-153.468 Y254.533
+X-153.551 Y254.476
+X-153.632 Y254.418
+X-153.712 Y254.358
+X-153.792 Y254.296
+X-153.870 Y254.234
+X-153.947 Y254.170
+X-154.023 Y254.104
+X-154.097 Y254.037
+X-154.171 Y253.969
+X-154.243 Y253.900
+X-154.315 Y253.830
+X-154.384 Y253.758
+X-154.453 Y253.685
+X-154.521 Y253.611
+X-154.587 Y253.535
+X-154.651 Y253.459
+X-154.715 Y253.381
+X-154.777 Y253.303
+X-154.838 Y253.223
+X-154.897 Y253.142
+X-154.955 Y253.060
+X-155.011 Y252.978
+X-155.066 Y252.894
+X-155.120 Y252.809
+X-155.172 Y252.724
+X-155.223 Y252.637
+X-155.272 Y252.550
+X-155.320 Y252.462
+X-155.366 Y252.373
+X-155.411 Y252.283
+X-155.454 Y252.193
+X-155.495 Y252.102
+X-155.535 Y252.010
+X-155.574 Y251.918
+X-155.611 Y251.824
+X-155.646 Y251.731
+X-155.680 Y251.636
+X-155.712 Y251.541
+X-155.742 Y251.446
+X-155.771 Y251.350
+X-155.798 Y251.253
+X-155.824 Y251.157
+X-155.848 Y251.059
+X-155.870 Y250.962
+X-155.891 Y250.864
+X-155.910 Y250.765
+X-155.927 Y250.667
+X-155.943 Y250.568
+X-155.957 Y250.468
+X-155.969 Y250.369
+X-155.980 Y250.269
+X-155.989 Y250.170
+X-155.996 Y250.070
+X-156.002 Y249.970
+X-156.005 Y249.870
+X-156.008 Y249.769
+X-156.008 Y249.669
+X-156.007 Y249.569
+X-156.005 Y249.469
+X-156.000 Y249.369
+X-155.994 Y249.269
+X-155.986 Y249.169
+X-155.977 Y249.069
+X-155.966 Y248.970
+X-155.953 Y248.870
+X-155.939 Y248.771
+X-155.923 Y248.672
+X-155.906 Y248.574
+X-155.886 Y248.475
+X-155.866 Y248.377
+X-155.843 Y248.280
+X-155.819 Y248.182
+X-155.793 Y248.085
+X-155.766 Y247.989
+X-155.737 Y247.893
+X-155.707 Y247.798
+X-155.675 Y247.703
+X-155.642 Y247.608
+X-155.607 Y247.514
+X-155.570 Y247.421
+X-155.532 Y247.329
+X-155.492 Y247.237
+X-155.451 Y247.145
+X-155.409 Y247.054
+X-155.365 Y246.964
+X-155.319 Y246.875
+X-155.272 Y246.787
+X-155.224 Y246.699
+X-155.174 Y246.612
+X-155.123 Y246.526
+X-155.070 Y246.441
+X-155.016 Y246.356
+X-154.961 Y246.273
+X-154.904 Y246.190
+X-154.846 Y246.109
+X-154.787 Y246.028
+X-154.726 Y245.948
+X-154.665 Y245.869
+X-154.601 Y245.791
+X-154.537 Y245.715
+X-154.472 Y245.639
+X-154.405 Y245.564
+X-154.337 Y245.491
+X-154.268 Y245.418
+X-154.197 Y245.347
+X-154.126 Y245.277
+X-154.053 Y245.208
+X-153.980 Y245.140
+X-153.905 Y245.073
+X-153.829 Y245.008
+X-153.752 Y244.943
+X-153.674 Y244.880
+X-153.596 Y244.818
+X-153.516 Y244.758
+X-153.435 Y244.699
+X-153.353 Y244.641
+X-153.271 Y244.584
+X-153.187 Y244.529
+X-153.103 Y244.475
+X-153.018 Y244.422
+X-152.932 Y244.371
+X-152.845 Y244.321
+X-152.757 Y244.272
+X-152.669 Y244.225
+X-152.580 Y244.179
+X-152.490 Y244.135
+X-152.400 Y244.092
+X-152.309 Y244.050
+X-152.217 Y244.010
+X-152.124 Y243.971
+X-152.031 Y243.934
+X-151.938 Y243.898
+X-151.844 Y243.864
+X-151.749 Y243.831
+X-151.654 Y243.800
+X-151.558 Y243.770
+X-151.462 Y243.742
+X-151.366 Y243.715
+X-151.269 Y243.689
+X-151.172 Y243.666
+X-151.074 Y243.643
+X-150.976 Y243.623
+X-150.878 Y243.603
+X-150.779 Y243.586
+X-150.680 Y243.569
+X-150.581 Y243.555
+X-150.482 Y243.542
+X-150.382 Y243.530
+X-150.283 Y243.520
+X-150.183 Y243.512
+X-150.083 Y243.505
+X-149.983 Y243.499
+X-149.883 Y243.495
+X-149.783 Y243.493
+X-149.683 Y243.492
+X-149.583 Y243.493
+X-149.482 Y243.495
+X-149.382 Y243.499
+X-149.282 Y243.504
+X-149.182 Y243.511
+X-149.083 Y243.520
+X-148.983 Y243.530
+X-148.884 Y243.541
+X-148.784 Y243.554
+X-148.685 Y243.569
+X-148.586 Y243.585
+X-148.488 Y243.602
+X-148.389 Y243.621
+X-148.291 Y243.642
+X-148.194 Y243.664
+X-148.096 Y243.688
+X-147.999 Y243.713
+X-147.903 Y243.739
+X-147.806 Y243.767
+X-147.711 Y243.796
+X-147.615 Y243.827
+X-147.521 Y243.859
+X-147.426 Y243.893
+X-147.333 Y243.928
+X-147.239 Y243.965
+X-147.147 Y244.003
+X-147.055 Y244.042
+X-146.963 Y244.083
+X-146.872 Y244.125
+X-146.782 Y244.168
+X-146.692 Y244.213
+X-146.604 Y244.259
+X-146.515 Y244.307
+X-146.428 Y244.356
+X-146.341 Y244.406
+X-146.255 Y244.457
+X-146.170 Y244.510
+X-146.086 Y244.564
+X-146.002 Y244.619
+X-145.919 Y244.676
+X-145.838 Y244.733
+X-145.757 Y244.792
+X-145.677 Y244.852
+X-145.597 Y244.914
+X-145.519 Y244.976
+X-145.442 Y245.040
+X-145.365 Y245.105
+X-145.290 Y245.170
+X-145.216 Y245.237
+X-145.142 Y245.306
+X-145.070 Y245.375
+X-144.998 Y245.445
+X-144.928 Y245.516
+X-144.859 Y245.589
+X-144.791 Y245.662
+X-144.724 Y245.736
+X-144.658 Y245.812
+X-144.593 Y245.888
+X-144.529 Y245.965
+X-144.467 Y246.044
+X-144.405 Y246.123
+X-144.345 Y246.203
+X-144.286 Y246.284
+X-144.228 Y246.365
+X-144.171 Y246.448
+X-144.116 Y246.531
+X-144.062 Y246.615
+X-144.009 Y246.700
+X-143.957 Y246.786
+X-143.907 Y246.873
+X-143.857 Y246.960
+X-143.809 Y247.048
+X-143.763 Y247.137
+X-143.718 Y247.226
+X-143.674 Y247.316
+X-143.631 Y247.406
+X-143.590 Y247.498
+X-143.550 Y247.589
+X-143.511 Y247.682
+X-143.474 Y247.775
+X-143.438 Y247.868
+X-143.403 Y247.962
+X-143.370 Y248.057
+X-143.338 Y248.152
+X-143.307 Y248.247
+X-143.278 Y248.343
+X-143.251 Y248.439
+X-143.224 Y248.536
+X-143.199 Y248.633
+X-143.176 Y248.730
+X-143.154 Y248.828
+X-143.133 Y248.926
+X-143.114 Y249.024
+X-143.096 Y249.122
+X-143.079 Y249.221
+X-143.064 Y249.320
+X-143.051 Y249.419
+X-143.039 Y249.519
+X-143.028 Y249.618
+X-143.019 Y249.718
+X-143.011 Y249.818
+X-143.004 Y249.918
+X-142.999 Y250.018
+X-142.996 Y250.118
+X-142.993 Y250.218
+X-142.993 Y250.318
+X-142.993 Y250.418
+X-142.996 Y250.518
+X-142.999 Y250.618
+X-143.004 Y250.718
+X-143.011 Y250.818
+X-143.018 Y250.918
+X-143.028 Y251.018
+X-143.038 Y251.117
+X-143.051 Y251.217
+X-143.064 Y251.316
+X-143.079 Y251.415
+X-143.095 Y251.514
+X-143.113 Y251.612
+X-143.132 Y251.711
+X-143.153 Y251.809
+X-143.175 Y251.906
+X-143.198 Y252.004
+X-143.222 Y252.101
+X-143.248 Y252.198
+X-143.276 Y252.294
+X-143.305 Y252.390
+X-143.335 Y252.485
+X-143.366 Y252.580
+X-143.399 Y252.675
+X-143.433 Y252.769
+X-143.468 Y252.863
+X-143.505 Y252.956
+X-143.543 Y253.049
+X-143.582 Y253.141
+X-143.623 Y253.232
+X-143.665 Y253.323
+X-143.708 Y253.413
+X-143.752 Y253.503
+X-143.798 Y253.592
+X-143.845 Y253.681
+X-143.893 Y253.769
+X-143.943 Y253.856
+X-143.993 Y253.942
+X-144.045 Y254.028
+X-144.098 Y254.113
+X-144.152 Y254.197
+X-144.207 Y254.280
+X-144.264 Y254.363
+X-144.321 Y254.445
+X-144.380 Y254.526
+X-144.440 Y254.606
+X-144.501 Y254.686
+X-144.563 Y254.764
+X-144.626 Y254.842
+X-144.690 Y254.919
+X-144.756 Y254.995
+X-144.822 Y255.070
+X-144.889 Y255.144
+X-144.958 Y255.217
+X-145.027 Y255.289
+X-145.098 Y255.360
+X-145.169 Y255.431
+X-145.241 Y255.500
+X-145.314 Y255.568
+X-145.389 Y255.635
+X-145.464 Y255.702
+X-145.540 Y255.767
+X-145.617 Y255.831
+X-145.694 Y255.894
+X-145.773 Y255.956
+X-145.852 Y256.017
+X-145.933 Y256.077
+X-146.014 Y256.135
+X-146.096 Y256.193
+X-146.178 Y256.249
+X-146.262 Y256.305
+X-146.346 Y256.359
+X-146.431 Y256.412
+X-146.517 Y256.464
+X-146.603 Y256.515
+X-146.690 Y256.564
+X-146.778 Y256.612
+X-146.866 Y256.659
+X-146.955 Y256.705
+X-147.045 Y256.750
+X-147.135 Y256.794
+X-147.226 Y256.836
+X-147.317 Y256.877
+X-147.409 Y256.916
+X-147.501 Y256.955
+X-147.594 Y256.992
+X-147.688 Y257.028
+X-147.782 Y257.063
+X-147.876 Y257.096
+X-147.971 Y257.129
+X-148.066 Y257.159
+X-148.162 Y257.189
+X-148.258 Y257.217
+X-148.354 Y257.244
+X-148.451 Y257.270
+X-148.548 Y257.294
+X-148.645 Y257.317
+X-148.743 Y257.339
+X-148.841 Y257.360
+X-148.939 Y257.379
+X-149.038 Y257.397
+X-149.137 Y257.413
+X-149.236 Y257.428
+X-149.335 Y257.442
+X-149.434 Y257.454
+X-149.534 Y257.466
+X-149.633 Y257.475
+X-149.733 Y257.484
+X-149.833 Y257.491
+X-149.933 Y257.497
+X-150.033 Y257.501
+X-150.133 Y257.504
+X-150.233 Y257.506
+X-150.333 Y257.507
+X-150.433 Y257.506
+X-150.533 Y257.504
+X-150.633 Y257.500
+X-150.733 Y257.495
+X-150.833 Y257.489
+X-150.933 Y257.482
+X-151.033 Y257.473
+X-151.133 Y257.462
+X-151.232 Y257.451
+X-151.331 Y257.438
+X-151.430 Y257.424
+X-151.529 Y257.409
+X-151.628 Y257.392
+X-151.726 Y257.374
+X-151.825 Y257.354
+X-151.923 Y257.334
+X-152.020 Y257.312
+X-152.118 Y257.289
+X-152.215 Y257.264
+X-152.312 Y257.238
+X-152.408 Y257.211
+X-152.504 Y257.183
+X-152.600 Y257.153
+X-152.695 Y257.122
+X-152.790 Y257.090
+X-152.884 Y257.057
+X-152.978 Y257.022
+X-153.071 Y256.986
+X-153.164 Y256.949
+X-153.257 Y256.911
+X-153.349 Y256.872
+X-153.440 Y256.831
+X-153.531 Y256.789
+X-153.622 Y256.746
+X-153.712 Y256.702
+X-153.801 Y256.656
+X-153.889 Y256.610
+X-153.977 Y256.562
+X-154.065 Y256.513
+X-154.152 Y256.463
+X-154.238 Y256.412
+X-154.323 Y256.360
+X-154.408 Y256.307
+X-154.492 Y256.252
+X-154.575 Y256.197
+X-154.658 Y256.140
+X-154.739 Y256.082
+X-154.820 Y256.023
+X-154.901 Y255.964
+X-154.980 Y255.903
+X-155.059 Y255.841
+X-155.137 Y255.778
+X-155.214 Y255.714
+X-155.290 Y255.649
+X-155.366 Y255.583
+X-155.440 Y255.517
+X-155.514 Y255.449
+X-155.587 Y255.380
+X-155.658 Y255.310
+X-155.729 Y255.240
+X-155.800 Y255.168
+X-155.869 Y255.096
+X-155.937 Y255.023
+X-156.004 Y254.949
+X-156.070 Y254.874
+X-156.136 Y254.798
+X-156.200 Y254.721
+X-156.263 Y254.643
+X-156.326 Y254.565
+X-156.387 Y254.486
+X-156.447 Y254.406
+X-156.507 Y254.325
+X-156.565 Y254.244
+X-156.622 Y254.162
+X-156.678 Y254.079
+X-156.733 Y253.995
+X-156.787 Y253.911
+X-156.840 Y253.826
+X-156.892 Y253.740
+X-156.943 Y253.654
+X-156.992 Y253.567
+X-157.041 Y253.480
+X-157.088 Y253.392
+X-157.135 Y253.303
+X-157.180 Y253.213
+X-157.224 Y253.123
+X-157.267 Y253.033
+X-157.308 Y252.942
+X-157.349 Y252.850
+X-157.388 Y252.758
+X-157.426 Y252.666
+X-157.463 Y252.573
+X-157.499 Y252.479
+X-157.534 Y252.385
+X-157.567 Y252.291
+X-157.599 Y252.196
+X-157.630 Y252.101
+X-157.660 Y252.006
+X-157.689 Y251.910
+X-157.716 Y251.813
+X-157.743 Y251.717
+X-157.767 Y251.620
+X-157.791 Y251.523
+X-157.814 Y251.425
+X-157.835 Y251.327
+X-157.855 Y251.229
+X-157.874 Y251.131
+X-157.891 Y251.032
+X-157.908 Y250.933
+X-157.923 Y250.834
+X-157.937 Y250.735
+X-157.949 Y250.636
+X-157.961 Y250.537
+X-157.971 Y250.437
+X-157.979 Y250.337
+X-157.987 Y250.237
+X-157.993 Y250.138
+X-157.998 Y250.038
+X-158.002 Y249.938
+X-158.005 Y249.837
+X-158.006 Y249.737
+X-158.006 Y249.637
+X-158.005 Y249.537
+X-158.003 Y249.437
+X-157.999 Y249.337
+X-157.994 Y249.237
+X-157.988 Y249.137
+X-157.980 Y249.037
+X-157.972 Y248.938
+X-157.962 Y248.838
+X-157.951 Y248.739
+X-157.938 Y248.639
+X-157.925 Y248.540
+X-157.910 Y248.441
+X-157.894 Y248.342
+X-157.876 Y248.244
+X-157.858 Y248.145
+X-157.838 Y248.047
+X-157.817 Y247.949
+X-157.795 Y247.852
+X-157.772 Y247.754
+X-157.747 Y247.657
+X-157.721 Y247.561
+X-157.694 Y247.464
+X-157.666 Y247.368
+X-157.637 Y247.272
+X-157.606 Y247.177
+X-157.574 Y247.082
+X-157.542 Y246.988
+X-157.508 Y246.893
+X-157.472 Y246.800
+X-157.436 Y246.706
+X-157.398 Y246.614
+X-157.360 Y246.521
+X-157.320 Y246.429
+X-157.279 Y246.338
+X-157.237 Y246.247
+X-157.194 Y246.157
+X-157.150 Y246.067
+X-157.104 Y245.978
+X-157.058 Y245.889
+X-157.010 Y245.801
+X-156.962 Y245.714
+X-156.912 Y245.627
+X-156.862 Y245.540
+X-156.810 Y245.455
+X-156.757 Y245.370
+X-156.703 Y245.285
+X-156.648 Y245.202
+X-156.592 Y245.119
+X-156.535 Y245.036
+X-156.477 Y244.955
+X-156.419 Y244.874
+X-156.359 Y244.793
+X-156.298 Y244.714
+X-156.236 Y244.635
+X-156.173 Y244.557
+X-156.110 Y244.480
+X-156.045 Y244.404
+X-155.979 Y244.328
+X-155.913 Y244.253
+X-155.845 Y244.179
+X-155.777 Y244.106
+X-155.708 Y244.034
+X-155.638 Y243.962
+X-155.567 Y243.891
+X-155.495 Y243.822
+X-155.423 Y243.753
+X-155.349 Y243.685
+X-155.275 Y243.618
+X-155.200 Y243.551
+X-155.124 Y243.486
+X-155.047 Y243.422
+X-154.970 Y243.358
+X-154.892 Y243.296
+X-154.813 Y243.234
+X-154.733 Y243.173
+X-154.653 Y243.114
+X-154.572 Y243.055
+X-154.490 Y242.997
+X-154.408 Y242.941
+X-154.324 Y242.885
+X-154.241 Y242.830
+X-154.156 Y242.777
+X-154.071 Y242.724
+X-153.985 Y242.672
+X-153.899 Y242.622
+X-153.812 Y242.572
+X-153.724 Y242.523
+X-153.636 Y242.476
+X-153.548 Y242.430
+X-153.458 Y242.384
+X-153.369 Y242.340
+X-153.278 Y242.297
+X-153.188 Y242.255
+X-153.096 Y242.214
+X-153.005 Y242.174
+X-152.912 Y242.135
+X-152.820 Y242.097
+X-152.726 Y242.060
+X-152.633 Y242.025
+X-152.539 Y241.990
+X-152.444 Y241.957
+X-152.350 Y241.925
+X-152.254 Y241.894
+X-152.159 Y241.864
+X-152.063 Y241.835
+X-151.967 Y241.808
+X-151.870 Y241.781
+X-151.773 Y241.756
+X-151.676 Y241.732
+X-151.579 Y241.709
+X-151.481 Y241.687
+X-151.383 Y241.666
+X-151.285 Y241.647
+X-151.187 Y241.629
+X-151.088 Y241.611
+X-150.989 Y241.595
+X-150.890 Y241.580
+X-150.791 Y241.567
+X-150.692 Y241.554
+X-150.592 Y241.543
+X-150.493 Y241.533
+X-150.393 Y241.524
+X-150.293 Y241.516
+X-150.194 Y241.509
+X-150.094 Y241.504
+X-149.994 Y241.500
+X-149.894 Y241.497
+X-149.793 Y241.495
+X-149.693 Y241.494
+X-149.593 Y241.495
+X-149.493 Y241.496
+X-149.393 Y241.499
+X-149.293 Y241.503
+X-149.193 Y241.508
+X-149.093 Y241.514
+X-148.993 Y241.522
+X-148.894 Y241.531
+X-148.794 Y241.540
+X-148.695 Y241.551
+X-148.595 Y241.564
+X-148.496 Y241.577
+X-148.397 Y241.591
+X-148.298 Y241.607
+X-148.200 Y241.624
+X-148.101 Y241.642
+X-148.003 Y241.661
+X-147.905 Y241.681
+X-147.807 Y241.703
+X-147.710 Y241.725
+X-147.612 Y241.749
+X-147.515 Y241.774
+X-147.419 Y241.800
+X-147.322 Y241.827
+X-147.226 Y241.855
+X-147.131 Y241.884
+X-147.035 Y241.915
+X-146.940 Y241.946
+X-146.846 Y241.979
+X-146.751 Y242.012
+X-146.657 Y242.047
+X-146.564 Y242.083
+X-146.471 Y242.120
+X-146.378 Y242.158
+X-146.286 Y242.197
+X-146.195 Y242.237
+X-146.104 Y242.279
+X-146.013 Y242.321
+X-145.923 Y242.364
+X-145.833 Y242.409
+X-145.744 Y242.454
+X-145.655 Y242.501
+X-145.567 Y242.548
+X-145.479 Y242.597
+X-145.392 Y242.646
+X-145.306 Y242.697
+X-145.220 Y242.748
+X-145.135 Y242.801
+X-145.050 Y242.854
+X-144.966 Y242.908
+X-144.883 Y242.964
+X-144.800 Y243.020
+X-144.718 Y243.077
+X-144.637 Y243.136
+X-144.556 Y243.195
+X-144.476 Y243.255
+X-144.397 Y243.316
+X-144.318 Y243.378
+X-144.240 Y243.441
+X-144.163 Y243.504
+X-144.086 Y243.569
+X-144.011 Y243.634
+X-143.936 Y243.701
+X-143.862 Y243.768
+X-143.788 Y243.836
+X-143.715 Y243.905
+X-143.644 Y243.974
+X-143.573 Y244.045
+X-143.502 Y244.116
+X-143.433 Y244.188
+X-143.364 Y244.261
+X-143.297 Y244.335
+X-143.230 Y244.409
+X-143.164 Y244.485
+X-143.098 Y244.560
+X-143.034 Y244.637
+X-142.971 Y244.715
+X-142.908 Y244.793
+X-142.846 Y244.871
+X-142.786 Y244.951
+X-142.726 Y245.031
+X-142.667 Y245.112
+X-142.609 Y245.194
+X-142.552 Y245.276
+X-142.496 Y245.359
+X-142.440 Y245.442
+X-142.386 Y245.526
+X-142.333 Y245.611
+X-142.280 Y245.696
+X-142.229 Y245.782
+X-142.179 Y245.869
+X-142.129 Y245.956
+X-142.081 Y246.043
+X-142.033 Y246.131
+X-141.987 Y246.220
+X-141.942 Y246.309
+X-141.897 Y246.399
+X-141.854 Y246.489
+X-141.811 Y246.580
+X-141.770 Y246.671
+X-141.730 Y246.763
+X-141.691 Y246.855
+X-141.652 Y246.947
+X-141.615 Y247.040
+X-141.579 Y247.133
+X-141.544 Y247.227
+X-141.510 Y247.321
+X-141.477 Y247.416
+X-141.445 Y247.511
+X-141.414 Y247.606
+X-141.384 Y247.701
+X-141.356 Y247.797
+X-141.328 Y247.893
+X-141.301 Y247.990
+X-141.276 Y248.087
+X-141.252 Y248.184
+X-141.228 Y248.281
+X-141.206 Y248.379
+X-141.185 Y248.477
+X-141.165 Y248.575
+X-141.146 Y248.673
+X-141.128 Y248.771
+X-141.112 Y248.870
+X-141.096 Y248.969
+X-141.082 Y249.068
+X-141.068 Y249.167
+X-141.056 Y249.267
+X-141.045 Y249.366
+X-141.035 Y249.466
+X-141.026 Y249.565
+X-141.018 Y249.665
+X-141.011 Y249.765
+X-141.006 Y249.865
+X-141.001 Y249.965
+X-140.998 Y250.065
+X-140.996 Y250.165
+X-140.995 Y250.265
+X-140.994 Y250.365
+X-140.996 Y250.465
+X-140.998 Y250.565
+X-141.001 Y250.665
+X-141.005 Y250.765
+X-141.011 Y250.865
+X-141.018 Y250.965
+X-141.025 Y251.065
+X-141.034 Y251.164
+X-141.044 Y251.264
+X-141.055 Y251.364
+X-141.067 Y251.463
+X-141.081 Y251.562
+X-141.095 Y251.661
+X-141.110 Y251.760
+X-141.127 Y251.859
+X-141.144 Y251.957
+X-141.163 Y252.056
+X-141.183 Y252.154
+X-141.204 Y252.252
+X-141.226 Y252.349
+X-141.249 Y252.447
+X-141.273 Y252.544
+X-141.298 Y252.641
+X-141.324 Y252.737
+X-141.352 Y252.833
+X-141.380 Y252.929
+X-141.409 Y253.025
+X-141.440 Y253.120
+X-141.471 Y253.215
+X-141.504 Y253.310
+X-141.537 Y253.404
+X-141.572 Y253.498
+X-141.608 Y253.592
+X-141.644 Y253.685
+X-141.682 Y253.778
+X-141.721 Y253.870
+X-141.760 Y253.962
+X-141.801 Y254.053
+X-141.843 Y254.144
+X-141.885 Y254.235
+X-141.929 Y254.325
+X-141.974 Y254.414
+X-142.019 Y254.503
+X-142.066 Y254.592
+X-142.114 Y254.680
+X-142.162 Y254.767
+X-142.212 Y254.854
+X-142.262 Y254.941
+X-142.313 Y255.027
+X-142.366 Y255.112
+X-142.419 Y255.197
+X-142.473 Y255.281
+X-142.528 Y255.365
+X-142.584 Y255.448
+X-142.641 Y255.530
+X-142.699 Y255.612
+X-142.757 Y255.693
+X-142.817 Y255.773
+X-142.877 Y255.853
+X-142.939 Y255.932
+X-143.001 Y256.011
+X-143.064 Y256.088
+X-143.128 Y256.165
+X-143.192 Y256.242
+X-143.258 Y256.318
+X-143.324 Y256.393
+X-143.391 Y256.467
+X-143.459 Y256.540
+X-143.528 Y256.613
+X-143.597 Y256.685
+X-143.667 Y256.756
+X-143.738 Y256.827
+X-143.810 Y256.897
+X-143.883 Y256.966
+X-143.956 Y257.034
+X-144.030 Y257.101
+X-144.104 Y257.168
+X-144.180 Y257.234
+X-144.256 Y257.299
+X-144.333 Y257.363
+X-144.410 Y257.426
+X-144.489 Y257.488
+X-144.567 Y257.550
+X-144.647 Y257.611
+X-144.727 Y257.671
+X-144.808 Y257.730
+X-144.889 Y257.788
+X-144.971 Y257.845
+X-145.054 Y257.902
+X-145.137 Y257.957
+X-145.221 Y258.012
+X-145.306 Y258.066
+X-145.391 Y258.118
+X-145.476 Y258.170
+X-145.562 Y258.221
+X-145.649 Y258.271
+X-145.736 Y258.320
+X-145.824 Y258.369
+X-145.912 Y258.416
+X-146.001 Y258.462
+X-146.090 Y258.507
+X-146.180 Y258.552
+X-146.270 Y258.595
+X-146.361 Y258.638
+X-146.452 Y258.679
+X-146.543 Y258.720
+X-146.635 Y258.759
+X-146.727 Y258.798
+X-146.820 Y258.835
+X-146.913 Y258.872
+X-147.007 Y258.907
+X-147.101 Y258.942
+X-147.195 Y258.976
+X-147.290 Y259.008
+X-147.385 Y259.040
+X-147.480 Y259.070
+X-147.576 Y259.100
+X-147.672 Y259.128
+X-147.768 Y259.156
+X-147.864 Y259.182
+X-147.961 Y259.208
+X-148.058 Y259.232
+X-148.155 Y259.255
+X-148.253 Y259.278
+X-148.351 Y259.299
+X-148.449 Y259.319
+X-148.547 Y259.338
+X-148.645 Y259.357
+X-148.744 Y259.374
+X-148.843 Y259.390
+X-148.942 Y259.405
+X-149.041 Y259.419
+X-149.140 Y259.432
+X-149.239 Y259.444
+X-149.339 Y259.455
+X-149.438 Y259.464
+X-149.538 Y259.473
+X-149.638 Y259.481
+X-149.738 Y259.488
+X-149.838 Y259.493
+X-149.938 Y259.498
+X-150.038 Y259.501
+X-150.138 Y259.504
+X-150.238 Y259.505
+X-150.338 Y259.505
+X-150.438 Y259.505
+X-150.538 Y259.503
+X-150.638 Y259.500
+X-150.738 Y259.496
+X-150.838 Y259.491
+X-150.938 Y259.485
+X-151.038 Y259.478
+X-151.137 Y259.470
+X-151.237 Y259.461
+X-151.337 Y259.451
+X-151.436 Y259.439
+X-151.535 Y259.427
+X-151.635 Y259.414
+X-151.734 Y259.400
+X-151.832 Y259.384
+X-151.931 Y259.368
+X-152.030 Y259.350
+X-152.128 Y259.332
+X-152.226 Y259.312
+X-152.324 Y259.292
+X-152.422 Y259.270
+X-152.519 Y259.248
+X-152.617 Y259.224
+X-152.714 Y259.199
+X-152.810 Y259.174
+X-152.907 Y259.147
+X-153.003 Y259.120
+X-153.099 Y259.091
+X-153.194 Y259.061
+X-153.290 Y259.031
+X-153.385 Y258.999
+X-153.479 Y258.966
+X-153.574 Y258.933
+X-153.668 Y258.898
+X-153.761 Y258.863
+X-153.854 Y258.826
+X-153.947 Y258.789
+X-154.039 Y258.750
+X-154.131 Y258.711
+X-154.223 Y258.671
+X-154.314 Y258.629
+X-154.405 Y258.587
+X-154.495 Y258.544
+X-154.585 Y258.500
+X-154.674 Y258.455
+X-154.763 Y258.409
+X-154.852 Y258.362
+X-154.940 Y258.314
+X-155.027 Y258.265
+X-155.114 Y258.216
+X-155.200 Y258.165
+X-155.286 Y258.114
+X-155.371 Y258.061
+X-155.456 Y258.008
+X-155.540 Y257.954
+X-155.624 Y257.899
+X-155.707 Y257.844
+X-155.790 Y257.787
+X-155.872 Y257.730
+X-155.953 Y257.671
+X-156.034 Y257.612
+X-156.114 Y257.552
+X-156.193 Y257.491
+X-156.272 Y257.430
+X-156.350 Y257.367
+X-156.428 Y257.304
+X-156.505 Y257.240
+X-156.581 Y257.175
+X-156.657 Y257.110
+X-156.732 Y257.043
+X-156.806 Y256.976
+X-156.879 Y256.908
+X-156.952 Y256.840
+X-157.024 Y256.770
+X-157.096 Y256.700
+X-157.166 Y256.629
+X-157.236 Y256.558
+X-157.305 Y256.485
+X-157.374 Y256.413
+X-157.442 Y256.339
+X-157.509 Y256.264
+X-157.575 Y256.189
+X-157.640 Y256.114
+X-157.705 Y256.037
+X-157.769 Y255.960
+X-157.832 Y255.883
+X-157.894 Y255.804
+X-157.955 Y255.725
+X-158.016 Y255.646
+X-158.076 Y255.565
+X-158.135 Y255.485
+X-158.193 Y255.403
+X-158.251 Y255.321
+X-158.307 Y255.239
+X-158.363 Y255.155
+X-158.418 Y255.072
+X-158.471 Y254.987
+X-158.525 Y254.903
+X-158.577 Y254.817
+X-158.628 Y254.731
+X-158.679 Y254.645
+X-158.728 Y254.558
+X-158.777 Y254.471
+X-158.825 Y254.383
+X-158.872 Y254.294
+X-158.918 Y254.206
+X-158.963 Y254.116
+X-159.007 Y254.027
+X-159.050 Y253.936
+X-159.093 Y253.846
+X-159.134 Y253.755
+X-159.175 Y253.663
+X-159.214 Y253.571
+X-159.253 Y253.479
+X-159.291 Y253.386
+X-159.328 Y253.293
+X-159.364 Y253.200
+X-159.398 Y253.106
+X-159.432 Y253.012
+X-159.465 Y252.917
+X-159.497 Y252.823
+X-159.529 Y252.727
+X-159.559 Y252.632
+X-159.588 Y252.536
+X-159.616 Y252.440
+X-159.643 Y252.344
+X-159.670 Y252.247
+X-159.695 Y252.151
+X-159.719 Y252.054
+X-159.742 Y251.956
+X-159.765 Y251.859
+X-159.786 Y251.761
+X-159.807 Y251.663
+X-159.826 Y251.565
+X-159.844 Y251.466
+X-159.862 Y251.368
+X-159.878 Y251.269
+X-159.894 Y251.170
+X-159.908 Y251.071
+X-159.921 Y250.972
+X-159.934 Y250.873
+X-159.945 Y250.773
+X-159.956 Y250.674
+X-159.965 Y250.574
+X-159.974 Y250.475
+X-159.981 Y250.375
+X-159.987 Y250.275
+X-159.993 Y250.175
+X-159.997 Y250.075
+X-160.001 Y249.975
+X-160.003 Y249.875
+X-160.005 Y249.775
+X-160.005 Y249.675
+X-160.004 Y249.575
+X-160.003 Y249.475
+X-160.000 Y249.375
+X-159.997 Y249.275
+X-159.992 Y249.175
+X-159.987 Y249.075
+X-159.980 Y248.975
+X-159.973 Y248.875
+X-159.964 Y248.776
+X-159.954 Y248.676
+X-159.944 Y248.576
+X-159.932 Y248.477
+X-159.920 Y248.378
+X-159.906 Y248.279
+X-159.892 Y248.180
+X-159.876 Y248.081
+X-159.860 Y247.982
+X-159.842 Y247.883
+X-159.824 Y247.785
+X-159.805 Y247.687
+X-159.784 Y247.589
+X-159.763 Y247.491
+X-159.741 Y247.394
+X-159.717 Y247.296
+X-159.693 Y247.199
+X-159.668 Y247.102
+X-159.642 Y247.006
+X-159.615 Y246.910
+X-159.586 Y246.814
+X-159.557 Y246.718
+X-159.527 Y246.622
+X-159.496 Y246.527
+X-159.465 Y246.432
+X-159.432 Y246.338
+X-159.398 Y246.244
+X-159.363 Y246.150
+X-159.328 Y246.056
+X-159.291 Y245.963
+X-159.254 Y245.870
+X-159.216 Y245.778
+X-159.176 Y245.686
+X-159.136 Y245.594
+X-159.095 Y245.503
+X-159.053 Y245.412
+X-159.010 Y245.322
+X-158.966 Y245.232
+X-158.922 Y245.142
+X-158.876 Y245.053
+X-158.830 Y244.964
+X-158.783 Y244.876
+X-158.735 Y244.788
+X-158.686 Y244.701
+X-158.636 Y244.614
+X-158.585 Y244.528
+X-158.533 Y244.442
+X-158.481 Y244.357
+X-158.428 Y244.272
+X-158.374 Y244.188
+X-158.319 Y244.104
+X-158.263 Y244.021
+X-158.207 Y243.939
+X-158.149 Y243.857
+X-158.091 Y243.775
+X-158.032 Y243.694
+X-157.973 Y243.614
+X-157.912 Y243.534
+X-157.851 Y243.455
+X-157.789 Y243.377
+X-157.726 Y243.299
+X-157.663 Y243.221
+X-157.598 Y243.145
+X-157.533 Y243.069
+X-157.467 Y242.993
+X-157.401 Y242.919
+X-157.334 Y242.845
+X-157.266 Y242.771
+X-157.197 Y242.698
+X-157.128 Y242.626
+X-157.057 Y242.555
+X-156.987 Y242.484
+X-156.915 Y242.414
+X-156.843 Y242.345
+X-156.770 Y242.276
+X-156.697 Y242.208
+X-156.622 Y242.141
+X-156.548 Y242.075
+X-156.472 Y242.009
+X-156.396 Y241.944
+X-156.319 Y241.880
+X-156.242 Y241.816
+X-156.164 Y241.754
+X-156.086 Y241.692
+X-156.006 Y241.630
+X-155.927 Y241.570
+X-155.846 Y241.510
+X-155.765 Y241.451
+X-155.684 Y241.393
+X-155.602 Y241.336
+X-155.519 Y241.279
+X-155.436 Y241.224
+X-155.353 Y241.169
+X-155.268 Y241.115
+X-155.184 Y241.062
+X-155.098 Y241.009
+X-155.013 Y240.958
+X-154.926 Y240.907
+X-154.840 Y240.857
+X-154.753 Y240.808
+X-154.665 Y240.760
+X-154.577 Y240.712
+X-154.488 Y240.666
+X-154.399 Y240.620
+X-154.310 Y240.575
+X-154.220 Y240.531
+X-154.129 Y240.488
+X-154.039 Y240.446
+X-153.948 Y240.405
+X-153.856 Y240.364
+X-153.764 Y240.325
+X-153.672 Y240.286
+X-153.579 Y240.248
+X-153.486 Y240.211
+X-153.393 Y240.175
+X-153.299 Y240.140
+X-153.205 Y240.106
+X-153.111 Y240.073
+X-153.016 Y240.040
+X-152.921 Y240.009
+X-152.826 Y239.978
+X-152.730 Y239.949
+X-152.634 Y239.920
+X-152.538 Y239.892
+X-152.442 Y239.865
+X-152.345 Y239.839
+X-152.248 Y239.814
+X-152.151 Y239.790
+X-152.054 Y239.767
+X-151.956 Y239.745
+X-151.859 Y239.724
+X-151.761 Y239.703
+X-151.662 Y239.684
+X-151.564 Y239.665
+X-151.466 Y239.648
+X-151.367 Y239.631
+X-151.268 Y239.616
+X-151.169 Y239.601
+X-151.070 Y239.587
+X-150.971 Y239.575
+X-150.871 Y239.563
+X-150.772 Y239.552
+X-150.672 Y239.542
+X-150.573 Y239.533
+X-150.473 Y239.525
+X-150.373 Y239.518
+X-150.273 Y239.512
+X-150.173 Y239.507
+X-150.073 Y239.502
+X-149.973 Y239.499
+X-149.873 Y239.497
+X-149.773 Y239.496
+X-149.673 Y239.495
+X-149.573 Y239.496
+X-149.473 Y239.497
+X-149.373 Y239.500
+X-149.273 Y239.503
+X-149.173 Y239.508
+X-149.073 Y239.513
+X-148.973 Y239.519
+X-148.873 Y239.526
+X-148.774 Y239.534
+X-148.674 Y239.544
+X-148.575 Y239.554
+X-148.475 Y239.565
+X-148.376 Y239.577
+X-148.277 Y239.589
+X-148.177 Y239.603
+X-148.078 Y239.618
+X-147.980 Y239.634
+X-147.881 Y239.650
+X-147.782 Y239.668
+X-147.684 Y239.687
+X-147.586 Y239.706
+X-147.488 Y239.726
+X-147.390 Y239.748
+X-147.293 Y239.770
+X-147.195 Y239.793
+X-147.098 Y239.817
+X-147.001 Y239.842
+X-146.905 Y239.868
+X-146.808 Y239.895
+X-146.712 Y239.922
+X-146.616 Y239.951
+X-146.521 Y239.981
+X-146.425 Y240.011
+X-146.330 Y240.042
+X-146.236 Y240.075
+X-146.141 Y240.108
+X-146.047 Y240.142
+X-145.953 Y240.176
+X-145.860 Y240.212
+X-145.767 Y240.249
+X-145.674 Y240.286
+X-145.582 Y240.325
+X-145.489 Y240.364
+X-145.398 Y240.404
+X-145.307 Y240.445
+X-145.216 Y240.487
+X-145.125 Y240.530
+X-145.035 Y240.573
+X-144.945 Y240.618
+X-144.856 Y240.663
+X-144.767 Y240.709
+X-144.679 Y240.756
+X-144.591 Y240.804
+X-144.503 Y240.852
+X-144.416 Y240.901
+X-144.330 Y240.952
+X-144.244 Y241.003
+X-144.158 Y241.054
+X-144.073 Y241.107
+X-143.988 Y241.160
+X-143.904 Y241.215
+X-143.821 Y241.269
+X-143.738 Y241.325
+X-143.655 Y241.382
+X-143.573 Y241.439
+X-143.491 Y241.497
+X-143.411 Y241.556
+X-143.330 Y241.615
+X-143.250 Y241.676
+X-143.171 Y241.737
+X-143.092 Y241.799
+X-143.014 Y241.861
+X-142.937 Y241.924
+X-142.860 Y241.988
+X-142.783 Y242.053
+X-142.708 Y242.118
+X-142.633 Y242.185
+X-142.558 Y242.251
+X-142.484 Y242.319
+X-142.411 Y242.387
+X-142.338 Y242.456
+X-142.266 Y242.525
+X-142.195 Y242.596
+X-142.124 Y242.666
+X-142.054 Y242.738
+X-141.985 Y242.810
+X-141.916 Y242.883
+X-141.849 Y242.956
+X-141.781 Y243.030
+X-141.715 Y243.105
+X-141.649 Y243.180
+X-141.584 Y243.256
+X-141.519 Y243.333
+X-141.455 Y243.410
+X-141.392 Y243.487
+X-141.330 Y243.566
+X-141.268 Y243.645
+X-141.207 Y243.724
+X-141.147 Y243.804
+X-141.088 Y243.884
+X-141.029 Y243.966
+X-140.971 Y244.047
+X-140.914 Y244.129
+X-140.858 Y244.212
+X-140.802 Y244.295
+X-140.747 Y244.379
+X-140.693 Y244.463
+X-140.640 Y244.548
+X-140.588 Y244.633
+X-140.536 Y244.719
+X-140.485 Y244.805
+X-140.435 Y244.891
+X-140.386 Y244.978
+X-140.337 Y245.066
+X-140.289 Y245.154
+X-140.243 Y245.242
+X-140.196 Y245.331
+X-140.151 Y245.420
+X-140.107 Y245.510
+X-140.063 Y245.600
+X-140.020 Y245.691
+X-139.979 Y245.781
+X-139.937 Y245.873
+X-139.897 Y245.964
+X-139.858 Y246.056
+X-139.819 Y246.149
+X-139.782 Y246.241
+X-139.745 Y246.334
+X-139.709 Y246.428
+X-139.674 Y246.521
+X-139.639 Y246.615
+X-139.606 Y246.710
+X-139.573 Y246.804
+X-139.542 Y246.899
+X-139.511 Y246.994
+X-139.481 Y247.090
+X-139.452 Y247.186
+X-139.424 Y247.282
+X-139.397 Y247.378
+X-139.370 Y247.474
+X-139.345 Y247.571
+X-139.320 Y247.668
+X-139.296 Y247.765
+X-139.273 Y247.863
+X-139.252 Y247.960
+X-139.230 Y248.058
+X-139.210 Y248.156
+X-139.191 Y248.254
+X-139.173 Y248.353
+X-139.155 Y248.451
+X-139.139 Y248.550
+X-139.123 Y248.649
+X-139.108 Y248.748
+X-139.094 Y248.847
+X-139.081 Y248.946
+X-139.069 Y249.045
+X-139.058 Y249.145
+X-139.048 Y249.244
+X-139.039 Y249.344
+G0 Z5.000
+G0 X0.000 Y0.000
+M5
+M30
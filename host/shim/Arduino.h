@@ -0,0 +1,255 @@
+/* This file is part of the Maslow Due Control Software.
+    The Maslow Due Control Software is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Maslow Due Control Software is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with the Maslow Control Software.  If not, see <http://www.gnu.org/licenses/>.
+
+    Arduino.h - host stand-in for the Arduino Due core, so the firmware builds and runs off target.
+    Only what the firmware uses is here. The SAM3X peripherals are plain structs in memory, the
+    DueTimer objects record their handlers and periods, and the ports and pins are a table the host
+    programs drive (host_shim.h). Built with -D__arm__, so DueTimer.h declares its class as usual.
+    */
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PSTR(s) (s)
+#define F(s) (s)
+#define bit(n) (1 << n)
+#ifndef __cplusplus
+  #define min(a,b) ((a)<(b)?(a):(b))
+  #define max(a,b) ((a)>(b)?(a):(b))
+#else
+  template<class T, class L> auto min(const T& a, const L& b) -> decltype(b < a ? b : a) { return (b < a) ? b : a; }
+  template<class T, class L> auto max(const T& a, const L& b) -> decltype(b < a ? b : a) { return (a < b) ? b : a; }
+#endif
+
+#define F_CPU 84000000L
+#define VARIANT_MCK 84000000L
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+#define CHANGE 2
+#define FALLING 3
+#define RISING 4
+#define DEC 10
+#define HEX 16
+
+#define A5 59
+#define NUM_DIGITAL_PINS 92
+
+// Time, from the host clock or the simulated one (host_shim.h).
+unsigned long micros(void);
+unsigned long millis(void);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+// Interrupt masking. The host delivers interrupts only while they are enabled.
+void noInterrupts(void);
+void interrupts(void);
+
+// -- SAM3X peripherals, as memory
+
+typedef struct {
+  volatile uint32_t PIO_PER, PIO_PDR, PIO_PSR;
+  volatile uint32_t PIO_OER, PIO_ODR, PIO_OSR;
+  volatile uint32_t PIO_SODR, PIO_CODR, PIO_ODSR, PIO_PDSR;
+  volatile uint32_t PIO_IER, PIO_IDR, PIO_IMR, PIO_ISR;
+  volatile uint32_t PIO_PUDR, PIO_PUER, PIO_PUSR;
+  volatile uint32_t PIO_ABSR;
+} Pio;
+
+typedef struct {
+  volatile uint32_t TC_CCR, TC_CMR, TC_SMMR, Reserved1;
+  volatile uint32_t TC_CV, TC_RA, TC_RB, TC_RC;
+  volatile uint32_t TC_SR, TC_IER, TC_IDR, TC_IMR;
+} TcChannel;
+
+typedef struct {
+  TcChannel TC_CHANNEL[3];
+  volatile uint32_t TC_BCR, TC_BMR;
+} Tc;
+
+typedef struct {
+  volatile uint32_t PWM_CMR, PWM_CDTY, PWM_CDTYUPD, PWM_CPRD, PWM_CPRDUPD, PWM_CCNT;
+} PwmCh_num;
+
+typedef struct {
+  PwmCh_num PWM_CH_NUM[8];
+} Pwm;
+
+typedef struct {
+  volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct {
+  volatile uint32_t CTRL;
+  volatile uint32_t CYCCNT;
+} DWT_Type;
+
+extern Pio host_pio[4];
+extern Tc host_tc[3];
+extern Pwm host_pwm;
+extern CoreDebug_Type host_core_debug;
+extern DWT_Type host_dwt;
+
+#define PIOA (&host_pio[0])
+#define PIOB (&host_pio[1])
+#define PIOC (&host_pio[2])
+#define PIOD (&host_pio[3])
+#define TC0 (&host_tc[0])
+#define TC1 (&host_tc[1])
+#define TC2 (&host_tc[2])
+#define PWM (&host_pwm)
+#define PWM_INTERFACE PWM
+#define CoreDebug (&host_core_debug)
+#define DWT (&host_dwt)
+
+#define ID_PWM 36
+#define PWM_INTERFACE_ID ID_PWM
+#define ID_TC0 27
+#define ID_TC6 33
+
+#define CoreDebug_DEMCR_TRCENA_Msk (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_Msk (1UL << 0)
+
+#define TC_CCR_CLKEN (1UL << 0)
+#define TC_CCR_CLKDIS (1UL << 1)
+#define TC_CCR_SWTRG (1UL << 2)
+#define TC_CMR_TCCLKS_Msk (0x7UL << 0)
+#define TC_CMR_TCCLKS_XC0 (0x5UL << 0)
+#define TC_CMR_WAVE (1UL << 15)
+#define TC_CMR_WAVSEL_UP_RC (0x2UL << 13)
+#define TC_CMR_ACPA_Msk (0x3UL << 16)
+#define TC_CMR_ACPA_CLEAR (0x2UL << 16)
+#define TC_CMR_ACPC_Msk (0x3UL << 18)
+#define TC_CMR_ACPC_SET (0x1UL << 18)
+#define TC_CMR_ACPC_CLEAR (0x2UL << 18)
+#define TC_CMR_BCPB_Msk (0x3UL << 24)
+#define TC_CMR_BCPB_CLEAR (0x2UL << 24)
+#define TC_CMR_BCPC_Msk (0x3UL << 26)
+#define TC_CMR_BCPC_SET (0x1UL << 26)
+#define TC_CMR_BCPC_CLEAR (0x2UL << 26)
+#define TC_IER_CPCS (1UL << 4)
+#define TC_BMR_QDEN (1UL << 8)
+#define TC_BMR_POSEN (1UL << 9)
+#define TC_BMR_MAXFILT(x) (((x) & 0x3FUL) << 20)
+
+#define PWM_CMR_CPOL (1UL << 9)
+
+#define PIO_DEFAULT 0
+#define PIO_PULLUP 1
+#define PIO_PERIPH_A 1
+#define PIO_PERIPH_B 2
+#define PIO_PA13B_PWMH2 (1UL << 13)
+#define PIO_PB25B_TIOA0 (1UL << 25)
+#define PIO_PB27B_TIOB0 (1UL << 27)
+#define PIO_PC25B_TIOA6 (1UL << 25)
+#define PIO_PC26B_TIOB6 (1UL << 26)
+
+typedef enum {
+  PIOA_IRQn = 11, PIOB_IRQn = 12, PIOC_IRQn = 13, PIOD_IRQn = 14,
+  UART_IRQn = 8, TWI0_IRQn = 22, TWI1_IRQn = 23,
+  TC0_IRQn = 27, TC1_IRQn, TC2_IRQn, TC3_IRQn, TC4_IRQn, TC5_IRQn, TC6_IRQn, TC7_IRQn, TC8_IRQn,
+  UOTGHS_IRQn = 40
+} IRQn_Type;
+
+inline void NVIC_SetPriority(IRQn_Type, uint32_t) { }
+inline void NVIC_EnableIRQ(IRQn_Type) { }
+inline void NVIC_DisableIRQ(IRQn_Type) { }
+inline void NVIC_ClearPendingIRQ(IRQn_Type) { }
+inline uint32_t __CLZ(uint32_t value) { return(value ? __builtin_clz(value) : 32); }
+
+inline uint32_t pmc_enable_periph_clk(uint32_t) { return(0); }
+inline void pmc_set_writeprotect(uint32_t) { }
+inline uint32_t PIO_Configure(Pio *, uint32_t, uint32_t, uint32_t) { return(1); }
+inline void PWMC_DisableChannel(Pwm *, uint32_t) { }
+inline void PWMC_EnableChannel(Pwm *, uint32_t) { }
+inline void PWMC_ConfigureChannel(Pwm *, uint32_t, uint32_t, uint32_t, uint32_t) { }
+inline void PWMC_SetPeriod(Pwm *, uint32_t, uint32_t) { }
+inline void PWMC_SetDutyCycle(Pwm *pwm, uint32_t channel, uint32_t duty) { pwm->PWM_CH_NUM[channel].PWM_CDTY = duty; }
+
+inline void TC_Configure(Tc *tc, uint32_t channel, uint32_t mode) { tc->TC_CHANNEL[channel].TC_CMR = mode; }
+inline void TC_SetRC(Tc *tc, uint32_t channel, uint32_t value) { tc->TC_CHANNEL[channel].TC_RC = value; }
+inline void TC_Start(Tc *, uint32_t) { }
+inline void TC_Stop(Tc *, uint32_t) { }
+inline uint32_t TC_GetStatus(Tc *tc, uint32_t channel) { return(tc->TC_CHANNEL[channel].TC_SR); }
+
+// -- Pins, as the variant table of the Due core
+
+#define PIN_ATTR_ANALOG (1UL << 1)
+#define PIN_ATTR_PWM (1UL << 3)
+#define PIN_ATTR_TIMER (1UL << 4)
+
+typedef enum {
+  NOT_ON_TIMER = -1,
+  TC0_CHA0 = 0, TC0_CHB0, TC0_CHA1, TC0_CHB1, TC0_CHA2, TC0_CHB2,
+  TC1_CHA3, TC1_CHB3, TC1_CHA4, TC1_CHB4, TC1_CHA5, TC1_CHB5,
+  TC2_CHA6, TC2_CHB6, TC2_CHA7, TC2_CHB7, TC2_CHA8, TC2_CHB8
+} ETCChannel;
+
+typedef struct {
+  Pio *pPort;
+  uint32_t ulPin;
+  uint32_t ulPinAttribute;
+  uint32_t ulPWMChannel;
+  int ulTCChannel;
+} PinDescription;
+
+extern const PinDescription g_APinDescription[NUM_DIGITAL_PINS];
+
+void pinMode(uint32_t pin, uint32_t mode);
+void digitalWrite(uint32_t pin, uint32_t level);
+int digitalRead(uint32_t pin);
+void analogWrite(uint32_t pin, uint32_t value);
+inline uint32_t digitalPinToInterrupt(uint32_t pin) { return(pin); }
+void attachInterrupt(uint32_t pin, void (*handler)(void), uint32_t mode);
+void detachInterrupt(uint32_t pin);
+
+// -- Serial ports
+
+class HostSerial
+{
+public:
+  void begin(unsigned long baud);
+  int available(void);
+  int read(void);
+  int peek(void);
+  int availableForWrite(void);
+  size_t write(uint8_t c);
+  size_t print(const char *s);
+  size_t print(char c);
+  size_t print(long value, int base = DEC);
+  size_t print(int value, int base = DEC) { return(print((long)value, base)); }
+  size_t print(unsigned long value, int base = DEC);
+  size_t print(unsigned int value, int base = DEC) { return(print((unsigned long)value, base)); }
+  size_t print(double value, int digits = 2);
+  size_t println(const char *s) { return(print(s) + print("\r\n")); }
+  long parseInt(void);
+  float parseFloat(void);
+  operator bool() { return(true); }
+};
+
+extern HostSerial Serial;
+extern HostSerial SerialUSB;
+
+#endif
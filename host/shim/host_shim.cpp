@@ -0,0 +1,499 @@
+/* This file is part of the Maslow Due Control Software.
+    The Maslow Due Control Software is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Maslow Due Control Software is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with the Maslow Control Software.  If not, see <http://www.gnu.org/licenses/>.
+
+    host_shim.cpp - host implementation of the Arduino Due core calls and DueTimer used by the firmware.
+    */
+
+#include <stdio.h>
+#include <time.h>
+#include "host_shim.h"
+#include "DueTimer.h"
+
+Pio host_pio[4];
+Tc host_tc[3];
+Pwm host_pwm;
+CoreDebug_Type host_core_debug;
+DWT_Type host_dwt;
+
+// -- Clock
+
+uint8_t host_skip_delays = false;
+
+static uint64_t host_monotonic_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return((uint64_t)ts.tv_sec*1000000000ULL + ts.tv_nsec);
+}
+
+static uint64_t (*host_clock)(void) = host_monotonic_ns;
+
+void host_set_clock(uint64_t (*now_ns)(void)) { host_clock = now_ns; }
+uint64_t host_now_ns(void) { return(host_clock()); }
+
+unsigned long micros(void) { return((uint32_t)(host_clock()/1000)); }
+unsigned long millis(void) { return((uint32_t)(host_clock()/1000000)); }
+
+void delayMicroseconds(unsigned int us)
+{
+  if (host_skip_delays) { return; }
+  uint64_t end = host_clock() + 1000ULL*us;
+  while (host_clock() < end) { }
+}
+
+void delay(unsigned long ms)
+{
+  if (host_skip_delays) { return; }
+  uint64_t end = host_clock() + 1000000ULL*ms;
+  while (host_clock() < end) { }
+}
+
+// -- Interrupt masking
+
+volatile uint8_t host_irq_masked = false;
+void (*host_irq_unmask_hook)(void) = NULL;
+
+void noInterrupts(void) { host_irq_masked = true; }
+
+void interrupts(void)
+{
+  host_irq_masked = false;
+  if (host_irq_unmask_hook != NULL) { host_irq_unmask_hook(); }
+}
+
+// -- DueTimer. Records what the firmware asks of each timer, for the host to run.
+
+host_timer_t host_timers[HOST_TIMERS];
+
+double DueTimer::_frequency[NUM_TIMERS];
+void (*DueTimer::callbacks[NUM_TIMERS])();
+
+DueTimer::DueTimer(unsigned short _timer) : timer(_timer) { }
+
+DueTimer DueTimer::getAvailable(void)
+{
+  for (unsigned short i = 0; i < NUM_TIMERS; i++) {
+    if (callbacks[i] == NULL) { return(DueTimer(i)); }
+  }
+  return(DueTimer(0));
+}
+
+DueTimer& DueTimer::attachInterrupt(void (*isr)())
+{
+  callbacks[timer] = isr;
+  host_timers[timer].handler = isr;
+  return(*this);
+}
+
+DueTimer& DueTimer::detachInterrupt(void)
+{
+  stop();
+  callbacks[timer] = NULL;
+  host_timers[timer].handler = NULL;
+  return(*this);
+}
+
+DueTimer& DueTimer::start(long microseconds)
+{
+  if (microseconds > 0) { setPeriod(microseconds); }
+  if (_frequency[timer] <= 0) { setFrequency(1); }
+  host_timers[timer].running = true;
+  host_timers[timer].changes++;
+  return(*this);
+}
+
+DueTimer& DueTimer::stop(void)
+{
+  host_timers[timer].running = false;
+  host_timers[timer].changes++;
+  return(*this);
+}
+
+DueTimer& DueTimer::setFrequency(double frequency)
+{
+  if (frequency <= 0) { frequency = 1; }
+  _frequency[timer] = frequency;
+  host_timers[timer].period_us = (uint32_t)lround(1000000.0/frequency);
+  if (host_timers[timer].period_us == 0) { host_timers[timer].period_us = 1; }
+  host_timers[timer].changes++;
+  return(*this);
+}
+
+DueTimer& DueTimer::setPeriod(unsigned long microseconds)
+{
+  return(setFrequency(1000000.0/microseconds));
+}
+
+double DueTimer::getFrequency(void) const { return(_frequency[timer]); }
+long DueTimer::getPeriod(void) const { return(1.0/getFrequency()*1000000); }
+
+DueTimer Timer(0);
+DueTimer Timer0(0);
+DueTimer Timer1(1);
+DueTimer Timer2(2);
+DueTimer Timer3(3);
+DueTimer Timer4(4);
+DueTimer Timer5(5);
+DueTimer Timer6(6);
+DueTimer Timer7(7);
+DueTimer Timer8(8);
+
+// -- Pins. Pin n is bit n%32 of port n/32, which keeps every pin on its own PIO_PDSR bit. The motor
+// pins 6-9 are on the PWM controller and 2-5 and 10-13 on timer-counter outputs, as on the Due.
+
+#define PIN(n) { &host_pio[(n)/32], 1UL << ((n)%32), 0, 0, NOT_ON_TIMER }
+#define PIN_PWM(n, ch) { &host_pio[(n)/32], 1UL << ((n)%32), PIN_ATTR_PWM, ch, NOT_ON_TIMER }
+#define PIN_TC(n, tc) { &host_pio[(n)/32], 1UL << ((n)%32), PIN_ATTR_TIMER, 0, tc }
+
+const PinDescription g_APinDescription[NUM_DIGITAL_PINS] = {
+  PIN(0), PIN(1), PIN_TC(2, TC0_CHA0), PIN_TC(3, TC2_CHA7), PIN_TC(4, TC2_CHB6), PIN_TC(5, TC2_CHA6),
+  PIN_PWM(6, 7), PIN_PWM(7, 6), PIN_PWM(8, 5), PIN_PWM(9, 4),
+  PIN_TC(10, TC2_CHB7), PIN_TC(11, TC2_CHA8), PIN_TC(12, TC2_CHB8), PIN_TC(13, TC0_CHB0),
+  PIN(14), PIN(15), PIN(16), PIN(17), PIN(18), PIN(19), PIN(20), PIN(21), PIN(22), PIN(23),
+  PIN(24), PIN(25), PIN(26), PIN(27), PIN(28), PIN(29), PIN(30), PIN(31), PIN(32), PIN(33),
+  PIN(34), PIN(35), PIN(36), PIN(37), PIN(38), PIN(39), PIN(40), PIN(41), PIN(42), PIN(43),
+  PIN(44), PIN(45), PIN(46), PIN(47), PIN(48), PIN(49), PIN(50), PIN(51), PIN(52), PIN(53),
+  PIN(54), PIN(55), PIN(56), PIN(57), PIN(58), PIN(59), PIN(60), PIN(61), PIN(62), PIN(63),
+  PIN(64), PIN(65), PIN(66), PIN(67), PIN(68), PIN(69), PIN(70), PIN(71), PIN(72), PIN(73),
+  PIN(74), PIN(75), PIN(76), PIN(77), PIN(78), PIN(79), PIN(80), PIN(81), PIN(82), PIN(83),
+  PIN(84), PIN(85), PIN(86), PIN(87), PIN(88), PIN(89), PIN(90), PIN(91)
+};
+
+static uint8_t pin_mode[NUM_DIGITAL_PINS];
+static uint8_t pin_output[NUM_DIGITAL_PINS];     // Level last written.
+static uint8_t pin_input[NUM_DIGITAL_PINS];      // Level set by the host, or the pull.
+static uint8_t pin_input_set[NUM_DIGITAL_PINS];  // The host has set pin_input.
+static void (*pin_handler[NUM_DIGITAL_PINS])(void);
+static uint8_t pin_irq_mode[NUM_DIGITAL_PINS];
+
+static uint32_t ee_sda_pin = NUM_DIGITAL_PINS;
+static uint32_t ee_scl_pin = NUM_DIGITAL_PINS;
+static void ee_bus_update(void);
+static uint8_t ee_sda_line(void);
+
+static uint8_t pin_value(uint32_t pin)
+{
+  if (pin == ee_sda_pin) { return(ee_sda_line()); }
+  if (pin_mode[pin] == OUTPUT) { return(pin_output[pin]); }
+  return(pin_input[pin]);
+}
+
+static void pin_refresh(uint32_t pin)
+{
+  const PinDescription *desc = &g_APinDescription[pin];
+  if (pin_value(pin)) { desc->pPort->PIO_PDSR |= desc->ulPin; }
+  else { desc->pPort->PIO_PDSR &= ~desc->ulPin; }
+}
+
+void pinMode(uint32_t pin, uint32_t mode)
+{
+  if (pin >= NUM_DIGITAL_PINS) { return; }
+  pin_mode[pin] = mode;
+  if (!pin_input_set[pin]) { pin_input[pin] = (mode == INPUT_PULLUP); }
+  if ((pin == ee_sda_pin) || (pin == ee_scl_pin)) { ee_bus_update(); }
+  pin_refresh(pin);
+}
+
+void digitalWrite(uint32_t pin, uint32_t level)
+{
+  if (pin >= NUM_DIGITAL_PINS) { return; }
+  pin_output[pin] = (level != LOW);
+  if ((pin == ee_sda_pin) || (pin == ee_scl_pin)) { ee_bus_update(); }
+  pin_refresh(pin);
+}
+
+int digitalRead(uint32_t pin)
+{
+  if (pin >= NUM_DIGITAL_PINS) { return(LOW); }
+  return(pin_value(pin));
+}
+
+void analogWrite(uint32_t pin, uint32_t value)
+{
+  if (pin >= NUM_DIGITAL_PINS) { return; }
+  pin_mode[pin] = OUTPUT;
+  pin_output[pin] = (value != 0);
+  pin_refresh(pin);
+  const PinDescription *desc = &g_APinDescription[pin];
+  if (desc->ulPinAttribute & PIN_ATTR_PWM) { host_pwm.PWM_CH_NUM[desc->ulPWMChannel].PWM_CDTYUPD = value; }
+}
+
+void attachInterrupt(uint32_t pin, void (*handler)(void), uint32_t mode)
+{
+  if (pin >= NUM_DIGITAL_PINS) { return; }
+  pin_handler[pin] = handler;
+  pin_irq_mode[pin] = mode;
+}
+
+void detachInterrupt(uint32_t pin)
+{
+  if (pin >= NUM_DIGITAL_PINS) { return; }
+  pin_handler[pin] = NULL;
+}
+
+void host_pin_set(uint32_t pin, uint8_t level)
+{
+  if (pin >= NUM_DIGITAL_PINS) { return; }
+  uint8_t before = pin_value(pin);
+  pin_input[pin] = (level != LOW);
+  pin_input_set[pin] = true;
+  pin_refresh(pin);
+  uint8_t after = pin_value(pin);
+  if ((after == before) || (pin_handler[pin] == NULL)) { return; }
+  if ((pin_irq_mode[pin] == CHANGE) || ((pin_irq_mode[pin] == RISING) && after) ||
+      ((pin_irq_mode[pin] == FALLING) && !after)) {
+    pin_handler[pin]();
+  }
+}
+
+uint8_t host_pin_level(uint32_t pin)
+{
+  if (pin >= NUM_DIGITAL_PINS) { return(LOW); }
+  return(pin_value(pin));
+}
+
+// -- 24LC256. Follows the bus on every write to the two pins: a start or stop while SCL is high,
+// data bits clocked in on the rising edge, and its own acknowledge and read bits put out after
+// the falling edge. Page writes wrap in their 64 byte page, reads run on through the memory.
+
+uint8_t host_eeprom[HOST_EEPROM_SIZE];
+
+enum { EE_IDLE, EE_CONTROL, EE_ADDR_HIGH, EE_ADDR_LOW, EE_WRITE, EE_READ };
+
+static uint8_t ee_state = EE_IDLE;
+static uint8_t ee_bits;          // Bits of the current byte clocked. 9 in the acknowledge clock of a read.
+static uint8_t ee_shift;         // Byte coming in, or going out.
+static uint8_t ee_acking;        // The EEPROM holds SDA low to acknowledge a byte.
+static uint8_t ee_master_ack;    // Acknowledge of the master to the last byte read.
+static uint16_t ee_addr;
+static uint8_t ee_sda_slave = 1; // Level the EEPROM drives. The line is the wired AND.
+static uint8_t ee_last_sda = 1;
+static uint8_t ee_last_scl = 1;
+
+static uint8_t ee_sda_master(void)
+{
+  if (pin_mode[ee_sda_pin] != OUTPUT) { return(1); } // Released to the pull-up.
+  return(pin_output[ee_sda_pin]);
+}
+
+static uint8_t ee_scl_master(void)
+{
+  if (pin_mode[ee_scl_pin] != OUTPUT) { return(1); }
+  return(pin_output[ee_scl_pin]);
+}
+
+static uint8_t ee_sda_line(void) { return(ee_sda_master() & ee_sda_slave); }
+
+static void ee_byte_received(void)
+{
+  switch (ee_state) {
+    case EE_CONTROL:
+      ee_state = (ee_shift & 1) ? EE_READ : EE_ADDR_HIGH;
+      break;
+    case EE_ADDR_HIGH:
+      ee_addr = (uint16_t)(ee_shift << 8);
+      ee_state = EE_ADDR_LOW;
+      break;
+    case EE_ADDR_LOW:
+      ee_addr = (ee_addr | ee_shift) % HOST_EEPROM_SIZE;
+      ee_state = EE_WRITE;
+      break;
+    case EE_WRITE:
+      host_eeprom[ee_addr] = ee_shift;
+      ee_addr = (ee_addr & ~63) | ((ee_addr + 1) & 63);
+      break;
+  }
+}
+
+static void ee_read_next(void)
+{
+  ee_shift = host_eeprom[ee_addr];
+  ee_addr = (ee_addr + 1) % HOST_EEPROM_SIZE;
+  ee_bits = 0;
+  ee_sda_slave = ee_shift >> 7;
+}
+
+static void ee_bus_update(void)
+{
+  if ((ee_sda_pin >= NUM_DIGITAL_PINS) || (ee_scl_pin >= NUM_DIGITAL_PINS)) { return; }
+  uint8_t sda = ee_sda_line();
+  uint8_t scl = ee_scl_master();
+
+  if (scl && ee_last_scl && (sda != ee_last_sda)) {
+    ee_state = sda ? EE_IDLE : EE_CONTROL; // Stop, or start.
+    ee_bits = 0;
+    ee_acking = false;
+    ee_sda_slave = 1;
+  } else if (scl && !ee_last_scl && !ee_acking) {
+    if (ee_state == EE_READ) {
+      if (ee_bits < 8) { ee_bits++; }
+      else if (ee_bits == 9) { ee_master_ack = !sda; }
+    } else if ((ee_state != EE_IDLE) && (ee_bits < 8)) {
+      ee_shift = (ee_shift << 1) | sda;
+      ee_bits++;
+    }
+  } else if (!scl && ee_last_scl && (ee_state != EE_IDLE)) {
+    if (ee_acking) {
+      ee_acking = false;
+      ee_sda_slave = 1;
+      ee_bits = 0;
+      if (ee_state == EE_READ) { ee_read_next(); }
+    } else if (ee_state == EE_READ) {
+      if (ee_bits < 8) { ee_sda_slave = (ee_shift >> (7 - ee_bits)) & 1; }
+      else if (ee_bits == 8) { ee_sda_slave = 1; ee_bits = 9; } // The master acknowledges next.
+      else if (ee_master_ack) { ee_read_next(); }
+      else { ee_state = EE_IDLE; }  // Let go until the stop.
+    } else if (ee_bits == 8) {
+      ee_byte_received();
+      ee_sda_slave = 0;
+      ee_acking = true;
+    }
+  }
+  ee_last_sda = ee_sda_line();
+  ee_last_scl = scl;
+}
+
+void host_eeprom_attach(uint32_t sda_pin, uint32_t scl_pin)
+{
+  memset(host_eeprom, 0xFF, sizeof(host_eeprom));
+  ee_sda_pin = sda_pin;
+  ee_scl_pin = scl_pin;
+}
+
+// -- Serial
+
+void (*host_serial_sink)(uint8_t c) = NULL;
+
+static uint8_t rx_buffer[HOST_SERIAL_BUFFER_SIZE];
+static volatile uint32_t rx_head, rx_tail;
+static uint8_t tx_buffer[HOST_SERIAL_BUFFER_SIZE];
+static volatile uint32_t tx_head, tx_tail;
+
+int host_serial_rx_room(void) { return(HOST_SERIAL_BUFFER_SIZE - 1 - (int)(rx_head - rx_tail)); }
+
+void host_serial_receive(uint8_t c)
+{
+  if (host_serial_rx_room() <= 0) { return; } // Overrun, as the core drops it.
+  rx_buffer[rx_head % HOST_SERIAL_BUFFER_SIZE] = c;
+  rx_head = rx_head + 1;
+}
+
+int host_serial_transmit(void)
+{
+  if (tx_tail == tx_head) { return(-1); }
+  uint8_t c = tx_buffer[tx_tail % HOST_SERIAL_BUFFER_SIZE];
+  tx_tail = tx_tail + 1;
+  return(c);
+}
+
+HostSerial Serial;
+HostSerial SerialUSB;
+
+void HostSerial::begin(unsigned long) { }
+int HostSerial::available(void) { return((int)(rx_head - rx_tail)); }
+
+int HostSerial::read(void)
+{
+  if (rx_head == rx_tail) { return(-1); }
+  uint8_t c = rx_buffer[rx_tail % HOST_SERIAL_BUFFER_SIZE];
+  rx_tail = rx_tail + 1;
+  return(c);
+}
+
+int HostSerial::peek(void)
+{
+  if (rx_head == rx_tail) { return(-1); }
+  return(rx_buffer[rx_tail % HOST_SERIAL_BUFFER_SIZE]);
+}
+
+int HostSerial::availableForWrite(void)
+{
+  if (host_serial_sink != NULL) { return(HOST_SERIAL_BUFFER_SIZE - 1); }
+  return(HOST_SERIAL_BUFFER_SIZE - 1 - (int)(tx_head - tx_tail));
+}
+
+// The firmware writes from its main loop and from the serial scanner, which can interrupt it. As
+// in the core, a byte goes in with interrupts off, so the two never take the same place.
+size_t HostSerial::write(uint8_t c)
+{
+  for (;;) {
+    uint8_t masked = host_irq_masked;
+    host_irq_masked = true;
+    uint8_t written = (availableForWrite() > 0);
+    if (written) {
+      if (host_serial_sink != NULL) { host_serial_sink(c); }
+      else {
+        tx_buffer[tx_head % HOST_SERIAL_BUFFER_SIZE] = c;
+        tx_head = tx_head + 1;
+      }
+    }
+    if (masked) { host_irq_masked = true; }
+    else { interrupts(); }
+    if (written) { return(1); }
+    // Full. Blocks, as the core does, until the host takes a byte.
+  }
+}
+
+size_t HostSerial::print(const char *s)
+{
+  size_t n = 0;
+  while (*s) { n += write(*s++); }
+  return(n);
+}
+
+size_t HostSerial::print(char c) { return(write(c)); }
+
+size_t HostSerial::print(long value, int base)
+{
+  char buf[24];
+  if (base == HEX) { snprintf(buf, sizeof(buf), "%lX", value); }
+  else { snprintf(buf, sizeof(buf), "%ld", value); }
+  return(print(buf));
+}
+
+size_t HostSerial::print(unsigned long value, int base)
+{
+  char buf[24];
+  snprintf(buf, sizeof(buf), (base == HEX) ? "%lX" : "%lu", value);
+  return(print(buf));
+}
+
+size_t HostSerial::print(double value, int digits)
+{
+  char buf[40];
+  snprintf(buf, sizeof(buf), "%.*f", digits, value);
+  return(print(buf));
+}
+
+long HostSerial::parseInt(void)
+{
+  long value = 0;
+  int c, sign = 1;
+  while (((c = peek()) >= 0) && (c != '-') && ((c < '0') || (c > '9'))) { read(); }
+  if (peek() == '-') { sign = -1; read(); }
+  while (((c = peek()) >= '0') && (c <= '9')) { value = 10*value + (c - '0'); read(); }
+  return(sign*value);
+}
+
+float HostSerial::parseFloat(void)
+{
+  char buf[32];
+  uint8_t n = 0;
+  int c;
+  while (((c = peek()) >= 0) && (c != '-') && (c != '.') && ((c < '0') || (c > '9'))) { read(); }
+  while ((n < sizeof(buf)-1) && ((c = peek()) >= 0) && ((c == '-') || (c == '.') || ((c >= '0') && (c <= '9')))) {
+    buf[n++] = (char)read();
+  }
+  buf[n] = 0;
+  return(strtof(buf, NULL));
+}
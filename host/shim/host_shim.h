@@ -0,0 +1,65 @@
+/* This file is part of the Maslow Due Control Software.
+    The Maslow Due Control Software is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Maslow Due Control Software is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with the Maslow Control Software.  If not, see <http://www.gnu.org/licenses/>.
+
+    host_shim.h - the host side of the Arduino shim: the clock, interrupt masking, the DueTimer
+    objects, pins, the shield EEPROM and the machine serial port, as seen by the host programs.
+    */
+
+#ifndef host_shim_h
+#define host_shim_h
+
+#include "Arduino.h"
+
+// Clock. micros() and millis() read host_now_ns(), the monotonic host clock unless a program
+// installs its own, as the simulator does. delay() and delayMicroseconds() wait on that clock,
+// unless host_skip_delays is set, when they return at once.
+void host_set_clock(uint64_t (*now_ns)(void));
+uint64_t host_now_ns(void);
+extern uint8_t host_skip_delays;
+
+// Interrupt masking. host_irq_masked is set between noInterrupts() and interrupts(). The hook,
+// if set, runs when interrupts() unmasks them, so interrupts held off meanwhile can be taken.
+extern volatile uint8_t host_irq_masked;
+extern void (*host_irq_unmask_hook)(void);
+
+// DueTimer objects, as the firmware set them up. Timer n is DueTimer object Timern.
+#define HOST_TIMERS 9
+struct host_timer_t {
+  void (*handler)(void);
+  uint32_t period_us;  // Of the last start(), setPeriod() or setFrequency(). Rounded to 1us.
+  uint8_t running;
+  uint32_t changes;    // Bumped by every start, stop or period change.
+};
+extern host_timer_t host_timers[HOST_TIMERS];
+
+// Pins. An input follows host_pin_set(), which sets its PIO_PDSR bit and runs its attached
+// interrupt handler on a matching edge. Outputs read back the level last written.
+void host_pin_set(uint32_t pin, uint8_t level);
+uint8_t host_pin_level(uint32_t pin);
+
+// 24LC256 on the two bit-banged pins of the shield, erased (0xFF) at start.
+#define HOST_EEPROM_SIZE 32768
+void host_eeprom_attach(uint32_t sda_pin, uint32_t scl_pin);
+extern uint8_t host_eeprom[HOST_EEPROM_SIZE];
+
+// Machine serial port (Serial and SerialUSB). The host writes received bytes with
+// host_serial_receive() while there is room in the core's receive buffer. Sent bytes go to
+// host_serial_sink when it is set, otherwise they queue in the transmit buffer for
+// host_serial_transmit(), which returns -1 when empty.
+#define HOST_SERIAL_BUFFER_SIZE 128
+int host_serial_rx_room(void);
+void host_serial_receive(uint8_t c);
+int host_serial_transmit(void);
+extern void (*host_serial_sink)(uint8_t c);
+
+#endif
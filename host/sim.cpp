@@ -0,0 +1,580 @@
+/* This file is part of the Maslow Due Control Software.
+    The Maslow Due Control Software is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Maslow Due Control Software is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with the Maslow Control Software.  If not, see <http://www.gnu.org/licenses/>.
+
+    sim.cpp - runs a g-code job through the whole firmware, with simulated motors, in simulated time.
+
+      maslow_sim [options] job.nc
+        --scale N     Due time per host time, SIM_SCALE by default
+        --baud N      serial rate, BAUD_RATE by default
+        --status MS   '?' status poll period, 200ms by default. 0 for none.
+        --timeout S   simulated seconds before giving up, 3600 by default
+        -e LINE       sends LINE before the job, e.g. -e '$120=400'. Repeatable.
+        -v            prints the firmware's output after the run
+
+    The firmware boots as at power-up, with an erased EEPROM, and protocol_main_loop() runs
+    against a sender streaming the job with character counting on the serial port. The sender
+    first sends $H, which sets the chains to their home lengths ($94). The simulator runs the DueTimer handlers, the serial line and the motors in time order, as
+    interrupts, whenever the firmware reads the clock or unmasks interrupts, and from a host
+    signal every SIM_SIGNAL_US. Each motor is a gearmotor with a first order speed response to the
+    PWM level compute_PID() left, turning its encoder, whose edges run the encoder interrupts.
+
+    Simulated time is host time the firmware ran, times the scale. The simulator's own work, and
+    time the host did not run the process, are left out. The scale stands in for the Due being
+    slower than the host: calibrate it as the mean triangularInverse() time of $K on the machine
+    over the maslow_bench figure. Encoder interrupts take no simulated time.
+
+    Exits non-zero on an error response, an alarm or the timeout.
+    */
+
+#include <math.h>
+#include <signal.h>
+#include <stdio.h>
+#include <sys/time.h>
+#include <time.h>
+#include "harness.h"
+
+void setup(void);
+void loop(void);
+void MotorPID_Timer_handler(void);
+
+#define SIM_SCALE 200        // Estimate, in the absence of on-target timings. See above.
+#define SIM_SIGNAL_US 25     // Host time between signals.
+#define SIM_PLANT_US 100     // Motor model step.
+#define SIM_IDLE_MS 100      // Idle, with every line answered, for the job to be done.
+#define SIM_ERRORS 10        // Error responses listed.
+#define SIM_LOG_SIZE (1 << 22)
+
+#ifdef USE_NATIVE_USB_PORT
+  #define SIM_BAUD 10000000  // Not paced by a baud rate. About the USB full speed bulk rate.
+#else
+  #define SIM_BAUD BAUD_RATE
+#endif
+
+static double scale = SIM_SCALE;
+static uint32_t baud = SIM_BAUD;
+static uint32_t status_ms = 200;
+static double timeout_s = 3600;
+static uint8_t verbose = false;
+
+// -- Clock. In ns.
+
+static volatile uint8_t in_events;     // Simulator running. Holds off the signal and the hooks.
+static uint64_t host_start;
+static uint64_t host_excluded;         // Host time of the simulator itself, and not running.
+static uint64_t sim_latest;            // Last time given out. The clock never runs back.
+static uint64_t event_time;            // Of the event being run.
+static uint64_t event_host_start;      // Host time the event's firmware handler was entered.
+
+static uint64_t sim_time(uint64_t host)
+{
+  uint64_t ran = host - host_start;
+  uint64_t t = (ran > host_excluded) ? (uint64_t)((ran - host_excluded)*scale) : 0;
+  if (t < sim_latest) { t = sim_latest; }
+  sim_latest = t;
+  return(t);
+}
+
+static uint64_t host_cpu_ns(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+  return((uint64_t)now.tv_sec*1000000000ULL + now.tv_nsec);
+}
+
+// -- Motors. Position in counts, speed in counts/sec.
+
+struct sim_motor_t {
+  struct PID_MOTION *axis;
+  uint32_t pin_a, pin_b, pin_enable;
+  double max_speed;
+  double speed;
+  double position;
+  int32_t count;  // Counted out to the encoder so far.
+};
+
+static sim_motor_t motors[N_AXIS] = {
+  { &x_axis, Encoder_XA, Encoder_XB, X_ENABLE, MOTOR_SIM_MAX_SPEED_XY },
+  { &y_axis, Encoder_YA, Encoder_YB, Y_ENABLE, MOTOR_SIM_MAX_SPEED_XY },
+  { &z_axis, Encoder_ZA, Encoder_ZB, Z_ENABLE, MOTOR_SIM_MAX_SPEED_Z }
+};
+
+// Quadrature states, (A << 1) | B, in the order that counts up.
+static const uint8_t gray[4] = { 0, 1, 3, 2 };
+
+static void motor_encoder(sim_motor_t *motor)
+{
+  int32_t count = (int32_t)floor(motor->position);
+  while (motor->count != count) {
+    motor->count += (count > motor->count) ? 1 : -1;
+    uint8_t state = gray[motor->count & 3];
+    host_pin_set(motor->pin_a, state >> 1);
+    host_pin_set(motor->pin_b, state & 1);
+  }
+}
+
+static void motor_step(sim_motor_t *motor, double dt)
+{
+  double target = 0;
+  int pwm = abs(motor->axis->PWM_out);
+  #ifdef DRIVER_TLE5206
+    uint8_t enabled = !Motors_Disabled;
+  #else
+    uint8_t enabled = host_pin_level(motor->pin_enable);
+  #endif
+  if (enabled && (pwm > MOTOR_SIM_DEADBAND)) {
+    target = motor->max_speed*(pwm - MOTOR_SIM_DEADBAND)/(MAX_PWM_LEVEL - MOTOR_SIM_DEADBAND);
+    if (motor->axis->PWM_out < 0) { target = -target; }
+  }
+  motor->speed += (target - motor->speed)*(1.0 - exp(-dt/(MOTOR_SIM_TIME_CONSTANT*1.0e-3)));
+  motor->position += motor->speed*dt;
+  motor_encoder(motor);
+}
+
+// -- Sender. Lines without their newline, as they are streamed.
+
+static char **stream;
+static uint32_t *stream_number;        // Line number in the job file. 0 before the job.
+static uint32_t stream_lines, job_first;
+static uint32_t send_line, send_pos;   // Next byte to send.
+static uint32_t acked;                 // Lines answered.
+static uint32_t in_flight;             // Bytes sent and not answered.
+static uint8_t welcome, status_due;
+static uint64_t status_next;
+
+static char response[256];
+static uint32_t response_length;
+static char *log_text;
+static uint32_t log_length;
+
+static uint32_t error_count, errors_listed;
+static char error_text[SIM_ERRORS][96];
+static uint8_t alarm_code;
+static uint32_t rx_overruns;
+
+// -- Job statistics
+
+static volatile uint8_t done;
+static uint8_t timed_out;
+static uint64_t job_start, job_end, idle_since;
+static uint8_t job_running;
+static uint64_t cycle_ns;
+static uint32_t samples, saturated[N_AXIS];
+static double error_max[N_AXIS], error_sum[N_AXIS];
+static double sled_max, sled_sum;
+static float sled_seed[2][2];          // Commanded and measured.
+static uint32_t blocks;
+static double path_mm, programmed_min;
+static plan_block_t *last_block;
+static sys_starvation_t starvation_start;
+
+static void job_begin(void)
+{
+  job_running = true;
+  job_start = event_time;
+  memcpy(&starvation_start, &sys_starvation, sizeof(sys_starvation));
+}
+
+static void job_finish(uint64_t t)
+{
+  job_running = false;
+  job_end = t;
+  done = true;
+}
+
+static void sender_response(void)
+{
+  response[response_length] = 0;
+  if ((log_text != NULL) && (log_length + response_length + 1 < SIM_LOG_SIZE)) {
+    memcpy(log_text + log_length, response, response_length);
+    log_length += response_length;
+    log_text[log_length++] = '\n';
+  }
+
+  if (strncmp(response, "Grbl ", 5) == 0) {
+    welcome = true;
+  } else if ((strcmp(response, "ok") == 0) || (strncmp(response, "error:", 6) == 0)) {
+    if (acked >= send_line) { return; } // Not ours.
+    if (response[0] == 'e') {
+      error_count++;
+      if (errors_listed < SIM_ERRORS) {
+        // error:NN and 60 characters of the line fit error_text with any line number.
+        if (stream_number[acked]) {
+          snprintf(error_text[errors_listed++], 96, "line %u: %.12s: %.60s", stream_number[acked], response, stream[acked]);
+        } else {
+          snprintf(error_text[errors_listed++], 96, "%.12s: %.60s", response, stream[acked]);
+        }
+      }
+    }
+    in_flight -= strlen(stream[acked]) + 1;
+    acked++;
+  } else if (strncmp(response, "ALARM:", 6) == 0) {
+    alarm_code = atoi(response+6);
+    job_finish(event_time);
+  }
+}
+
+static void sender_receive(int c)
+{
+  if (c == '\r') { return; }
+  if (c == '\n') {
+    sender_response();
+    response_length = 0;
+  } else if (response_length < sizeof(response)-1) {
+    response[response_length++] = c;
+  }
+}
+
+// Next byte on the line to the firmware, or -1. Realtime '?' goes between bytes of a line, as
+// senders do. Lines before the job wait for the answer to the last.
+static int sender_next(void)
+{
+  if (!welcome) { return(-1); }
+  if (status_due) {
+    status_due = false;
+    return('?');
+  }
+  if (send_line >= stream_lines) { return(-1); }
+  uint32_t length = strlen(stream[send_line]);
+  if (send_pos == 0) {
+    if ((send_line < job_first) && (acked < send_line)) { return(-1); }
+    if (in_flight + length + 1 > RX_BUFFER_SIZE-1) { return(-1); }
+    in_flight += length + 1;
+    if (send_line == job_first) { job_begin(); }
+  }
+  if (send_pos < length) { return(stream[send_line][send_pos++]); }
+  send_line++;
+  send_pos = 0;
+  return('\n');
+}
+
+// -- Block and sample statistics
+
+// Every block the segment generator loads is first the current block. Each is counted once, as
+// motor_sim_block() would, at its programmed rate.
+extern "C" plan_block_t *__real__Z22plan_get_current_blockv(void);
+extern "C" plan_block_t *__wrap__Z22plan_get_current_blockv(void)
+{
+  plan_block_t *block = __real__Z22plan_get_current_blockv();
+  if ((block != NULL) && (block != last_block)) {
+    last_block = block;
+    if (job_running && !(sys.state & (STATE_HOMING | STATE_JOG))) {
+      blocks++;
+      path_mm += block->millimeters;
+      if (block->programmed_rate > 0) { programmed_min += block->millimeters/block->programmed_rate; }
+    }
+  }
+  return(block);
+}
+
+// Sled x-y of chain steps. False for lengths the forward solve would fail on, and print from here.
+static uint8_t sled_position(int32_t *steps, float *xy)
+{
+  float a = steps[LEFT_MOTOR]/settings.steps_per_mm[LEFT_MOTOR];
+  float b = steps[RIGHT_MOTOR]/settings.steps_per_mm[RIGHT_MOTOR];
+  if ((a <= 0) || (b <= 0) || (a >= settings.chainLength) || (b >= settings.chainLength)) { return(false); }
+  chainToPosition(a, b, &xy[X_AXIS], &xy[Y_AXIS]);
+  return(true);
+}
+
+// After each PID tick, in the cycle state.
+static void sample(void)
+{
+  if (!job_running || (sys.state != STATE_CYCLE)) { return; }
+  samples++;
+  for (uint8_t idx = 0; idx < N_AXIS; idx++) {
+    double error = labs(motors[idx].axis->Error)/settings.steps_per_mm[idx];
+    if (error > error_max[idx]) { error_max[idx] = error; }
+    error_sum[idx] += error;
+    if (abs(motors[idx].axis->PWM_out) >= MAX_PWM_LEVEL) { saturated[idx]++; }
+  }
+
+  int32_t measured[N_AXIS];
+  system_get_measured_position(measured);
+  if (!sled_position(sys_position, sled_seed[0]) || !sled_position(measured, sled_seed[1])) { return; }
+  double error = hypot(sled_seed[0][X_AXIS] - sled_seed[1][X_AXIS], sled_seed[0][Y_AXIS] - sled_seed[1][Y_AXIS]);
+  if (error > sled_max) { sled_max = error; }
+  sled_sum += error;
+}
+
+// -- Events
+
+struct sim_timer_t {
+  uint32_t changes;
+  uint64_t next;
+};
+static sim_timer_t timers[HOST_TIMERS];
+static uint64_t plant_next, rx_next, tx_next;
+
+static void timers_sync(uint64_t base)
+{
+  for (int i = 0; i < HOST_TIMERS; i++) {
+    if (timers[i].changes != host_timers[i].changes) {
+      timers[i].changes = host_timers[i].changes;
+      timers[i].next = base + 1000ULL*host_timers[i].period_us;
+    }
+  }
+}
+
+// Runs a firmware interrupt handler at event_time. Returns its host time.
+static uint64_t run_handler(void (*handler)(void))
+{
+  host_irq_masked = true;
+  event_host_start = harness_ns();
+  handler();
+  if (handler == MotorPID_Timer_handler) { sample(); }
+  uint64_t spent = harness_ns() - event_host_start;
+  host_irq_masked = false;
+  return(spent);
+}
+
+static void plant(uint64_t t)
+{
+  host_irq_masked = true;
+  for (uint8_t idx = 0; idx < N_AXIS; idx++) { motor_step(&motors[idx], SIM_PLANT_US*1.0e-6); }
+  host_irq_masked = false;
+
+  if (job_running && (sys.state == STATE_CYCLE)) { cycle_ns += 1000ULL*SIM_PLANT_US; }
+  if (status_ms && (t >= status_next)) {
+    status_due = welcome;
+    status_next = t + 1000000ULL*status_ms;
+  }
+  if (job_running && (acked == stream_lines) && (sys.state == STATE_IDLE) &&
+      (__real__Z22plan_get_current_blockv() == NULL)) {
+    if (idle_since == 0) { idle_since = t; }
+    else if (t - idle_since >= 1000000ULL*SIM_IDLE_MS) { job_finish(idle_since); }
+  } else {
+    idle_since = 0;
+  }
+  if (t > (uint64_t)(timeout_s*1.0e9)) {
+    timed_out = true;
+    job_finish(t);
+    mc_reset(); // As ctrl-x, so the main loop returns from waits on the planner.
+    mc_reset(); // As ctrl-x, so the main loop returns from waits on the planner.
+  }
+}
+
+// Runs every event due by now, in time order. Returns the host time of the firmware handlers.
+static uint64_t run_events(uint64_t now)
+{
+  uint64_t firmware = 0;
+  uint64_t byte_ns = 10000000000ULL/baud;
+  timers_sync(now);
+  while (!done) {
+    int which = -1;
+    uint64_t t = plant_next;
+    for (int i = 0; i < HOST_TIMERS; i++) {
+      if (host_timers[i].running && (host_timers[i].handler != NULL) && (timers[i].next < t)) {
+        t = timers[i].next;
+        which = i;
+      }
+    }
+    if (rx_next < t) { t = rx_next; which = HOST_TIMERS; }
+    if (tx_next < t) { t = tx_next; which = HOST_TIMERS+1; }
+    if (t > now) { break; }
+    event_time = t;
+
+    if (which < 0) {
+      plant(t);
+      plant_next += 1000ULL*SIM_PLANT_US;
+    } else if (which < HOST_TIMERS) {
+      uint64_t period = 1000ULL*host_timers[which].period_us;
+      do { timers[which].next += period; } while (timers[which].next <= t); // Missed ticks are lost.
+      firmware += run_handler(host_timers[which].handler);
+      timers_sync(t);
+    } else if (which == HOST_TIMERS) {
+      int c = sender_next();
+      if (c >= 0) {
+        if (host_serial_rx_room() > 0) { host_serial_receive(c); }
+        else { rx_overruns++; }
+      }
+      rx_next += byte_ns;
+    } else {
+      int c = host_serial_transmit();
+      if (c >= 0) { sender_receive(c); }
+      tx_next += byte_ns;
+    }
+  }
+  return(firmware);
+}
+
+static uint64_t sim_service(uint8_t deliver)
+{
+  in_events = true;
+  uint64_t entry = harness_ns();
+  uint64_t firmware = deliver ? run_events(sim_time(entry)) : 0;
+  uint64_t exit = harness_ns();
+  host_excluded += (exit - entry) - firmware;
+  uint64_t now = sim_time(exit);
+  in_events = false;
+  return(now);
+}
+
+static uint64_t sim_clock(void)
+{
+  if (in_events) { return(event_time + (uint64_t)((harness_ns() - event_host_start)*scale)); }
+  return(sim_service(!host_irq_masked));
+}
+
+static void sim_unmask(void)
+{
+  if (!in_events) { sim_service(true); }
+}
+
+// Also leaves out host time the process was not running: wall time past its CPU time.
+static uint64_t signal_wall, signal_cpu;
+
+static void sim_signal(int)
+{
+  if (in_events) { return; }
+  uint64_t wall = harness_ns();
+  uint64_t cpu = host_cpu_ns();
+  if (signal_wall && (wall - signal_wall > cpu - signal_cpu)) {
+    host_excluded += (wall - signal_wall) - (cpu - signal_cpu);
+  }
+  signal_wall = wall;
+  signal_cpu = cpu;
+  sim_service(!host_irq_masked);
+}
+
+// -- Job file
+
+static uint32_t stream_add(const char *line, uint32_t number)
+{
+  stream = (char **)realloc(stream, (stream_lines+1)*sizeof(char *));
+  stream_number = (uint32_t *)realloc(stream_number, (stream_lines+1)*sizeof(uint32_t));
+  stream[stream_lines] = strdup(line);
+  stream_number[stream_lines] = number;
+  return(stream_lines++);
+}
+
+// Streams the file as senders do: without comments, blank lines and '%' delimiters.
+static uint8_t job_load(const char *path)
+{
+  FILE *file = fopen(path, "r");
+  if (file == NULL) { return(false); }
+  char text[512], line[512];
+  uint32_t number = 0;
+  while (fgets(text, sizeof(text), file) != NULL) {
+    number++;
+    uint32_t length = 0;
+    uint8_t comment = false;
+    for (char *c = text; *c && (*c != '\n') && (*c != '\r') && (*c != ';'); c++) {
+      if (*c == '(') { comment = true; }
+      else if (*c == ')') { comment = false; }
+      else if (!comment && (*c != '%') && ((*c != ' ') || length)) { line[length++] = *c; }
+    }
+    while (length && (line[length-1] == ' ')) { length--; }
+    line[length] = 0;
+    if (length) { stream_add(line, number); }
+  }
+  fclose(file);
+  return(true);
+}
+
+// -- Report
+
+static void report(const char *path, uint64_t host_ns)
+{
+  uint32_t job_lines = stream_lines - job_first;
+  double job_s = (job_end - job_start)*1.0e-9;
+  double cycle_s = cycle_ns*1.0e-9;
+
+  printf("%s: %u lines, %u errors", path, job_lines, error_count);
+  if (alarm_code) { printf(", ALARM:%u", alarm_code); }
+  if (timed_out) { printf(", timed out"); }
+  printf("\n");
+  for (uint32_t i = 0; i < errors_listed; i++) { printf("  %s\n", error_text[i]); }
+
+  printf("job time            %.2f s, %.2f s in cycle\n", job_s, cycle_s);
+  printf("blocks              %u, %.1f mm\n", blocks, path_mm);
+  printf("feed, commanded     %.1f mm/min, %.2f s at the programmed rates\n",
+         (programmed_min > 0) ? path_mm/programmed_min : 0.0, programmed_min*60);
+  printf("feed, achieved      %.1f mm/min, over the cycle time\n", (cycle_s > 0) ? path_mm*60/cycle_s : 0.0);
+  printf("following error     ");
+  for (uint8_t idx = 0; idx < N_AXIS; idx++) {
+    printf("%c max %.3f mean %.3f mm%s", "XYZ"[idx], error_max[idx],
+           samples ? error_sum[idx]/samples : 0.0, (idx < N_AXIS-1) ? ", " : "\n");
+  }
+  printf("sled error          max %.3f mean %.3f mm\n", sled_max, samples ? sled_sum/samples : 0.0);
+  printf("PWM at limit        ");
+  for (uint8_t idx = 0; idx < N_AXIS; idx++) {
+    printf("%c %.1f%%%s", "XYZ"[idx], samples ? 100.0*saturated[idx]/samples : 0.0, (idx < N_AXIS-1) ? ", " : " of the PID ticks\n");
+  }
+  printf("starvation          %u segment underruns, %u planner empty, %u rx empty, %u ms planner wait\n",
+         sys_starvation.segment_underruns - starvation_start.segment_underruns,
+         sys_starvation.planner_empty - starvation_start.planner_empty,
+         sys_starvation.rx_empty - starvation_start.rx_empty,
+         sys_starvation.planner_wait_ms - starvation_start.planner_wait_ms);
+  if (rx_overruns) { printf("serial              %u bytes overrun\n", rx_overruns); }
+  printf("host                %.2f s for %.2f s simulated, scale %.0f, %u baud\n",
+         host_ns*1.0e-9, sim_latest*1.0e-9, scale, baud);
+}
+
+static void usage(void)
+{
+  printf("usage: maslow_sim [--scale N] [--baud N] [--status MS] [--timeout S] [-e LINE]... [-v] job.nc\n");
+}
+
+int main(int argc, char **argv)
+{
+  const char *path = NULL;
+  stream_add("$H", 0);
+  for (int i = 1; i < argc; i++) {
+    if ((strcmp(argv[i], "--scale") == 0) && (i+1 < argc)) { scale = atof(argv[++i]); }
+    else if ((strcmp(argv[i], "--baud") == 0) && (i+1 < argc)) { baud = atoi(argv[++i]); }
+    else if ((strcmp(argv[i], "--status") == 0) && (i+1 < argc)) { status_ms = atoi(argv[++i]); }
+    else if ((strcmp(argv[i], "--timeout") == 0) && (i+1 < argc)) { timeout_s = atof(argv[++i]); }
+    else if ((strcmp(argv[i], "-e") == 0) && (i+1 < argc)) { stream_add(argv[++i], 0); }
+    else if (strcmp(argv[i], "-v") == 0) { verbose = true; }
+    else if ((argv[i][0] != '-') && (path == NULL)) { path = argv[i]; }
+    else { usage(); return(2); }
+  }
+  if ((path == NULL) || (scale <= 0) || (baud == 0)) { usage(); return(2); }
+  job_first = stream_lines;
+  if (!job_load(path)) { printf("%s: cannot open\n", path); return(2); }
+  if (verbose) { log_text = (char *)malloc(SIM_LOG_SIZE); }
+
+  // Encoders at rest in state 00, before setup() reads them.
+  for (uint8_t idx = 0; idx < N_AXIS; idx++) {
+    host_pin_set(motors[idx].pin_a, LOW);
+    host_pin_set(motors[idx].pin_b, LOW);
+  }
+  host_eeprom_attach(SDApin, SCLpin);
+  host_skip_delays = true; // Boot delays only. The job's dwells take simulated time.
+  host_start = harness_ns();
+  host_set_clock(sim_clock);
+  host_irq_unmask_hook = sim_unmask;
+
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = sim_signal;
+  action.sa_flags = SA_RESTART;
+  sigaction(SIGALRM, &action, NULL);
+  struct itimerval period;
+  period.it_interval.tv_sec = 0;
+  period.it_interval.tv_usec = SIM_SIGNAL_US;
+  period.it_value = period.it_interval;
+  setitimer(ITIMER_REAL, &period, NULL);
+
+  setup();
+  host_skip_delays = false;
+  while (!done) { loop(); }
+
+  memset(&period, 0, sizeof(period));
+  setitimer(ITIMER_REAL, &period, NULL);
+  uint64_t host_ns = harness_ns() - host_start;
+
+  if (verbose) { fwrite(log_text, 1, log_length, stdout); }
+  report(path, host_ns);
+  return((error_count || alarm_code || timed_out) ? 1 : 0);
+}
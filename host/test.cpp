@@ -0,0 +1,112 @@
+/* This file is part of the Maslow Due Control Software.
+    The Maslow Due Control Software is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Maslow Due Control Software is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with the Maslow Control Software.  If not, see <http://www.gnu.org/licenses/>.
+
+    test.cpp - runs the g-code corpus through the parser, in check mode.
+
+      maslow_test [corpus]   gcode_corpus.txt by default. Exits non-zero if a line fails.
+
+    Each line runs three times from the same parser state: through the full parser alone, through
+    the modal fast path alone, and through gc_execute_line(). All three must give the expected
+    response, and the fast path, where it takes the line, must leave the parser state exactly as
+    the full parser does. gc_execute_line() then carries the state on to the next line.
+    */
+
+#include <stdio.h>
+#include "harness.h"
+
+static uint8_t parse_expected(const char *word, uint8_t *status)
+{
+  if (strcmp(word, "ok") == 0) { *status = STATUS_OK; return(true); }
+  if (strncmp(word, "error:", 6) == 0) { *status = atoi(word+6); return(true); }
+  return(false);
+}
+
+static void print_status(uint8_t status)
+{
+  if (status == STATUS_OK) { printf("ok"); }
+  else if (status == GC_FAST_PATH_DECLINED) { printf("declined"); }
+  else { printf("error:%d", status); }
+}
+
+int main(int argc, char **argv)
+{
+  const char *path = (argc > 1) ? argv[1] : "gcode_corpus.txt";
+  FILE *corpus = fopen(path, "r");
+  if (corpus == NULL) { printf("%s: cannot open\n", path); return(2); }
+
+  harness_boot();
+  sys.state = STATE_CHECK_MODE; // Parsed and checked as by $C, without motion.
+  gc_init();
+  gc_sync_position();
+
+  char text[256];
+  uint32_t number = 0, lines = 0, fast = 0, failures = 0;
+  while (fgets(text, sizeof(text), corpus) != NULL) {
+    number++;
+    text[strcspn(text, "\r\n")] = 0;
+    if ((text[0] == ';') || (text[strspn(text, " ")] == 0)) { continue; }
+
+    char word[32], line[LINE_BUFFER_SIZE] = "";
+    uint8_t expected;
+    if ((sscanf(text, "%31s %255s", word, line) < 1) || !parse_expected(word, &expected)) {
+      printf("%s:%u: bad corpus line\n", path, number);
+      failures++;
+      continue;
+    }
+    lines++;
+
+    parser_state_t before, after_full;
+    memcpy(&before, &gc_state, sizeof(gc_state));
+    char buffer[LINE_BUFFER_SIZE];
+
+    strcpy(buffer, line);
+    uint8_t full = gc_execute_full_line(buffer);
+    memcpy(&after_full, &gc_state, sizeof(gc_state));
+
+    uint8_t taken = GC_FAST_PATH_DECLINED;
+    uint8_t same_state = true;
+    #ifdef GCODE_MODAL_FAST_PATH
+      memcpy(&gc_state, &before, sizeof(gc_state));
+      strcpy(buffer, line);
+      taken = gc_execute_fast_line(buffer);
+      if (taken != GC_FAST_PATH_DECLINED) {
+        fast++;
+        same_state = (memcmp(&gc_state, &after_full, sizeof(gc_state)) == 0);
+      }
+    #endif
+
+    memcpy(&gc_state, &before, sizeof(gc_state));
+    strcpy(buffer, line);
+    uint8_t status = gc_execute_line(buffer);
+    if (memcmp(&gc_state, &after_full, sizeof(gc_state)) != 0) { same_state = false; }
+
+    if ((full != expected) || (status != expected) || !same_state ||
+        ((taken != GC_FAST_PATH_DECLINED) && (taken != expected))) {
+      printf("%s:%u: %s: expected ", path, number, line);
+      print_status(expected);
+      printf(", full parser ");
+      print_status(full);
+      printf(", fast path ");
+      print_status(taken);
+      printf(", gc_execute_line ");
+      print_status(status);
+      if (!same_state) { printf(", parser state differs"); }
+      printf("\n");
+      failures++;
+    }
+  }
+  fclose(corpus);
+
+  printf("%u lines, %u by the fast path, %u failed\n", lines, fast, failures);
+  return(failures ? 1 : 0);
+}